@@ -0,0 +1,28 @@
+import dpctl
+import dpctl.tensor as dpt
+
+
+def get_queue_or_skip():
+    """Returns queue for default-selected device, raises `NotImplementedError`
+    if none is available, which makes asv skip the benchmark."""
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        raise NotImplementedError("No default device")
+    return q
+
+
+def skip_if_dtype_not_supported(dt, q):
+    """Raises `NotImplementedError` if device of `q` does not support
+    data type `dt`, which makes asv skip the benchmark."""
+    dev = q.sycl_device
+    dt = dpt.dtype(dt)
+    if dt in (dpt.float64, dpt.complex128) and not dev.has_aspect_fp64:
+        raise NotImplementedError(f"{dt} is not supported")
+    if dt == dpt.float16 and not dev.has_aspect_fp16:
+        raise NotImplementedError(f"{dt} is not supported")
+
+
+def sync(q):
+    """Wait for all kernels submitted to the queue to complete."""
+    q.wait()
@@ -0,0 +1,34 @@
+import dpctl.tensor as dpt
+
+from ._common import get_queue_or_skip, sync
+
+
+class CopyAndCast:
+    params = [[1024, 1024 * 1024]]
+    param_names = ["size"]
+
+    def setup(self, size):
+        self.q = get_queue_or_skip()
+        self.x = dpt.ones(size, dtype="i4", sycl_queue=self.q)
+        n = int(size**0.5)
+        self.m = dpt.ones((n, n), dtype="f4", sycl_queue=self.q)
+        sync(self.q)
+
+    def time_astype(self, size):
+        dpt.astype(self.x, "f4")
+        sync(self.q)
+
+    def time_copy(self, size):
+        dpt.copy(self.x)
+        sync(self.q)
+
+    def time_copy_transposed(self, size):
+        dpt.copy(self.m.T, order="C")
+        sync(self.q)
+
+    def time_setitem_scalar(self, size):
+        self.x[...] = 0
+        sync(self.q)
+
+    def time_asnumpy(self, size):
+        dpt.asnumpy(self.x)
@@ -0,0 +1,22 @@
+import dpctl.tensor as dpt
+
+from ._common import get_queue_or_skip, sync
+
+
+class Creation:
+    params = [[1, 1024, 1024 * 1024]]
+    param_names = ["size"]
+
+    def setup(self, size):
+        self.q = get_queue_or_skip()
+
+    def time_empty(self, size):
+        dpt.empty(size, dtype="f4", sycl_queue=self.q)
+
+    def time_full(self, size):
+        dpt.full(size, 1.0, dtype="f4", sycl_queue=self.q)
+        sync(self.q)
+
+    def time_arange(self, size):
+        dpt.arange(size, dtype="f4", sycl_queue=self.q)
+        sync(self.q)
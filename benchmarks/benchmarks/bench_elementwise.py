@@ -0,0 +1,79 @@
+import dpctl.tensor as dpt
+
+from ._common import get_queue_or_skip, skip_if_dtype_not_supported, sync
+
+
+class ElementwiseBinary:
+    params = ([1, 1024, 1024 * 1024], ["i4", "f4", "f8"])
+    param_names = ["size", "dtype"]
+
+    def setup(self, size, dtype):
+        self.q = get_queue_or_skip()
+        skip_if_dtype_not_supported(dtype, self.q)
+        self.x1 = dpt.ones(size, dtype=dtype, sycl_queue=self.q)
+        self.x2 = dpt.ones(size, dtype=dtype, sycl_queue=self.q)
+        self.out = dpt.empty_like(self.x1)
+        sync(self.q)
+
+    def time_add(self, size, dtype):
+        dpt.add(self.x1, self.x2)
+        sync(self.q)
+
+    def time_add_out(self, size, dtype):
+        dpt.add(self.x1, self.x2, out=self.out)
+        sync(self.q)
+
+    def time_add_strided(self, size, dtype):
+        dpt.add(self.x1[::2], self.x2[::2])
+        sync(self.q)
+
+    def time_add_python_scalar(self, size, dtype):
+        dpt.add(self.x1, 1)
+        sync(self.q)
+
+    def time_multiply(self, size, dtype):
+        dpt.multiply(self.x1, self.x2)
+        sync(self.q)
+
+
+class ElementwiseBroadcast:
+    params = [[16, 256, 2048]]
+    param_names = ["n"]
+
+    def setup(self, n):
+        self.q = get_queue_or_skip()
+        self.mat = dpt.ones((n, n), dtype="f4", sycl_queue=self.q)
+        self.row = dpt.ones((n,), dtype="f4", sycl_queue=self.q)
+        self.col = dpt.ones((n, 1), dtype="f4", sycl_queue=self.q)
+        sync(self.q)
+
+    def time_add_row(self, n):
+        dpt.add(self.mat, self.row)
+        sync(self.q)
+
+    def time_add_column(self, n):
+        dpt.add(self.mat, self.col)
+        sync(self.q)
+
+    def time_outer(self, n):
+        dpt.multiply(self.col, self.row)
+        sync(self.q)
+
+
+class ElementwiseUnary:
+    params = ([1, 1024, 1024 * 1024], ["f4", "f8", "c8"])
+    param_names = ["size", "dtype"]
+
+    def setup(self, size, dtype):
+        self.q = get_queue_or_skip()
+        skip_if_dtype_not_supported(dtype, self.q)
+        self.x = dpt.ones(size, dtype=dtype, sycl_queue=self.q)
+        sync(self.q)
+
+    def time_sqrt(self, size, dtype):
+        dpt.sqrt(self.x)
+        sync(self.q)
+
+    def time_abs(self, size, dtype):
+        dpt.abs(self.x)
+        sync(self.q)
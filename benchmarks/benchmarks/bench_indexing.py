@@ -0,0 +1,43 @@
+import dpctl.tensor as dpt
+
+from ._common import get_queue_or_skip, sync
+
+
+class BooleanIndexing:
+    params = [[1024, 1024 * 1024]]
+    param_names = ["size"]
+
+    def setup(self, size):
+        self.q = get_queue_or_skip()
+        self.x = dpt.arange(size, dtype="f4", sycl_queue=self.q)
+        self.mask = (self.x % 3) == 0
+        sync(self.q)
+
+    def time_extract(self, size):
+        self.x[self.mask]
+
+    def time_place(self, size):
+        self.x[self.mask] = 0
+        sync(self.q)
+
+    def time_nonzero(self, size):
+        dpt.nonzero(self.mask)
+
+
+class IntegerIndexing:
+    params = [[1024, 1024 * 1024]]
+    param_names = ["size"]
+
+    def setup(self, size):
+        self.q = get_queue_or_skip()
+        self.x = dpt.ones(size, dtype="f4", sycl_queue=self.q)
+        self.ind = dpt.arange(size - 1, -1, -1, dtype="i8", sycl_queue=self.q)
+        sync(self.q)
+
+    def time_take(self, size):
+        dpt.take(self.x, self.ind)
+        sync(self.q)
+
+    def time_put(self, size):
+        dpt.put(self.x, self.ind, self.x)
+        sync(self.q)
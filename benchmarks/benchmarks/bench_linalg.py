@@ -0,0 +1,23 @@
+import dpctl.tensor as dpt
+
+from ._common import get_queue_or_skip, skip_if_dtype_not_supported, sync
+
+
+class Matmul:
+    params = ([16, 128, 512], ["f4", "f8"])
+    param_names = ["n", "dtype"]
+
+    def setup(self, n, dtype):
+        self.q = get_queue_or_skip()
+        skip_if_dtype_not_supported(dtype, self.q)
+        self.a = dpt.ones((n, n), dtype=dtype, sycl_queue=self.q)
+        self.b = dpt.ones((n, n), dtype=dtype, sycl_queue=self.q)
+        sync(self.q)
+
+    def time_matmul(self, n, dtype):
+        dpt.matmul(self.a, self.b)
+        sync(self.q)
+
+    def time_vecdot(self, n, dtype):
+        dpt.vecdot(self.a, self.b)
+        sync(self.q)
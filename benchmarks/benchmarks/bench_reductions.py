@@ -0,0 +1,28 @@
+import dpctl.tensor as dpt
+
+from ._common import get_queue_or_skip, skip_if_dtype_not_supported, sync
+
+
+class Sum:
+    params = ([1024, 1024 * 1024], ["i4", "f4", "f8"])
+    param_names = ["size", "dtype"]
+
+    def setup(self, size, dtype):
+        self.q = get_queue_or_skip()
+        skip_if_dtype_not_supported(dtype, self.q)
+        self.x = dpt.ones(size, dtype=dtype, sycl_queue=self.q)
+        n = int(size**0.5)
+        self.m = dpt.ones((n, n), dtype=dtype, sycl_queue=self.q)
+        sync(self.q)
+
+    def time_sum(self, size, dtype):
+        dpt.sum(self.x)
+        sync(self.q)
+
+    def time_sum_rows(self, size, dtype):
+        dpt.sum(self.m, axis=1)
+        sync(self.q)
+
+    def time_sum_columns(self, size, dtype):
+        dpt.sum(self.m, axis=0)
+        sync(self.q)
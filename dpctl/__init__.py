@@ -56,6 +56,7 @@ from ._sycl_device_factory import (
 from ._sycl_event import SyclEvent
 from ._sycl_platform import SyclPlatform, get_platforms, lsplatform
 from ._sycl_queue import (
+    LocalAccessor,
     SyclKernelInvalidRangeError,
     SyclKernelSubmitError,
     SyclQueue,
@@ -114,6 +115,7 @@ __all__ += [
     "SyclPlatform",
 ]
 __all__ += [
+    "LocalAccessor",
     "SyclQueue",
     "SyclKernelInvalidRangeError",
     "SyclKernelSubmitError",
@@ -76,6 +76,24 @@ def print_lsplatform(verbosity: int) -> None:
     dpctl.lsplatform(verbosity=verbosity)
 
 
+def autotune_tensor_kernels() -> None:
+    "Tunes launch parameters of dpctl.tensor kernels for all devices"
+    import dpctl.tensor._tensor_impl as ti
+
+    for d in dpctl.get_devices():
+        q = dpctl.SyclQueue(d)
+        print("Tuning kernels for " + d.name)
+        for family, type_size, wg_size, items_per_wi in (
+            ti._autotune_launch_params(q)
+        ):
+            print(
+                f"    {family:<20} type size {type_size:>2}: "
+                f"work-group size {wg_size}, items per work-item "
+                f"{items_per_wi}"
+            )
+    print("Launch parameters saved to " + ti._launch_params_cache_file())
+
+
 def main() -> None:
     """Main entry-point."""
     parser = argparse.ArgumentParser()
@@ -117,6 +135,12 @@ def main() -> None:
         action="store_true",
         help="Enumerate system platforms, using dpctl.lsplatform()",
     )
+    parser.add_argument(
+        "--tune-tensor-kernels",
+        action="store_true",
+        help="Tune launch parameters of dpctl.tensor kernels for all devices "
+        "and save them in the cache file.",
+    )
     args = parser.parse_args()
     if not sys.argv[1:]:
         parser.print_help()
@@ -146,6 +170,8 @@ def main() -> None:
         print_cmake_dir()
     if args.library:
         print_library()
+    if args.tune_tensor_kernels:
+        autotune_tensor_kernels()
 
 
 if __name__ == "__main__":
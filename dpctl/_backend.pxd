@@ -72,7 +72,8 @@ cdef extern from "syclinterface/dpctl_sycl_enum_types.h":
         _FLOAT              'DPCTL_FLOAT',
         _DOUBLE             'DPCTL_DOUBLE',
         _LONG_DOUBLE        'DPCTL_DOUBLE',
-        _VOID_PTR           'DPCTL_VOID_PTR'
+        _VOID_PTR           'DPCTL_VOID_PTR',
+        _LOCAL_ACCESSOR     'DPCTL_LOCAL_ACCESSOR'
 
     ctypedef enum _queue_property_type 'DPCTLQueuePropertyType':
         _DEFAULT_PROPERTY   'DPCTL_DEFAULT_PROPERTY'
@@ -217,6 +218,12 @@ cdef extern from "syclinterface/dpctl_sycl_device_interface.h":
     cdef size_t *DPCTLDevice_GetSubGroupSizes(const DPCTLSyclDeviceRef DRef,
         size_t *res_len)
     cdef uint32_t DPCTLDevice_GetPartitionMaxSubDevices(const DPCTLSyclDeviceRef DRef)
+    cdef bool DPCTLDevice_CanAccessPeer(
+        const DPCTLSyclDeviceRef DRef,
+        const DPCTLSyclDeviceRef PDRef)
+    cdef bool DPCTLDevice_EnablePeerAccess(
+        const DPCTLSyclDeviceRef DRef,
+        const DPCTLSyclDeviceRef PDRef)
 
 
 cdef extern from "syclinterface/dpctl_sycl_device_manager.h":
@@ -260,6 +267,9 @@ cdef extern from "syclinterface/dpctl_sycl_event_interface.h":
     cdef _backend_type DPCTLEvent_GetBackend(DPCTLSyclEventRef ERef)
     cdef struct DPCTLEventVector
     ctypedef DPCTLEventVector *DPCTLEventVectorRef
+    cdef DPCTLEventVectorRef DPCTLEventVector_CreateFromArray(
+        size_t nelems,
+        DPCTLSyclEventRef *elems)
     cdef void DPCTLEventVector_Delete(DPCTLEventVectorRef EVRef)
     cdef size_t DPCTLEventVector_Size(DPCTLEventVectorRef EVRef)
     cdef DPCTLSyclEventRef DPCTLEventVector_GetAt(
@@ -270,6 +280,7 @@ cdef extern from "syclinterface/dpctl_sycl_event_interface.h":
     cdef size_t DPCTLEvent_GetProfilingInfoSubmit(DPCTLSyclEventRef ERef)
     cdef size_t DPCTLEvent_GetProfilingInfoStart(DPCTLSyclEventRef ERef)
     cdef size_t DPCTLEvent_GetProfilingInfoEnd(DPCTLSyclEventRef ERef)
+    cdef void DPCTLEvent_WaitForAll(DPCTLEventVectorRef EVRef) nogil
 
 
 cdef extern from "syclinterface/dpctl_sycl_kernel_interface.h":
@@ -283,6 +294,13 @@ cdef extern from "syclinterface/dpctl_sycl_kernel_interface.h":
     cdef uint32_t DPCTLKernel_GetMaxSubGroupSize(const DPCTLSyclKernelRef KRef)
     cdef uint32_t DPCTLKernel_GetCompileNumSubGroups(const DPCTLSyclKernelRef KRef)
     cdef uint32_t DPCTLKernel_GetCompileSubGroupSize(const DPCTLSyclKernelRef KRef)
+    cdef bool DPCTLKernel_SuggestNDRange(
+        const DPCTLSyclKernelRef KRef,
+        const DPCTLSyclDeviceRef DRef,
+        const size_t *gRange,
+        size_t *lRange,
+        size_t NDims,
+        size_t LocalMemBytes)
 
 
 cdef extern from "syclinterface/dpctl_sycl_platform_manager.h":
@@ -341,12 +359,12 @@ cdef extern from "syclinterface/dpctl_sycl_kernel_bundle_interface.h":
         const DPCTLSyclDeviceRef Dev,
         const void *IL,
         size_t Length,
-        const char *CompileOpts)
+        const char *CompileOpts) nogil
     cdef DPCTLSyclKernelBundleRef DPCTLKernelBundle_CreateFromOCLSource(
         const DPCTLSyclContextRef Ctx,
         const DPCTLSyclDeviceRef Dev,
         const char *Source,
-        const char *CompileOpts)
+        const char *CompileOpts) nogil
     cdef DPCTLSyclKernelRef DPCTLKernelBundle_GetKernel(
         DPCTLSyclKernelBundleRef KBRef,
         const char *KernelName)
@@ -358,6 +376,12 @@ cdef extern from "syclinterface/dpctl_sycl_kernel_bundle_interface.h":
 
 
 cdef extern from "syclinterface/dpctl_sycl_queue_interface.h":
+    ctypedef struct _md_local_accessor 'MDLocalAccessor':
+        size_t ndim
+        _arg_data_type dpctl_type_id
+        size_t dim0
+        size_t dim1
+        size_t dim2
     cdef bool DPCTLQueue_AreEq(const DPCTLSyclQueueRef QRef1,
                                const DPCTLSyclQueueRef QRef2)
     cdef DPCTLSyclQueueRef DPCTLQueue_Create(
@@ -470,3 +494,9 @@ cdef extern from "syclinterface/dpctl_sycl_usm_interface.h":
     cdef DPCTLSyclDeviceRef DPCTLUSM_GetPointerDevice(
         DPCTLSyclUSMRef MRef,
         DPCTLSyclContextRef CRef)
+    cdef bool DPCTLUSM_PlaceByFirstTouch(
+        DPCTLSyclUSMRef MRef,
+        size_t Size,
+        const DPCTLSyclQueueRef *QRefs,
+        size_t NQRefs,
+        size_t ChunkSize) nogil
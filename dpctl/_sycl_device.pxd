@@ -46,6 +46,7 @@ cdef public api class SyclDevice(_SyclDevice) [
     object PySyclDeviceObject,
     type PySyclDeviceType
 ]:
+    cdef object _filter_string
     @staticmethod
     cdef SyclDevice _create(DPCTLSyclDeviceRef dref)
     cdef int _init_from__SyclDevice(self, _SyclDevice other)
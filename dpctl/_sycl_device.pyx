@@ -1414,12 +1414,14 @@ cdef class SyclDevice(_SyclDevice):
                 assert level_zero_gpu == dev
         """
         cdef DPCTLSyclDeviceRef pDRef = NULL
-        cdef _backend_type BTy
-        cdef _device_type DTy
-        cdef int64_t relId = -1
+        if self._filter_string is not None:
+            return self._filter_string
         pDRef = DPCTLDevice_GetParentDevice(self._device_ref)
         if (pDRef is NULL):
-            return _cached_filter_string(self)
+            # computed once per instance, avoiding hashing of the device
+            # in the look-up of the module-level cache on repeated calls
+            self._filter_string = _cached_filter_string(self)
+            return self._filter_string
         else:
             # this a sub-device, free it, and raise an exception
             DPCTLDevice_Delete(pDRef)
@@ -45,4 +45,6 @@ cdef public api class SyclEvent(_SyclEvent) [
     cdef int _init_event_from_capsule(self, object caps)
     cdef DPCTLSyclEventRef get_event_ref (self)
     cdef void _wait (SyclEvent event)
+    @staticmethod
+    cdef void _wait_for_all (object events) except *
     cpdef void wait (self)
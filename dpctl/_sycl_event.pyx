@@ -25,6 +25,7 @@ import logging
 
 from cpython cimport pycapsule
 from libc.stdint cimport uint64_t
+from libc.stdlib cimport free, malloc
 import collections.abc
 
 from ._backend cimport (  # noqa: E211
@@ -39,6 +40,8 @@ from ._backend cimport (  # noqa: E211
     DPCTLEvent_GetWaitList,
     DPCTLEvent_Wait,
     DPCTLEvent_WaitAndThrow,
+    DPCTLEvent_WaitForAll,
+    DPCTLEventVector_CreateFromArray,
     DPCTLEventVector_Delete,
     DPCTLEventVector_GetAt,
     DPCTLEventVector_Size,
@@ -220,14 +223,37 @@ cdef class SyclEvent(_SyclEvent):
     cdef void _wait(SyclEvent event):
         with nogil: DPCTLEvent_WaitAndThrow(event._event_ref)
 
+    @staticmethod
+    cdef void _wait_for_all(object events) except *:
+        cdef size_t nE = len(events)
+        cdef size_t i = 0
+        cdef DPCTLSyclEventRef *ERefs = NULL
+        cdef DPCTLEventVectorRef EVRef = NULL
+
+        if nE == 0:
+            return
+        ERefs = <DPCTLSyclEventRef*>malloc(nE * sizeof(DPCTLSyclEventRef))
+        if ERefs is NULL:
+            raise MemoryError()
+        for i in range(nE):
+            ERefs[i] = (<SyclEvent>events[i]).get_event_ref()
+        EVRef = DPCTLEventVector_CreateFromArray(nE, ERefs)
+        free(ERefs)
+        if EVRef is NULL:
+            raise ValueError("Internal error: NULL event vector encountered")
+        with nogil: DPCTLEvent_WaitForAll(EVRef)
+        DPCTLEventVector_Delete(EVRef)
+
     @staticmethod
     def wait_for(event):
         """ Waits for a given event or a sequence of events.
+
+        The GIL is released once, for the duration of waiting for all
+        events of the sequence.
         """
         if (isinstance(event, collections.abc.Sequence) and
            all((isinstance(el, SyclEvent) for el in event))):
-            for e in event:
-                SyclEvent._wait(e)
+            SyclEvent._wait_for_all(event)
         elif isinstance(event, SyclEvent):
             SyclEvent._wait(event)
         else:
@@ -236,6 +262,38 @@ cdef class SyclEvent(_SyclEvent):
                 "a sequence of such objects"
             )
 
+    @staticmethod
+    def when_all(events, sycl_queue=None):
+        """ Returns an event which completes when all of the given events
+        complete.
+
+        The aggregate event is produced by submitting a barrier depending
+        on all given events, so that waiting on it, or passing it as a
+        single dependency to later submissions, replaces handling each
+        event separately.
+
+        Args:
+            events (Sequence[:class:`dpctl.SyclEvent`]):
+                events to aggregate.
+            sycl_queue (:class:`dpctl.SyclQueue`, optional):
+                queue to submit the barrier to. If `None`, the current
+                queue returned by :func:`dpctl.get_current_queue` is
+                used. Default: `None`.
+
+        Returns:
+            :class:`dpctl.SyclEvent`:
+                the event of the submitted barrier.
+        """
+        if not (isinstance(events, collections.abc.Sequence) and
+                all((isinstance(el, SyclEvent) for el in events))):
+            raise TypeError(
+                "The passed argument is not a sequence of SyclEvent objects"
+            )
+        if sycl_queue is None:
+            from ._sycl_queue_manager import get_current_queue
+            sycl_queue = get_current_queue()
+        return sycl_queue.submit_barrier(events)
+
     def addressof_ref(self):
         """ Returns the address of the C API `DPCTLSyclEventRef` pointer as
         a size_t.
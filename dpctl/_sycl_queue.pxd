@@ -77,7 +77,7 @@ cdef public api class SyclQueue (_SyclQueue) [
         SyclKernel kernel,
         list args,
         list gS,
-        list lS=*,
+        object lS=*,
         list dEvents=*
     )
     cpdef void wait(self)
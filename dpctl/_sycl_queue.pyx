@@ -33,6 +33,7 @@ from ._backend cimport (  # noqa: E211
     DPCTLEvent_Delete,
     DPCTLEvent_Wait,
     DPCTLFilterSelector_Create,
+    DPCTLKernel_SuggestNDRange,
     DPCTLQueue_AreEq,
     DPCTLQueue_Copy,
     DPCTLQueue_Create,
@@ -55,6 +56,7 @@ from ._backend cimport (  # noqa: E211
     DPCTLSyclEventRef,
     _arg_data_type,
     _backend_type,
+    _md_local_accessor,
     _queue_property_type,
     error_handler_callback,
 )
@@ -77,6 +79,7 @@ cdef extern from "_host_task_util.hpp":
 
 
 __all__ = [
+    "LocalAccessor",
     "SyclQueue",
     "SyclKernelInvalidRangeError",
     "SyclKernelSubmitError",
@@ -121,6 +124,113 @@ cdef class SyclAsynchronousError(Exception):
     """
 
 
+cdef class LocalAccessor:
+    """
+    LocalAccessor(dtype, shape)
+
+    Python class describing a kernel argument in local (work-group shared)
+    memory, to be passed to :meth:`dpctl.SyclQueue.submit` along with
+    other kernel arguments. A ``sycl::local_accessor`` of the given element
+    type and shape is created for the argument at submission. The local
+    memory is allocated for every work-group of the ``nd_range`` the kernel
+    is submitted with.
+
+    Args:
+        dtype (str):
+            Type of elements of the local memory, one of ``"i1"``,
+            ``"u1"``, ``"i2"``, ``"i4"``, ``"u4"``, ``"i8"``, ``"u8"``,
+            ``"f4"``, or ``"f8"``.
+        shape (tuple):
+            Shape of the local memory. Must have one to three positive
+            elements.
+
+    Raises:
+        ValueError: If ``dtype`` is not supported or ``shape`` is not
+            valid.
+
+    :Example:
+        .. code-block:: python
+
+            import dpctl
+
+            # 256 float32 elements of local memory per work-group
+            lacc = dpctl.LocalAccessor("f4", (256,))
+            q.submit(kernel, [x_usm, lacc], [n], [256])
+    """
+    cdef _md_local_accessor lacc
+    cdef str _dtype
+
+    def __cinit__(self, str dtype, tuple shape):
+        cdef size_t ndim = len(shape)
+        cdef size_t dims[3]
+
+        if dtype == "i1":
+            self.lacc.dpctl_type_id = _arg_data_type._SIGNED_CHAR
+        elif dtype == "u1":
+            self.lacc.dpctl_type_id = _arg_data_type._UNSIGNED_CHAR
+        elif dtype == "i2":
+            self.lacc.dpctl_type_id = _arg_data_type._SHORT
+        elif dtype == "i4":
+            self.lacc.dpctl_type_id = _arg_data_type._INT
+        elif dtype == "u4":
+            self.lacc.dpctl_type_id = _arg_data_type._UNSIGNED_INT
+        elif dtype == "i8":
+            self.lacc.dpctl_type_id = _arg_data_type._LONG_LONG
+        elif dtype == "u8":
+            self.lacc.dpctl_type_id = _arg_data_type._UNSIGNED_LONG_LONG
+        elif dtype == "f4":
+            self.lacc.dpctl_type_id = _arg_data_type._FLOAT
+        elif dtype == "f8":
+            self.lacc.dpctl_type_id = _arg_data_type._DOUBLE
+        else:
+            raise ValueError(
+                "Local accessor element type '{}' is not supported.".format(
+                    dtype
+                )
+            )
+
+        if ndim < 1 or ndim > 3:
+            raise ValueError(
+                "Local accessor must have between one and three dimensions, "
+                "got {}.".format(ndim)
+            )
+        for i in range(3):
+            dims[i] = 1
+        for i, d in enumerate(shape):
+            if not isinstance(d, int) or d <= 0:
+                raise ValueError(
+                    "Local accessor shape must consist of positive integers, "
+                    "got {}.".format(shape)
+                )
+            dims[i] = <size_t>d
+        self.lacc.ndim = ndim
+        self.lacc.dim0 = dims[0]
+        self.lacc.dim1 = dims[1]
+        self.lacc.dim2 = dims[2]
+        self._dtype = dtype
+
+    @property
+    def dtype(self):
+        """ Type of elements of the local memory as a string."""
+        return self._dtype
+
+    @property
+    def shape(self):
+        """ Shape of the local memory as a tuple."""
+        cdef tuple dims = (self.lacc.dim0, self.lacc.dim1, self.lacc.dim2)
+        return dims[:self.lacc.ndim]
+
+    def __repr__(self):
+        return "dpctl.LocalAccessor('{}', {})".format(self._dtype, self.shape)
+
+    cdef size_t _nbytes(self):
+        cdef size_t itemsize = int(self._dtype[1])
+        return itemsize * self.lacc.dim0 * self.lacc.dim1 * self.lacc.dim2
+
+    cdef void *_addressof(self):
+        return <void *>&self.lacc
+
+
 cdef void default_async_error_handler(int err) nogil except *:
     with gil:
         raise SyclAsynchronousError(err)
@@ -623,6 +733,9 @@ cdef class SyclQueue(_SyclQueue):
             elif isinstance(arg, _Memory):
                 kargs[idx]= <void*>(<size_t>arg._pointer)
                 kargty[idx] = _arg_data_type._VOID_PTR
+            elif isinstance(arg, LocalAccessor):
+                kargs[idx] = (<LocalAccessor>arg)._addressof()
+                kargty[idx] = _arg_data_type._LOCAL_ACCESSOR
             else:
                 ret = -1
         return ret
@@ -721,9 +834,27 @@ cdef class SyclQueue(_SyclQueue):
         SyclKernel kernel,
         list args,
         list gS,
-        list lS=None,
+        object lS=None,
         list dEvents=None
     ):
+        """
+        Submits the kernel to the queue.
+
+        Args:
+            kernel (:class:`dpctl.program.SyclKernel`): The kernel to submit.
+            args (list): Kernel arguments, ``ctypes`` scalars,
+                USM memory objects or :class:`dpctl.LocalAccessor` objects.
+            gS (list): Global range of the submission.
+            lS (list, str, optional): Local range of the submission. The
+                kernel is submitted with a plain range if ``None``. If
+                ``"auto"``, the local range is chosen for the occupancy of
+                the device, accounting for the local memory used by
+                :class:`dpctl.LocalAccessor` arguments.
+            dEvents (list, optional): Events the submission depends on.
+
+        Returns:
+            :class:`dpctl.SyclEvent`: The event of the submission.
+        """
         cdef void **kargs = NULL
         cdef _arg_data_type *kargty = NULL
         cdef DPCTLSyclEventRef *depEvents = NULL
@@ -732,11 +863,23 @@ cdef class SyclQueue(_SyclQueue):
         cdef size_t gRange[3]
         cdef size_t lRange[3]
         cdef size_t nGS = len(gS)
-        cdef size_t nLS = len(lS) if lS is not None else 0
+        cdef size_t nLS = 0
+        cdef bint auto_lS = False
+        cdef size_t local_mem_bytes = 0
         cdef size_t nDE = len(dEvents) if dEvents is not None else 0
         cdef PyObject **arg_objects = NULL
         cdef ssize_t i = 0
 
+        if isinstance(lS, str):
+            if lS != "auto":
+                raise ValueError(
+                    "Local range '{}' is not understood, expecting a list "
+                    "or 'auto'".format(lS)
+                )
+            auto_lS = True
+        elif lS is not None:
+            nLS = len(lS)
+
         # Allocate the arrays to be sent to DPCTLQueue_Submit
         kargs = <void**>malloc(len(args) * sizeof(void*))
         if not kargs:
@@ -799,7 +942,27 @@ cdef class SyclQueue(_SyclQueue):
                     "Range with ", nGS, " not allowed. Range can only have "
                     "between one and three dimensions."
                 )
-            ret = self._populate_range(lRange, lS, nLS)
+            if auto_lS:
+                for arg in args:
+                    if isinstance(arg, LocalAccessor):
+                        local_mem_bytes += (<LocalAccessor>arg)._nbytes()
+                if not DPCTLKernel_SuggestNDRange(
+                    kernel.get_kernel_ref(),
+                    self._device.get_device_ref(),
+                    gRange,
+                    lRange,
+                    nGS,
+                    local_mem_bytes
+                ):
+                    free(kargs)
+                    free(kargty)
+                    free(depEvents)
+                    raise SyclKernelSubmitError(
+                        "Local range could not be chosen for the kernel."
+                    )
+                nLS = nGS
+            else:
+                ret = self._populate_range(lRange, lS, nLS)
             if ret == -1:
                 free(kargs)
                 free(kargty)
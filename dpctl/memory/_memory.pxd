@@ -37,6 +37,7 @@ cdef public api class _Memory [object Py_MemoryObject, type Py_MemoryType]:
     cdef Py_ssize_t nbytes
     cdef SyclQueue queue
     cdef object refobj
+    cdef bint system_alloc
 
     cdef _cinit_empty(self)
     cdef _cinit_alloc(self, Py_ssize_t alignment, Py_ssize_t nbytes,
@@ -65,6 +66,13 @@ cdef public api class _Memory [object Py_MemoryObject, type Py_MemoryType]:
         DPCTLSyclQueueRef QRef,
         object memory_owner=*
     )
+    @staticmethod
+    cdef object create_from_host_pointer_size_qref(
+        DPCTLSyclUSMRef HostRef,
+        Py_ssize_t nbytes,
+        DPCTLSyclQueueRef QRef,
+        object memory_owner
+    )
 
 
 cdef public api class MemoryUSMShared(_Memory) [object PyMemoryUSMSharedObject,
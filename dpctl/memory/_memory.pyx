@@ -55,6 +55,7 @@ from dpctl._backend cimport (  # noqa: E211
     DPCTLSyclUSMRef,
     DPCTLUSM_GetPointerDevice,
     DPCTLUSM_GetPointerType,
+    DPCTLUSM_PlaceByFirstTouch,
     _usm_type,
 )
 
@@ -63,6 +64,9 @@ from .._sycl_device cimport SyclDevice
 from .._sycl_queue cimport SyclQueue
 from .._sycl_queue_manager cimport get_device_cached_queue
 
+from libc.stdlib cimport free, malloc
+from libc.string cimport memcpy
+
 import collections
 import numbers
 
@@ -88,37 +92,97 @@ class USMAllocationError(Exception):
     pass
 
 
+# Size of chunks of pipelined copy via host, large enough for transfers
+# to run at full bandwidth
+cdef size_t _copy_via_host_chunk_nbytes = 8 * 1024 * 1024
+
 cdef void copy_via_host(void *dest_ptr, SyclQueue dest_queue,
-                        void *src_ptr, SyclQueue src_queue, size_t nbytes):
+                        void *src_ptr, SyclQueue src_queue,
+                        size_t nbytes) except *:
     """
     Copies `nbytes` bytes from `src_ptr` USM memory to
     `dest_ptr` USM memory using host as the intemediary.
 
     This is useful when `src_ptr` and `dest_ptr` are bound to incompatible
     SYCL contexts.
+
+    Data are copied chunk by chunk into a pinned USM-host buffer allocated
+    in the context of the source queue, and on the host into one of two
+    pinned USM-host buffers allocated in the context of the destination
+    queue, so that both device transfers use memory pinned for their
+    context, and copying of a chunk from the host to the destination
+    overlaps with copying of the next chunk from the source to the host.
     """
-    # could also have used bytearray(nbytes)
-    cdef unsigned char[::1] host_buf = np.empty((nbytes,), dtype="|u1")
-    cdef DPCTLSyclEventRef E1Ref = NULL
-    cdef DPCTLSyclEventRef E2Ref = NULL
-
-    E1Ref = DPCTLQueue_Memcpy(
-        src_queue.get_queue_ref(),
-        <void *>&host_buf[0],
-        src_ptr,
-        nbytes
+    cdef size_t chunk_nbytes = min(nbytes, _copy_via_host_chunk_nbytes)
+    cdef DPCTLSyclUSMRef src_host_buf = NULL
+    cdef DPCTLSyclUSMRef dest_host_bufs[2]
+    cdef DPCTLSyclEventRef h2d_evs[2]
+    cdef DPCTLSyclEventRef d2h_ev = NULL
+    cdef size_t offset = 0
+    cdef size_t n = 0
+    cdef int i = 0
+    cdef int b = 0
+
+    if nbytes == 0:
+        return
+    src_host_buf = DPCTLmalloc_host(chunk_nbytes, src_queue.get_queue_ref())
+    dest_host_bufs[0] = DPCTLmalloc_host(
+        chunk_nbytes, dest_queue.get_queue_ref()
     )
-    with nogil: DPCTLEvent_Wait(E1Ref)
-
-    E2Ref = DPCTLQueue_Memcpy(
-        dest_queue.get_queue_ref(),
-        dest_ptr,
-        <void *>&host_buf[0],
-        nbytes
+    dest_host_bufs[1] = DPCTLmalloc_host(
+        chunk_nbytes, dest_queue.get_queue_ref()
     )
-    with nogil: DPCTLEvent_Wait(E2Ref)
-    DPCTLEvent_Delete(E1Ref)
-    DPCTLEvent_Delete(E2Ref)
+    h2d_evs[0] = NULL
+    h2d_evs[1] = NULL
+    if (
+        src_host_buf is NULL or
+        dest_host_bufs[0] is NULL or
+        dest_host_bufs[1] is NULL
+    ):
+        if src_host_buf is not NULL:
+            DPCTLfree_with_queue(src_host_buf, src_queue.get_queue_ref())
+        for b in range(2):
+            if dest_host_bufs[b] is not NULL:
+                DPCTLfree_with_queue(
+                    dest_host_bufs[b], dest_queue.get_queue_ref()
+                )
+        raise USMAllocationError(
+            "USM-host allocation of staging buffers failed"
+        )
+
+    while offset < nbytes:
+        n = min(chunk_nbytes, nbytes - offset)
+        b = i % 2
+        # the buffer may still be read by a copy to the destination
+        if h2d_evs[b] is not NULL:
+            with nogil: DPCTLEvent_Wait(h2d_evs[b])
+            DPCTLEvent_Delete(h2d_evs[b])
+            h2d_evs[b] = NULL
+        d2h_ev = DPCTLQueue_Memcpy(
+            src_queue.get_queue_ref(),
+            <void *>src_host_buf,
+            <void *>(<char *>src_ptr + offset),
+            n
+        )
+        with nogil: DPCTLEvent_Wait(d2h_ev)
+        DPCTLEvent_Delete(d2h_ev)
+        with nogil:
+            memcpy(<void *>dest_host_bufs[b], <void *>src_host_buf, n)
+        h2d_evs[b] = DPCTLQueue_Memcpy(
+            dest_queue.get_queue_ref(),
+            <void *>(<char *>dest_ptr + offset),
+            <void *>dest_host_bufs[b],
+            n
+        )
+        offset += n
+        i += 1
+
+    for b in range(2):
+        if h2d_evs[b] is not NULL:
+            with nogil: DPCTLEvent_Wait(h2d_evs[b])
+            DPCTLEvent_Delete(h2d_evs[b])
+        DPCTLfree_with_queue(dest_host_bufs[b], dest_queue.get_queue_ref())
+    DPCTLfree_with_queue(src_host_buf, src_queue.get_queue_ref())
 
 
 def _to_memory(unsigned char[::1] b, str usm_kind):
@@ -143,6 +207,68 @@ def _to_memory(unsigned char[::1] b, str usm_kind):
     return res
 
 
+# Size of chunks of memory interleaved across devices by placement,
+# matching the size of huge pages
+cdef size_t _interleave_nbytes = 2 * 1024 * 1024
+
+
+cdef SyclQueue _placement_queue(SyclQueue alloc_q, object p):
+    if isinstance(p, SyclQueue):
+        return <SyclQueue>p
+    elif isinstance(p, SyclDevice):
+        return SyclQueue(alloc_q.sycl_context, p)
+    raise TypeError(
+        "Expected dpctl.SyclQueue or dpctl.SyclDevice in placement, "
+        "got {}".format(type(p))
+    )
+
+
+cdef int _place_memory(_Memory mem, object placement) except -1:
+    """Initializes memory of the new allocation with zeros by the devices
+    given by `placement`, so that the memory pages are placed on the
+    NUMA nodes of these devices by the first touch policy.
+    """
+    cdef list queues
+    cdef size_t chunk_nbytes = 0
+    cdef size_t nq = 0
+    cdef size_t i = 0
+    cdef bint placed = False
+    cdef DPCTLSyclQueueRef *QRefs = NULL
+
+    if placement is None:
+        return 0
+    if isinstance(placement, str):
+        if placement != "first_touch":
+            raise ValueError(
+                "Placement '{}' is not understood, expecting "
+                "'first_touch'".format(placement)
+            )
+        queues = [mem.queue]
+    elif isinstance(placement, (list, tuple)) and len(placement) > 0:
+        queues = [_placement_queue(mem.queue, p) for p in placement]
+        chunk_nbytes = _interleave_nbytes
+    else:
+        queues = [_placement_queue(mem.queue, placement)]
+
+    nq = len(queues)
+    QRefs = <DPCTLSyclQueueRef *>malloc(nq * sizeof(DPCTLSyclQueueRef))
+    if not QRefs:
+        raise MemoryError()
+    for i in range(nq):
+        QRefs[i] = (<SyclQueue>queues[i]).get_queue_ref()
+    with nogil:
+        placed = DPCTLUSM_PlaceByFirstTouch(
+            mem.memory_ptr, <size_t>mem.nbytes, QRefs, nq, chunk_nbytes
+        )
+    free(QRefs)
+    if not placed:
+        raise ValueError(
+            "Memory could not be placed by devices of queues {}, "
+            "which must share the context of the allocation".format(queues)
+        )
+    return 0
+
+
 cdef class _Memory:
     """ Internal class implementing methods common to
         MemoryUSMShared, MemoryUSMDevice, MemoryUSMHost
@@ -152,6 +278,7 @@ cdef class _Memory:
         self.nbytes = 0
         self.queue = None
         self.refobj = None
+        self.system_alloc = False
 
     cdef _cinit_alloc(self, Py_ssize_t alignment, Py_ssize_t nbytes,
                       bytes ptr_type, SyclQueue queue):
@@ -213,6 +340,7 @@ cdef class _Memory:
             self.memory_ptr = other_mem.memory_ptr
             self.nbytes = other_mem.nbytes
             self.queue = other_mem.queue
+            self.system_alloc = other_mem.system_alloc
             if other_mem.refobj is None:
                 self.refobj = other
             else:
@@ -249,9 +377,11 @@ cdef class _Memory:
     cdef _getbuffer(self, Py_buffer *buffer, int flags):
         # memory_ptr is Ref which is pointer to SYCL type. For USM it is void*.
         cdef SyclContext ctx = self._context
-        cdef _usm_type UsmTy = DPCTLUSM_GetPointerType(
-            self.memory_ptr, ctx.get_context_ref()
-        )
+        cdef _usm_type UsmTy = _usm_type._USM_HOST
+        if not self.system_alloc:
+            UsmTy = DPCTLUSM_GetPointerType(
+                self.memory_ptr, ctx.get_context_ref()
+            )
         if UsmTy == _usm_type._USM_DEVICE:
             raise ValueError("USM Device memory is not host accessible")
         buffer.buf = <char*>self.memory_ptr
@@ -367,10 +497,15 @@ cdef class _Memory:
         `syclobj` keyword argument. Value of None is understood to query
         against `self.sycl_context` - the context used to create the
         allocation.
+
+        Host memory imported with the device's support for system
+        allocations is reported as 'host'.
         """
         cdef const char* kind
         cdef SyclContext ctx
         cdef SyclQueue q
+        if self.system_alloc:
+            return "host"
         if syclobj is None:
             ctx = self._context
             return _Memory.get_pointer_type(
@@ -404,6 +539,8 @@ cdef class _Memory:
         cdef const char* kind
         cdef SyclContext ctx
         cdef SyclQueue q
+        if self.system_alloc:
+            return _usm_type._USM_HOST
         if syclobj is None:
             ctx = self._context
             return _Memory.get_pointer_type_enum(
@@ -690,10 +827,58 @@ cdef class _Memory:
         _mem.refobj = memory_owner
         return mem_ty(res)
 
+    @staticmethod
+    cdef object create_from_host_pointer_size_qref(
+        DPCTLSyclUSMRef HostRef, Py_ssize_t nbytes,
+        DPCTLSyclQueueRef QRef, object memory_owner
+    ):
+        r"""
+        Create `MemoryUSMHost` object from host memory not allocated
+        by SYCL runtime, e.g. memory of a NumPy array, without a copy.
+
+        The device of the reference SYCL queue must support system
+        allocations, i.e. kernels submitted to it can access any
+        host memory. The memory is never freed by the created object,
+        `memory_owner` must keep it alive instead.
+        """
+        cdef DPCTLSyclQueueRef QRef_copy = NULL
+        cdef _Memory _mem
+        if nbytes <= 0:
+            raise ValueError("Number of bytes must must be positive")
+        if (QRef is NULL):
+            raise TypeError("Argument DPCTLSyclQueueRef is NULL")
+        if memory_owner is None:
+            raise ValueError("Owner of host memory must be specified")
+        QRef_copy = DPCTLQueue_Copy(QRef)
+        if QRef_copy is NULL:
+            raise ValueError("Referenced queue could not be copied.")
+        try:
+            q = SyclQueue._create(QRef_copy)  # consumes the copy
+        except dpctl.SyclQueueCreationError as sqce:
+            raise ValueError(
+                "SyclQueue object could not be created from "
+                "copy of referenced queue"
+            ) from sqce
+        if not q.sycl_device.has_aspect_usm_system_allocations:
+            raise ValueError(
+                f"Device {q.sycl_device.name} can not access "
+                "host memory not allocated by SYCL runtime"
+            )
+        res = _Memory.__new__(_Memory)
+        _mem = <_Memory> res
+        _mem._cinit_empty()
+        _mem.memory_ptr = HostRef
+        _mem.nbytes = nbytes
+        _mem.queue = q
+        _mem.refobj = memory_owner
+        _mem.system_alloc = True
+        return MemoryUSMHost(res)
+
 
 cdef class MemoryUSMShared(_Memory):
     """
-    MemoryUSMShared(nbytes, alignment=0, queue=None, copy=False)
+    MemoryUSMShared(nbytes, alignment=0, queue=None, copy=False, \
+        placement=None)
 
     An object representing allocation of SYCL USM-shared memory.
 
@@ -701,17 +886,33 @@ cdef class MemoryUSMShared(_Memory):
     the allocator ``malloc_shared`` is used for allocation instead.
     If ``queue`` is ``None`` a cached default-constructed
     :class:`dpctl.SyclQueue` is used to allocate memory.
+    If ``placement`` is not ``None``, memory of a new allocation is
+    initialized with zeros by the devices it specifies, so that the
+    operating system places memory pages on the NUMA nodes closest to
+    these devices. Supported values are:
+
+        - ``"first_touch"``: pages are placed by the device of ``queue``.
+        - a :class:`dpctl.SyclQueue` or :class:`dpctl.SyclDevice`:
+          pages are placed on the preferred device, e.g. a sub-device
+          created by ``create_sub_devices(partition="numa")``.
+        - a list of queues or devices: chunks of 2 MiB are placed
+          round-robin by the devices, interleaving the allocation.
+
+    Devices must belong to the context of ``queue``.
     """
     def __cinit__(self, other, *, Py_ssize_t alignment=0,
-                  SyclQueue queue=None, int copy=False):
+                  SyclQueue queue=None, int copy=False,
+                  object placement=None):
         if (isinstance(other, numbers.Integral)):
             self._cinit_alloc(alignment, <Py_ssize_t>other, b"shared", queue)
+            _place_memory(self, placement)
         else:
             self._cinit_other(other)
             if (self.get_usm_type() != "shared"):
                 if copy:
                     self._cinit_alloc(0, <Py_ssize_t>self.nbytes,
                                       b"shared", queue)
+                    _place_memory(self, placement)
                     self.copy_from_device(other)
                 else:
                     raise ValueError(
@@ -730,7 +931,8 @@ cdef class MemoryUSMShared(_Memory):
 
 cdef class MemoryUSMHost(_Memory):
     """
-    MemoryUSMHost(nbytes, alignment=0, queue=None, copy=False)
+    MemoryUSMHost(nbytes, alignment=0, queue=None, copy=False, \
+        placement=None)
 
     An object representing allocation of SYCL USM-host memory.
 
@@ -738,11 +940,14 @@ cdef class MemoryUSMHost(_Memory):
     the allocator ``malloc_host`` is used for allocation instead.
     If ``queue`` is ``None`` a cached default-constructed
     :class:`dpctl.SyclQueue` is used to allocate memory.
+    See :class:`dpctl.memory.MemoryUSMShared` for ``placement``.
     """
     def __cinit__(self, other, *, Py_ssize_t alignment=0,
-                  SyclQueue queue=None, int copy=False):
+                  SyclQueue queue=None, int copy=False,
+                  object placement=None):
         if (isinstance(other, numbers.Integral)):
             self._cinit_alloc(alignment, <Py_ssize_t>other, b"host", queue)
+            _place_memory(self, placement)
         else:
             self._cinit_other(other)
             if (self.get_usm_type() != "host"):
@@ -750,6 +955,7 @@ cdef class MemoryUSMHost(_Memory):
                     self._cinit_alloc(
                         0, <Py_ssize_t>self.nbytes, b"host", queue
                     )
+                    _place_memory(self, placement)
                     self.copy_from_device(other)
                 else:
                     raise ValueError(
@@ -776,9 +982,19 @@ cdef class MemoryUSMDevice(_Memory):
     the allocator ``malloc_device`` is used for allocation instead.
     If ``queue`` is ``None`` a cached default-constructed
     :class:`dpctl.SyclQueue` is used to allocate memory.
+    The ``placement`` keyword of :class:`dpctl.memory.MemoryUSMShared`
+    is not supported, since pages of USM-device allocations are not
+    placed by the operating system, and ``ValueError`` is raised if
+    it is not ``None``.
     """
     def __cinit__(self, other, *, Py_ssize_t alignment=0,
-                  SyclQueue queue=None, int copy=False):
+                  SyclQueue queue=None, int copy=False,
+                  object placement=None):
+        if placement is not None:
+            raise ValueError(
+                "Placement is not supported for USM-device allocations, "
+                "use USM-shared or USM-host memory instead"
+            )
         if (isinstance(other, numbers.Integral)):
             self._cinit_alloc(alignment, <Py_ssize_t>other, b"device", queue)
         else:
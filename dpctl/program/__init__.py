@@ -25,12 +25,16 @@ from ._program import (
     SyclProgram,
     SyclProgramCompilationError,
     create_program_from_source,
+    create_program_from_source_async,
     create_program_from_spirv,
+    create_program_from_spirv_async,
 )
 
 __all__ = [
     "create_program_from_source",
+    "create_program_from_source_async",
     "create_program_from_spirv",
+    "create_program_from_spirv_async",
     "SyclKernel",
     "SyclProgram",
     "SyclProgramCompilationError",
@@ -25,6 +25,10 @@ a OpenCL source string or a SPIR-V binary file.
 
 """
 
+import concurrent.futures
+import os
+import threading
+
 from libc.stdint cimport uint32_t
 
 from dpctl._backend cimport (  # noqa: E211, E402;
@@ -53,7 +57,9 @@ from dpctl._backend cimport (  # noqa: E211, E402;
 
 __all__ = [
     "create_program_from_source",
+    "create_program_from_source_async",
     "create_program_from_spirv",
+    "create_program_from_spirv_async",
     "SyclKernel",
     "SyclProgram",
     "SyclProgramCompilationError",
@@ -256,19 +262,12 @@ cpdef create_program_from_source(SyclQueue q, unicode src, unicode copts=""):
             created.
     """
 
-    cdef DPCTLSyclKernelBundleRef KBref
-    cdef bytes bSrc = src.encode('utf8')
-    cdef bytes bCOpts = copts.encode('utf8')
-    cdef const char *Src = <const char*>bSrc
-    cdef const char *COpts = <const char*>bCOpts
-    cdef DPCTLSyclContextRef CRef = q.get_sycl_context().get_context_ref()
-    cdef DPCTLSyclDeviceRef DRef = q.get_sycl_device().get_device_ref()
-    KBref = DPCTLKernelBundle_CreateFromOCLSource(CRef, DRef, Src, COpts)
-
-    if KBref is NULL:
-        raise SyclProgramCompilationError()
-
-    return SyclProgram._create(KBref)
+    return _build_from_source(
+        q.get_sycl_context(),
+        q.get_sycl_device(),
+        src.encode('utf8'),
+        copts.encode('utf8'),
+    )
 
 
 cpdef create_program_from_spirv(SyclQueue q, const unsigned char[:] IL,
@@ -297,22 +296,183 @@ cpdef create_program_from_spirv(SyclQueue q, const unsigned char[:] IL,
             created.
     """
 
+    return _build_from_spirv(
+        q.get_sycl_context(),
+        q.get_sycl_device(),
+        IL,
+        copts.encode('utf8'),
+    )
+
+
+def _build_from_source(
+    SyclContext ctx, SyclDevice dev, bytes bSrc, bytes bCOpts
+):
+    """Builds OpenCL source for the device, releasing the GIL during the
+    build"""
+    cdef DPCTLSyclKernelBundleRef KBref
+    cdef const char *Src = <const char*>bSrc
+    cdef const char *COpts = <const char*>bCOpts
+    cdef DPCTLSyclContextRef CRef = ctx.get_context_ref()
+    cdef DPCTLSyclDeviceRef DRef = dev.get_device_ref()
+    with nogil:
+        KBref = DPCTLKernelBundle_CreateFromOCLSource(CRef, DRef, Src, COpts)
+
+    if KBref is NULL:
+        raise SyclProgramCompilationError()
+
+    return SyclProgram._create(KBref)
+
+
+def _build_from_spirv(
+    SyclContext ctx, SyclDevice dev, const unsigned char[:] IL, bytes bCOpts
+):
+    """Builds SPIR-V binary for the device, releasing the GIL during the
+    build"""
     cdef DPCTLSyclKernelBundleRef KBref
     cdef const unsigned char *dIL = &IL[0]
-    cdef DPCTLSyclContextRef CRef = q.get_sycl_context().get_context_ref()
-    cdef DPCTLSyclDeviceRef DRef = q.get_sycl_device().get_device_ref()
     cdef size_t length = IL.shape[0]
-    cdef bytes bCOpts = copts.encode('utf8')
     cdef const char *COpts = <const char*>bCOpts
-    KBref = DPCTLKernelBundle_CreateFromSpirv(
-        CRef, DRef, <const void*>dIL, length, COpts
-    )
+    cdef DPCTLSyclContextRef CRef = ctx.get_context_ref()
+    cdef DPCTLSyclDeviceRef DRef = dev.get_device_ref()
+    with nogil:
+        KBref = DPCTLKernelBundle_CreateFromSpirv(
+            CRef, DRef, <const void*>dIL, length, COpts
+        )
+
     if KBref is NULL:
         raise SyclProgramCompilationError()
 
     return SyclProgram._create(KBref)
 
 
+cdef object _build_executor = None
+cdef object _build_executor_lock = threading.Lock()
+
+
+cdef object _get_build_executor():
+    """Returns the thread pool shared by asynchronous program builds"""
+    global _build_executor
+    with _build_executor_lock:
+        if _build_executor is None:
+            _build_executor = concurrent.futures.ThreadPoolExecutor(
+                max_workers=(os.cpu_count() or 1),
+                thread_name_prefix="dpctl_program_build",
+            )
+        return _build_executor
+
+
+def _gather_futures(list futures):
+    """Returns future which is resolved with the list of results of
+    ``futures``, or with the first exception raised by any of them, once all
+    of them are done"""
+    res = concurrent.futures.Future()
+    remaining = [len(futures)]
+    lock = threading.Lock()
+
+    def _on_done(_):
+        with lock:
+            remaining[0] -= 1
+            if remaining[0] > 0:
+                return
+        for f in futures:
+            if f.exception() is not None:
+                res.set_exception(f.exception())
+                return
+        res.set_result([f.result() for f in futures])
+
+    if not futures:
+        res.set_result([])
+    for f in futures:
+        f.add_done_callback(_on_done)
+    return res
+
+
+cdef object _submit_builds(build_fn, target, tuple args):
+    executor = _get_build_executor()
+    if isinstance(target, SyclQueue):
+        return executor.submit(
+            build_fn,
+            (<SyclQueue>target).get_sycl_context(),
+            (<SyclQueue>target).get_sycl_device(),
+            *args
+        )
+    elif isinstance(target, SyclContext):
+        return _gather_futures(
+            [
+                executor.submit(build_fn, target, dev, *args)
+                for dev in (<SyclContext>target).get_devices()
+            ]
+        )
+    raise TypeError(
+        "Expected dpctl.SyclQueue or dpctl.SyclContext, "
+        f"got {type(target)}"
+    )
+
+
+def create_program_from_source_async(target, unicode src, unicode copts=""):
+    """
+        Builds a Sycl interoperability program from an OpenCL source string
+        on a thread pool, without blocking the calling thread.
+
+        The GIL is released while the program is built, so that builds
+        submitted from one or more Python threads proceed concurrently.
+
+        Parameters:
+            target (SyclQueue, SyclContext): If a :class:`SyclQueue`, the
+                program is built for its device. If a :class:`SyclContext`,
+                the program is built for each device of the context, in
+                parallel.
+            src (unicode): Source string for an OpenCL program.
+            copts (unicode) : Optional compilation flags that will be used
+                              when compiling the program.
+
+        Returns:
+            future (concurrent.futures.Future): Future resolved with the
+            :class:`SyclProgram` built for the device of the queue, or with
+            the list of :class:`SyclProgram` objects built for devices of
+            the context, in the order of ``SyclContext.get_devices()``.
+            :class:`SyclProgramCompilationError` is raised by the
+            ``result()`` method of the future if any build fails.
+    """
+    return _submit_builds(
+        _build_from_source, target, (src.encode('utf8'), copts.encode('utf8'))
+    )
+
+
+def create_program_from_spirv_async(
+    target, const unsigned char[:] IL, unicode copts=""
+):
+    """
+        Builds a Sycl interoperability program from an SPIR-V binary on a
+        thread pool, without blocking the calling thread.
+
+        The GIL is released while the program is built, so that builds
+        submitted from one or more Python threads proceed concurrently.
+
+        Parameters:
+            target (SyclQueue, SyclContext): If a :class:`SyclQueue`, the
+                program is built for its device. If a :class:`SyclContext`,
+                the program is built for each device of the context, in
+                parallel.
+            IL (const char[:]) : SPIR-V binary IL file for an OpenCL program.
+                The binary is copied, and may be modified once the function
+                returns.
+            copts (unicode) : Optional compilation flags that will be used
+                              when compiling the program.
+
+        Returns:
+            future (concurrent.futures.Future): Future resolved with the
+            :class:`SyclProgram` built for the device of the queue, or with
+            the list of :class:`SyclProgram` objects built for devices of
+            the context, in the order of ``SyclContext.get_devices()``.
+            :class:`SyclProgramCompilationError` is raised by the
+            ``result()`` method of the future if any build fails.
+    """
+    return _submit_builds(
+        _build_from_spirv, target, (bytes(IL), copts.encode('utf8'))
+    )
+
+
 cdef api DPCTLSyclKernelBundleRef SyclProgram_GetKernelBundleRef(SyclProgram pro):
     """ C-API function to access opaque kernel bundle reference from
     Python object of type :class:`dpctl.program.SyclKernel`.
@@ -60,6 +60,12 @@ from dpctl.tensor._data_types import (
 from dpctl.tensor._device import Device
 from dpctl.tensor._dlpack import from_dlpack
 from dpctl.tensor._indexing_functions import extract, nonzero, place, put, take
+from dpctl.tensor._linear_algebra_functions import (
+    matmul,
+    matrix_transpose,
+    tensordot,
+    vecdot,
+)
 from dpctl.tensor._manipulation_functions import (
     broadcast_arrays,
     broadcast_to,
@@ -86,6 +92,7 @@ from dpctl.tensor._print import (
     usm_ndarray_str,
 )
 from dpctl.tensor._reshape import reshape
+from dpctl.tensor._sharding import create_shard_queues, sharding
 from dpctl.tensor._search_functions import where
 from dpctl.tensor._usmarray import usm_ndarray
 from dpctl.tensor._utility_functions import all, any
@@ -243,4 +250,10 @@ __all__ = [
     "not_equal",
     "sum",
     "floor_divide",
+    "matmul",
+    "matrix_transpose",
+    "tensordot",
+    "vecdot",
+    "create_shard_queues",
+    "sharding",
 ]
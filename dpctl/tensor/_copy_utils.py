@@ -23,8 +23,9 @@ import dpctl.memory as dpm
 import dpctl.tensor as dpt
 import dpctl.tensor._tensor_impl as ti
 import dpctl.utils
-from dpctl.tensor._ctors import _get_dtype
+from dpctl.tensor._ctors import _get_dtype, _to_scalar
 from dpctl.tensor._device import normalize_queue_device
+from dpctl.tensor._sharding import _shard_queues, _shard_view, _submit_sharded
 
 __doc__ = (
     "Implementation module for copy- and cast- operations on "
@@ -104,6 +105,45 @@ def _copy_from_numpy_into(dst, np_ary):
     )
 
 
+def _fill_with_python_scalar(dst, val):
+    """Fills `dst` with Python scalar `val`, passing the value to the
+    fill kernel as an argument, without staging it in host memory.
+
+    Returns `False`, leaving `dst` unmodified, if conversion of `val`
+    to the data type of `dst` should instead follow NumPy casting rules.
+    """
+    if not isinstance(dst, dpt.usm_ndarray):
+        raise TypeError(f"Expected usm_ndarray, got {type(dst)}")
+    kind = dst.dtype.kind
+    if kind == "b":
+        fill_v = bool(val)
+    elif kind in "iu":
+        if not isinstance(val, int) or not (-(2**63) <= val < 2**64):
+            return False
+        fill_v = _to_scalar(val, dst.dtype)
+    elif kind == "f":
+        if isinstance(val, complex) or (
+            isinstance(val, int) and not (-(2**63) <= val < 2**64)
+        ):
+            return False
+        fill_v = float(val)
+    elif kind == "c":
+        if isinstance(val, int) and not (-(2**63) <= val < 2**64):
+            return False
+        fill_v = complex(val)
+    else:
+        return False
+    exec_q = dst.sycl_queue
+    _, fill_ev = ti._full_usm_ndarray(
+        fill_value=fill_v, dst=dst, sycl_queue=exec_q
+    )
+    # operations submitted later to an in-order queue are executed
+    # after the fill, so waiting is only needed for out-of-order queues
+    if not exec_q.is_in_order:
+        fill_ev.wait()
+    return True
+
+
 def from_numpy(np_ary, device=None, usm_type="device", sycl_queue=None):
     """
     from_numpy(arg, device=None, usm_type="device", sycl_queue=None)
@@ -221,6 +261,19 @@ def _copy_same_shape(dst, src):
         _copy_overlapping(src=src, dst=dst)
         return
 
+    shard_qs = _shard_queues(dst.sycl_queue, dst.shape)
+    if shard_qs is not None and src.sycl_context == dst.sycl_context:
+        _submit_sharded(
+            shard_qs,
+            dst.shape[0],
+            lambda q, s: ti._copy_usm_ndarray_into_usm_ndarray(
+                src=_shard_view(src, q, s),
+                dst=_shard_view(dst, q, s),
+                sycl_queue=q,
+            ),
+        )
+        return
+
     hev, _ = ti._copy_usm_ndarray_into_usm_ndarray(
         src=src, dst=dst, sycl_queue=dst.sycl_queue
     )
@@ -694,9 +694,10 @@ def empty(
     device=None,
     usm_type="device",
     sycl_queue=None,
+    placement=None,
 ):
     """ empty(shape, dtype=None, order="C", device=None, \
-            usm_type="device", sycl_queue=None)
+            usm_type="device", sycl_queue=None, placement=None)
 
     Creates :class:`dpctl.tensor.usm_ndarray` from uninitialized
     USM allocation.
@@ -723,6 +724,11 @@ def empty(
             underlying SYCL queue to be used. If both are `None`, a cached
             queue targeting default-selected device is used for allocation
             and copying. Default: `None`.
+        placement (optional): devices whose NUMA nodes memory pages of
+            the allocation are placed on, by initializing the memory with
+            zeros, as described for :class:`dpctl.memory.MemoryUSMShared`.
+            Only supported for `"shared"` and `"host"` values of
+            `usm_type`. Default: `None`.
 
     Returns:
         usm_ndarray:
@@ -742,7 +748,7 @@ def empty(
         dtype=dtype,
         buffer=usm_type,
         order=order,
-        buffer_ctor_kwargs={"queue": sycl_queue},
+        buffer_ctor_kwargs={"queue": sycl_queue, "placement": placement},
     )
     return res
 
@@ -901,9 +907,10 @@ def zeros(
     device=None,
     usm_type="device",
     sycl_queue=None,
+    placement=None,
 ):
     """ zeros(shape, dtype=None, order="C", device=None, \
-              usm_type="device", sycl_queue=None)
+              usm_type="device", sycl_queue=None, placement=None)
 
     Returns a new :class:`dpctl.tensor.usm_ndarray` having a specified
     shape and filled with zeros.
@@ -929,6 +936,19 @@ def zeros(
             underlying SYCL queue to be used. If both are `None`, a cached
             queue targeting default-selected device is used for allocation
             and copying. Default: `None`.
+        placement (optional): devices whose NUMA nodes memory pages of
+            the allocation are placed on. If `None`, the allocation is
+            zeroed by a memset submitted to the allocation queue. Otherwise,
+            for `"shared"` and `"host"` values of `usm_type`, zeros are
+            written by kernels of the given devices instead, so that the
+            first touch policy of the operating system places the pages on
+            their NUMA nodes. Supported values are `"first_touch"`, a
+            :class:`dpctl.SyclQueue` or :class:`dpctl.SyclDevice`, or a
+            list of them, as described for
+            :class:`dpctl.memory.MemoryUSMShared`. `ValueError` is raised
+            for `"device"` value of `usm_type`, since pages of USM-device
+            allocations are not placed by the operating system.
+            Default: `None`.
 
     Returns:
         usm_ndarray:
@@ -948,9 +968,11 @@ def zeros(
         dtype=dtype,
         buffer=usm_type,
         order=order,
-        buffer_ctor_kwargs={"queue": sycl_queue},
+        buffer_ctor_kwargs={"queue": sycl_queue, "placement": placement},
     )
-    res.usm_data.memset()
+    if placement is None:
+        # placement initializes the memory with zeros
+        res.usm_data.memset()
     return res
 
 
@@ -25,12 +25,16 @@ cdef extern from 'dlpack/dlpack.h' nogil:
     int device_CPU 'kDLCPU'
     int device_oneAPI 'kDLOneAPI'
     int device_OpenCL 'kDLOpenCL'
+    int dlpack_major_version 'DLPACK_MAJOR_VERSION'
 
 
-cpdef object to_dlpack_capsule(usm_ndarray array) except +
-cpdef usm_ndarray from_dlpack_capsule(object dltensor) except +
+cpdef object to_dlpack_capsule(usm_ndarray array, bint to_kdlcpu=*) except +
+cpdef object to_dlpack_versioned_capsule(
+    usm_ndarray array, bint copied, bint to_kdlcpu=*
+) except +
+cpdef usm_ndarray from_dlpack_capsule(object dltensor, object device=*) except +
 
-cpdef from_dlpack(array)
+cpdef from_dlpack(array, device=*)
 
 cdef class DLPackCreationError(Exception):
     """
@@ -19,8 +19,15 @@
 # cython: linetrace=True
 
 cimport cpython
-from libc cimport stdlib
-from libc.stdint cimport int32_t, int64_t, uint8_t, uint16_t, uint64_t
+from libc cimport stdlib, string
+from libc.stdint cimport (
+    int32_t,
+    int64_t,
+    uint8_t,
+    uint16_t,
+    uint32_t,
+    uint64_t,
+)
 
 cimport dpctl as c_dpctl
 cimport dpctl.memory as c_dpmem
@@ -32,7 +39,7 @@ from .._backend cimport (
     DPCTLSyclDeviceRef,
     DPCTLSyclUSMRef,
 )
-from ._usmarray cimport usm_ndarray
+from ._usmarray cimport USM_ARRAY_WRITABLE, usm_ndarray
 
 from platform import system as sys_platform
 
@@ -47,7 +54,17 @@ cdef bint _IS_LINUX = sys_platform() == "Linux"
 del sys_platform
 
 cdef extern from 'dlpack/dlpack.h' nogil:
-    cdef int DLPACK_VERSION
+    cdef int DLPACK_MAJOR_VERSION
+
+    cdef int DLPACK_MINOR_VERSION
+
+    cdef int DLPACK_FLAG_BITMASK_READ_ONLY
+
+    cdef int DLPACK_FLAG_BITMASK_IS_COPIED
+
+    ctypedef struct DLPackVersion:
+        uint32_t major
+        uint32_t minor
 
     cdef enum DLDeviceType:
         kDLCPU
@@ -93,17 +110,24 @@ cdef extern from 'dlpack/dlpack.h' nogil:
         void *manager_ctx
         void (*deleter)(DLManagedTensor *)  # noqa: E211
 
+    ctypedef struct DLManagedTensorVersioned:
+        DLPackVersion version
+        void *manager_ctx
+        void (*deleter)(DLManagedTensorVersioned *)  # noqa: E211
+        uint64_t flags
+        DLTensor dl_tensor
+
 
 def get_build_dlpack_version():
     """
-    Returns the string value of DLPACK_VERSION from dlpack.h
-    :module:`dpctl.tensor` was built with.
+    Returns the string value of DLPack version ``"major.minor"``
+    from dlpack.h :module:`dpctl.tensor` was built with.
 
     Returns:
         A string value of the version of DLPack used to build
         `dpctl`.
     """
-    return str(DLPACK_VERSION)
+    return f"{DLPACK_MAJOR_VERSION}.{DLPACK_MINOR_VERSION}"
 
 
 cdef void _pycapsule_deleter(object dlt_capsule):
@@ -122,47 +146,36 @@ cdef void _managed_tensor_deleter(DLManagedTensor *dlm_tensor) with gil:
         stdlib.free(dlm_tensor)
 
 
-cpdef to_dlpack_capsule(usm_ndarray usm_ary) except+:
-    """
-    to_dlpack_capsule(usm_ary)
+cdef void _pycapsule_versioned_deleter(object dlt_capsule):
+    cdef DLManagedTensorVersioned *dlmv_tensor = NULL
+    if cpython.PyCapsule_IsValid(dlt_capsule, 'dltensor_versioned'):
+        dlmv_tensor = <DLManagedTensorVersioned*>cpython.PyCapsule_GetPointer(
+            dlt_capsule, 'dltensor_versioned')
+        dlmv_tensor.deleter(dlmv_tensor)
 
-    Constructs named Python capsule object referencing
-    instance of `DLManagerTensor` from
-    :class:`dpctl.tensor.usm_ndarray` instance.
 
-    Args:
-        usm_ary: An instance of :class:`dpctl.tensor.usm_ndarray`
-    Returns:
-        Python a new capsule with name "dltensor" that contains
-        a pointer to `DLManagedTensor` struct.
-    Raises:
-        DLPackCreationError: when array can be represented as
-            DLPack tensor. This may happen when array was allocated
-            on a partitioned sycl device, or its USM allocation is
-            not bound to the platform default SYCL context.
-        MemoryError: when host allocation to needed for `DLManagedTensor`
-            did not succeed.
-        ValueError: when array elements data type could not be represented
-            in `DLManagedTensor`.
+cdef void _managed_tensor_versioned_deleter(
+    DLManagedTensorVersioned *dlmv_tensor
+) with gil:
+    if dlmv_tensor is not NULL:
+        stdlib.free(dlmv_tensor.dl_tensor.shape)
+        cpython.Py_DECREF(<usm_ndarray>dlmv_tensor.manager_ctx)
+        dlmv_tensor.manager_ctx = NULL
+        stdlib.free(dlmv_tensor)
+
+
+cdef int _get_dlpack_device_id(usm_ndarray usm_ary) except -1:
+    """
+    Returns ordinal number of the non-partitioned device the USM
+    allocation of the array is bound to, to be used as `device_id` of
+    `kDLOneAPI` device.
     """
     cdef c_dpctl.SyclQueue ary_sycl_queue
     cdef c_dpctl.SyclDevice ary_sycl_device
     cdef DPCTLSyclDeviceRef pDRef = NULL
     cdef DPCTLSyclDeviceRef tDRef = NULL
-    cdef DLManagedTensor *dlm_tensor = NULL
-    cdef DLTensor *dl_tensor = NULL
-    cdef int nd = usm_ary.get_ndim()
-    cdef char *data_ptr = usm_ary.get_data()
-    cdef Py_ssize_t *shape_ptr = NULL
-    cdef Py_ssize_t *strides_ptr = NULL
-    cdef int64_t *shape_strides_ptr = NULL
-    cdef int i = 0
     cdef int device_id = -1
-    cdef char *base_ptr = NULL
-    cdef Py_ssize_t element_offset = 0
-    cdef Py_ssize_t byte_offset = 0
 
-    ary_base = usm_ary.get_base()
     ary_sycl_queue = usm_ary.get_sycl_queue()
     ary_sycl_device = ary_sycl_queue.get_sycl_device()
 
@@ -206,19 +219,50 @@ cpdef to_dlpack_capsule(usm_ndarray usm_ary) except+:
         raise DLPackCreationError(
             "to_dlpack_capsule: failed to determine device_id"
         )
+    return device_id
+
+
+cdef int _fill_dl_tensor(
+    DLTensor *dl_tensor, usm_ndarray usm_ary, int64_t *shape_strides_ptr,
+    bint to_kdlcpu
+) except -1:
+    """
+    Populates `dl_tensor` describing the array, using `shape_strides_ptr`
+    with space for `2 * nd` elements to store shape and strides.
+    """
+    cdef int nd = usm_ary.get_ndim()
+    cdef char *data_ptr = usm_ary.get_data()
+    cdef Py_ssize_t *shape_ptr = NULL
+    cdef Py_ssize_t *strides_ptr = NULL
+    cdef int i = 0
+    cdef int device_id = 0
+    cdef Py_ssize_t element_offset = 0
+    cdef Py_ssize_t byte_offset = 0
+
+    ary_dt = usm_ary.dtype
+    ary_dtk = ary_dt.kind
+    if (ary_dtk == "b"):
+        dl_tensor.dtype.code = <uint8_t>kDLBool
+    elif (ary_dtk == "u"):
+        dl_tensor.dtype.code = <uint8_t>kDLUInt
+    elif (ary_dtk == "i"):
+        dl_tensor.dtype.code = <uint8_t>kDLInt
+    elif (ary_dtk == "f"):
+        dl_tensor.dtype.code = <uint8_t>kDLFloat
+    elif (ary_dtk == "c"):
+        dl_tensor.dtype.code = <uint8_t>kDLComplex
+    else:
+        raise ValueError("Unrecognized array data type")
+    dl_tensor.dtype.lanes = <uint16_t>1
+    dl_tensor.dtype.bits = <uint8_t>(ary_dt.itemsize * 8)
+
+    if to_kdlcpu:
+        dl_tensor.device.device_type = kDLCPU
+    else:
+        device_id = _get_dlpack_device_id(usm_ary)
+        dl_tensor.device.device_type = kDLOneAPI
+    dl_tensor.device.device_id = device_id
 
-    dlm_tensor = <DLManagedTensor *> stdlib.malloc(
-        sizeof(DLManagedTensor))
-    if dlm_tensor is NULL:
-        raise MemoryError(
-            "to_dlpack_capsule: Could not allocate memory for DLManagedTensor"
-        )
-    shape_strides_ptr = <int64_t *>stdlib.malloc((sizeof(int64_t) * 2) * nd)
-    if shape_strides_ptr is NULL:
-        stdlib.free(dlm_tensor)
-        raise MemoryError(
-            "to_dlpack_capsule: Could not allocate memory for shape/strides"
-        )
     shape_ptr = usm_ary.get_shape()
     for i in range(nd):
         shape_strides_ptr[i] = shape_ptr[i]
@@ -227,12 +271,9 @@ cpdef to_dlpack_capsule(usm_ndarray usm_ary) except+:
         for i in range(nd):
             shape_strides_ptr[nd + i] = strides_ptr[i]
 
-    ary_dt = usm_ary.dtype
-    ary_dtk = ary_dt.kind
     element_offset = usm_ary.get_offset()
     byte_offset = element_offset * (<Py_ssize_t>ary_dt.itemsize)
 
-    dl_tensor = &dlm_tensor.dl_tensor
     dl_tensor.data = <void*>(data_ptr - byte_offset)
     dl_tensor.ndim = nd
     dl_tensor.byte_offset = <uint64_t>byte_offset
@@ -241,24 +282,59 @@ cpdef to_dlpack_capsule(usm_ndarray usm_ary) except+:
         dl_tensor.strides = NULL
     else:
         dl_tensor.strides = &shape_strides_ptr[nd]
-    dl_tensor.device.device_type = kDLOneAPI
-    dl_tensor.device.device_id = device_id
-    dl_tensor.dtype.lanes = <uint16_t>1
-    dl_tensor.dtype.bits = <uint8_t>(ary_dt.itemsize * 8)
-    if (ary_dtk == "b"):
-        dl_tensor.dtype.code = <uint8_t>kDLBool
-    elif (ary_dtk == "u"):
-        dl_tensor.dtype.code = <uint8_t>kDLUInt
-    elif (ary_dtk == "i"):
-        dl_tensor.dtype.code = <uint8_t>kDLInt
-    elif (ary_dtk == "f"):
-        dl_tensor.dtype.code = <uint8_t>kDLFloat
-    elif (ary_dtk == "c"):
-        dl_tensor.dtype.code = <uint8_t>kDLComplex
-    else:
+    return 0
+
+
+cpdef to_dlpack_capsule(usm_ndarray usm_ary, bint to_kdlcpu=False) except+:
+    """
+    to_dlpack_capsule(usm_ary, to_kdlcpu=False)
+
+    Constructs named Python capsule object referencing
+    instance of `DLManagerTensor` from
+    :class:`dpctl.tensor.usm_ndarray` instance.
+
+    Args:
+        usm_ary: An instance of :class:`dpctl.tensor.usm_ndarray`
+        to_kdlcpu: If `True`, the tensor is described as residing in
+            host memory, `kDLCPU` device. The array must be allocated
+            in host-accessible USM memory.
+    Returns:
+        Python a new capsule with name "dltensor" that contains
+        a pointer to `DLManagedTensor` struct.
+    Raises:
+        DLPackCreationError: when array can be represented as
+            DLPack tensor. This may happen when array was allocated
+            on a partitioned sycl device, or its USM allocation is
+            not bound to the platform default SYCL context.
+        MemoryError: when host allocation to needed for `DLManagedTensor`
+            did not succeed.
+        ValueError: when array elements data type could not be represented
+            in `DLManagedTensor`.
+    """
+    cdef DLManagedTensor *dlm_tensor = NULL
+    cdef int64_t *shape_strides_ptr = NULL
+    cdef int nd = usm_ary.get_ndim()
+
+    dlm_tensor = <DLManagedTensor *> stdlib.malloc(
+        sizeof(DLManagedTensor))
+    if dlm_tensor is NULL:
+        raise MemoryError(
+            "to_dlpack_capsule: Could not allocate memory for DLManagedTensor"
+        )
+    shape_strides_ptr = <int64_t *>stdlib.malloc((sizeof(int64_t) * 2) * nd)
+    if shape_strides_ptr is NULL:
+        stdlib.free(dlm_tensor)
+        raise MemoryError(
+            "to_dlpack_capsule: Could not allocate memory for shape/strides"
+        )
+    try:
+        _fill_dl_tensor(
+            &dlm_tensor.dl_tensor, usm_ary, shape_strides_ptr, to_kdlcpu
+        )
+    except Exception:
         stdlib.free(shape_strides_ptr)
         stdlib.free(dlm_tensor)
-        raise ValueError("Unrecognized array data type")
+        raise
 
     dlm_tensor.manager_ctx = <void*>usm_ary
     cpython.Py_INCREF(usm_ary)
@@ -267,6 +343,82 @@ cpdef to_dlpack_capsule(usm_ndarray usm_ary) except+:
     return cpython.PyCapsule_New(dlm_tensor, 'dltensor', _pycapsule_deleter)
 
 
+cpdef to_dlpack_versioned_capsule(
+    usm_ndarray usm_ary, bint copied, bint to_kdlcpu=False
+) except+:
+    """
+    to_dlpack_versioned_capsule(usm_ary, copied, to_kdlcpu=False)
+
+    Constructs named Python capsule object referencing
+    instance of `DLManagedTensorVersioned` from
+    :class:`dpctl.tensor.usm_ndarray` instance.
+
+    Args:
+        usm_ary: An instance of :class:`dpctl.tensor.usm_ndarray`
+        copied: Whether the array is a copy made for the consumer, which
+            is recorded in the flags of the tensor.
+        to_kdlcpu: If `True`, the tensor is described as residing in
+            host memory, `kDLCPU` device. The array must be allocated
+            in host-accessible USM memory.
+    Returns:
+        Python a new capsule with name "dltensor_versioned" that
+        contains a pointer to `DLManagedTensorVersioned` struct. Read-only
+        arrays are exported with read-only flag set.
+    Raises:
+        DLPackCreationError: when array can be represented as
+            DLPack tensor. This may happen when array was allocated
+            on a partitioned sycl device, or its USM allocation is
+            not bound to the platform default SYCL context.
+        MemoryError: when host allocation to needed for
+            `DLManagedTensorVersioned` did not succeed.
+        ValueError: when array elements data type could not be represented
+            in `DLManagedTensorVersioned`.
+    """
+    cdef DLManagedTensorVersioned *dlmv_tensor = NULL
+    cdef int64_t *shape_strides_ptr = NULL
+    cdef int nd = usm_ary.get_ndim()
+    cdef uint64_t flags = 0
+
+    dlmv_tensor = <DLManagedTensorVersioned *> stdlib.malloc(
+        sizeof(DLManagedTensorVersioned))
+    if dlmv_tensor is NULL:
+        raise MemoryError(
+            "to_dlpack_versioned_capsule: Could not allocate memory "
+            "for DLManagedTensorVersioned"
+        )
+    shape_strides_ptr = <int64_t *>stdlib.malloc((sizeof(int64_t) * 2) * nd)
+    if shape_strides_ptr is NULL:
+        stdlib.free(dlmv_tensor)
+        raise MemoryError(
+            "to_dlpack_versioned_capsule: Could not allocate memory "
+            "for shape/strides"
+        )
+    try:
+        _fill_dl_tensor(
+            &dlmv_tensor.dl_tensor, usm_ary, shape_strides_ptr, to_kdlcpu
+        )
+    except Exception:
+        stdlib.free(shape_strides_ptr)
+        stdlib.free(dlmv_tensor)
+        raise
+
+    if not (usm_ary.get_flags() & USM_ARRAY_WRITABLE):
+        flags |= DLPACK_FLAG_BITMASK_READ_ONLY
+    if copied:
+        flags |= DLPACK_FLAG_BITMASK_IS_COPIED
+
+    dlmv_tensor.version.major = DLPACK_MAJOR_VERSION
+    dlmv_tensor.version.minor = DLPACK_MINOR_VERSION
+    dlmv_tensor.flags = flags
+    dlmv_tensor.manager_ctx = <void*>usm_ary
+    cpython.Py_INCREF(usm_ary)
+    dlmv_tensor.deleter = _managed_tensor_versioned_deleter
+
+    return cpython.PyCapsule_New(
+        dlmv_tensor, 'dltensor_versioned', _pycapsule_versioned_deleter
+    )
+
+
 cdef class _DLManagedTensorOwner:
     """
     Helper class managing the lifetime of the DLManagedTensor struct
@@ -288,29 +440,120 @@ cdef class _DLManagedTensorOwner:
         return res
 
 
-cpdef usm_ndarray from_dlpack_capsule(object py_caps) except +:
+cdef class _DLManagedTensorVersionedOwner:
+    """
+    Helper class managing the lifetime of the DLManagedTensorVersioned
+    struct transferred from a 'dlpack_versioned' capsule.
+    """
+    cdef DLManagedTensorVersioned *dlmv_tensor
+
+    def __cinit__(self):
+        self.dlmv_tensor = NULL
+
+    def __dealloc__(self):
+        if self.dlmv_tensor:
+            self.dlmv_tensor.deleter(self.dlmv_tensor)
+
+    @staticmethod
+    cdef _DLManagedTensorVersionedOwner _create(
+        DLManagedTensorVersioned *dlmv_tensor_src
+    ):
+        cdef _DLManagedTensorVersionedOwner res = (
+            _DLManagedTensorVersionedOwner.__new__(
+                _DLManagedTensorVersionedOwner
+            )
+        )
+        res.dlmv_tensor = dlmv_tensor_src
+        return res
+
+
+cdef object _host_import_queue(object device):
+    """
+    Returns queue for the CPU device DLPack tensors residing in host
+    memory are imported onto, the device selected by
+    :func:`dpctl.select_cpu_device` if `device` is None.
+    """
+    if device is None:
+        try:
+            device = dpctl.select_cpu_device()
+        except dpctl.SyclDeviceCreationError as e:
+            raise BufferError(
+                "DLPack tensor residing in host memory can only be "
+                "imported onto a CPU device, but none is available"
+            ) from e
+    elif isinstance(device, dpctl.SyclQueue):
+        device = device.sycl_device
+    elif not isinstance(device, dpctl.SyclDevice):
+        device = dpctl.SyclDevice(device)
+    if not device.has_aspect_cpu:
+        raise BufferError(
+            "DLPack tensor residing in host memory can only be "
+            f"imported onto a CPU device, got {device.name}"
+        )
+    return get_device_cached_queue(device)
+
+
+cdef object _wrap_dlpack_data(
+    char *mem_ptr, size_t nbytes, c_dpctl.SyclQueue q, object owner,
+    bint host_data
+):
+    if host_data:
+        return c_dpmem._Memory.create_from_host_pointer_size_qref(
+            <DPCTLSyclUSMRef> mem_ptr, nbytes, q.get_queue_ref(), owner
+        )
+    return c_dpmem._Memory.create_from_usm_pointer_size_qref(
+        <DPCTLSyclUSMRef> mem_ptr, nbytes, q.get_queue_ref(),
+        memory_owner=owner
+    )
+
+
+cpdef usm_ndarray from_dlpack_capsule(
+    object py_caps, object device=None
+) except +:
     """
-    from_dlpack_capsule(caps)
+    from_dlpack_capsule(caps, device=None)
 
     Reconstructs instance of :class:`dpctl.tensor.usm_ndarray` from
     named Python capsule object referencing instance of `DLManagedTensor`
-    without copy. The instance forms a view in the memory of the tensor.
+    or `DLManagedTensorVersioned` without copy. The instance forms a view
+    in the memory of the tensor, which is read-only if the read-only flag
+    of a versioned tensor is set.
+
+    Tensors residing in host memory (`kDLCPU`) are imported onto a CPU
+    SYCL device. If the device can access memory not allocated by SYCL
+    runtime, as indicated by its `usm_system_allocations` aspect, the
+    array is a zero-copy view of the tensor, otherwise the data are copied
+    into a USM-host allocation and the tensor is released.
 
     Args:
         caps: Python capsule with name "dltensor" expected to reference
-            an instance of `DLManagedTensor` struct.
+            an instance of `DLManagedTensor` struct, or with name
+            "dltensor_versioned" expected to reference an instance of
+            `DLManagedTensorVersioned` struct.
+        device: CPU device, given as :class:`dpctl.SyclDevice`,
+            :class:`dpctl.SyclQueue` or a filter selector string, to import
+            a host tensor onto. Default device selected by
+            :func:`dpctl.select_cpu_device` is used if `None`. Ignored
+            for tensors residing on oneAPI devices.
     Returns:
         Instance of :class:`dpctl.tensor.usm_ndarray` with a view into
-        memory of the tensor. Capsule is renamed to "used_dltensor" upon
-        success.
+        memory of the tensor. Capsule is renamed to "used_dltensor", or
+        "used_dltensor_versioned", upon success.
     Raises:
-        TypeError: if argument is not a "dltensor" capsule.
-        ValueError: if argument is "used_dltensor" capsule
+        TypeError: if argument is not a "dltensor" or "dltensor_versioned"
+            capsule.
+        ValueError: if argument is "used_dltensor" or
+            "used_dltensor_versioned" capsule
         BufferError:  if the USM pointer is not bound to the reconstructed
-             sycl context, or the DLPack's device_type is not supported
-             by dpctl.
+             sycl context, the DLPack's device_type is not supported
+             by dpctl, or the major version of the versioned tensor is
+             newer than the one supported.
     """
     cdef DLManagedTensor *dlm_tensor = NULL
+    cdef DLManagedTensorVersioned *dlmv_tensor = NULL
+    cdef DLTensor *dl_tensor = NULL
+    cdef bint versioned = False
+    cdef bint read_only = False
     cdef bytes usm_type
     cdef size_t sz = 1
     cdef size_t alloc_sz = 1
@@ -324,22 +567,38 @@ cpdef usm_ndarray from_dlpack_capsule(object py_caps) except +:
     cdef Py_ssize_t element_offset = 0
     cdef int64_t stride_i = -1
     cdef int64_t shape_i = -1
+    cdef bint host_data = False
+    cdef bint zero_copy = True
 
-    if not cpython.PyCapsule_IsValid(py_caps, 'dltensor'):
-        if cpython.PyCapsule_IsValid(py_caps, 'used_dltensor'):
-            raise ValueError(
-                "A DLPack tensor object can not be consumed multiple times"
-            )
-        else:
-            raise TypeError(
-                f"A Python 'dltensor' capsule was expected, "
-                "got {type(dlm_tensor)}"
+    if cpython.PyCapsule_IsValid(py_caps, 'dltensor'):
+        dlm_tensor = <DLManagedTensor*>cpython.PyCapsule_GetPointer(
+                py_caps, "dltensor")
+        dl_tensor = &dlm_tensor.dl_tensor
+    elif cpython.PyCapsule_IsValid(py_caps, 'dltensor_versioned'):
+        dlmv_tensor = <DLManagedTensorVersioned*>cpython.PyCapsule_GetPointer(
+                py_caps, "dltensor_versioned")
+        if dlmv_tensor.version.major > DLPACK_MAJOR_VERSION:
+            raise BufferError(
+                "Can not import DLPack tensor with major version "
+                f"{<int>dlmv_tensor.version.major}, greater than "
+                f"{DLPACK_MAJOR_VERSION}"
             )
-    dlm_tensor = <DLManagedTensor*>cpython.PyCapsule_GetPointer(
-            py_caps, "dltensor")
+        versioned = True
+        read_only = (dlmv_tensor.flags & DLPACK_FLAG_BITMASK_READ_ONLY) != 0
+        dl_tensor = &dlmv_tensor.dl_tensor
+    elif (cpython.PyCapsule_IsValid(py_caps, 'used_dltensor') or
+          cpython.PyCapsule_IsValid(py_caps, 'used_dltensor_versioned')):
+        raise ValueError(
+            "A DLPack tensor object can not be consumed multiple times"
+        )
+    else:
+        raise TypeError(
+            f"A Python 'dltensor' capsule was expected, "
+            f"got {type(py_caps)}"
+        )
     # Verify that we can work with this device
-    if dlm_tensor.dl_tensor.device.device_type == kDLOneAPI:
-        device_id = dlm_tensor.dl_tensor.device.device_id
+    if dl_tensor.device.device_type == kDLOneAPI:
+        device_id = dl_tensor.device.device_id
         root_device = dpctl.SyclDevice(str(<int>device_id))
         try:
             if _IS_LINUX:
@@ -348,12 +607,12 @@ cpdef usm_ndarray from_dlpack_capsule(object py_caps) except +:
                 default_context = get_device_cached_queue(root_device).sycl_context
         except RuntimeError:
             default_context = get_device_cached_queue(root_device).sycl_context
-        if dlm_tensor.dl_tensor.data is NULL:
+        if dl_tensor.data is NULL:
             usm_type = b"device"
             q = get_device_cached_queue((default_context, root_device,))
         else:
             usm_type = c_dpmem._Memory.get_pointer_type(
-                <DPCTLSyclUSMRef> dlm_tensor.dl_tensor.data,
+                <DPCTLSyclUSMRef> dl_tensor.data,
                 <c_dpctl.SyclContext>default_context)
             if usm_type == b"unknown":
                 raise BufferError(
@@ -362,122 +621,149 @@ cpdef usm_ndarray from_dlpack_capsule(object py_caps) except +:
                     f"{root_device.filter_string}"
                 )
             alloc_device = c_dpmem._Memory.get_pointer_device(
-                <DPCTLSyclUSMRef> dlm_tensor.dl_tensor.data,
+                <DPCTLSyclUSMRef> dl_tensor.data,
                 <c_dpctl.SyclContext>default_context
             )
             q = get_device_cached_queue((default_context, alloc_device,))
-        if dlm_tensor.dl_tensor.dtype.bits % 8:
-            raise BufferError(
-                "Can not import DLPack tensor whose element's "
-                "bitsize is not a multiple of 8"
-            )
-        if dlm_tensor.dl_tensor.dtype.lanes != 1:
-            raise BufferError(
-                "Can not import DLPack tensor with lanes != 1"
-            )
-        offset_min = 0
-        if dlm_tensor.dl_tensor.strides is NULL:
-            for i in range(dlm_tensor.dl_tensor.ndim):
-                sz = sz * dlm_tensor.dl_tensor.shape[i]
-            offset_max = sz - 1
-        else:
-            offset_max = 0
-            for i in range(dlm_tensor.dl_tensor.ndim):
-                stride_i = dlm_tensor.dl_tensor.strides[i]
-                shape_i = dlm_tensor.dl_tensor.shape[i]
-                if shape_i > 1:
-                    shape_i -= 1
-                    if stride_i > 0:
-                        offset_max = offset_max + stride_i * shape_i
-                    else:
-                        offset_min = offset_min + stride_i * shape_i
-            sz = offset_max - offset_min + 1
-        if sz == 0:
-            sz = 1
-
-        element_bytesize = (dlm_tensor.dl_tensor.dtype.bits // 8)
-        sz = sz * element_bytesize
-        element_offset = dlm_tensor.dl_tensor.byte_offset // element_bytesize
-
-        # transfer dlm_tensor ownership
+    elif dl_tensor.device.device_type == kDLCPU:
+        host_data = True
+        q = _host_import_queue(device)
+        zero_copy = q.sycl_device.has_aspect_usm_system_allocations
+    else:
+        raise BufferError(
+            "The DLPack tensor resides on unsupported device."
+        )
+    if dl_tensor.dtype.bits % 8:
+        raise BufferError(
+            "Can not import DLPack tensor whose element's "
+            "bitsize is not a multiple of 8"
+        )
+    if dl_tensor.dtype.lanes != 1:
+        raise BufferError(
+            "Can not import DLPack tensor with lanes != 1"
+        )
+    offset_min = 0
+    if dl_tensor.strides is NULL:
+        for i in range(dl_tensor.ndim):
+            sz = sz * dl_tensor.shape[i]
+        offset_max = sz - 1
+    else:
+        offset_max = 0
+        for i in range(dl_tensor.ndim):
+            stride_i = dl_tensor.strides[i]
+            shape_i = dl_tensor.shape[i]
+            if shape_i > 1:
+                shape_i -= 1
+                if stride_i > 0:
+                    offset_max = offset_max + stride_i * shape_i
+                else:
+                    offset_min = offset_min + stride_i * shape_i
+        sz = offset_max - offset_min + 1
+    if sz == 0:
+        sz = 1
+
+    element_bytesize = (dl_tensor.dtype.bits // 8)
+    sz = sz * element_bytesize
+    element_offset = dl_tensor.byte_offset // element_bytesize
+
+    # transfer dlm_tensor ownership
+    if versioned:
+        dlm_holder = _DLManagedTensorVersionedOwner._create(dlmv_tensor)
+        cpython.PyCapsule_SetName(py_caps, 'used_dltensor_versioned')
+    else:
         dlm_holder = _DLManagedTensorOwner._create(dlm_tensor)
         cpython.PyCapsule_SetName(py_caps, 'used_dltensor')
 
-        if dlm_tensor.dl_tensor.data is NULL:
-            usm_mem = dpmem.MemoryUSMDevice(sz, q)
+    if dl_tensor.data is NULL:
+        if host_data:
+            usm_mem = dpmem.MemoryUSMHost(sz, queue=q)
         else:
-            mem_ptr_delta = dlm_tensor.dl_tensor.byte_offset - (
-                element_offset * element_bytesize
-            )
-            mem_ptr = <char *>dlm_tensor.dl_tensor.data
-            alloc_sz = dlm_tensor.dl_tensor.byte_offset + <uint64_t>(
-                (offset_max + 1) * element_bytesize)
-            tmp = c_dpmem._Memory.create_from_usm_pointer_size_qref(
-                <DPCTLSyclUSMRef> mem_ptr,
-                max(alloc_sz, <uint64_t>element_bytesize),
-                (<c_dpctl.SyclQueue>q).get_queue_ref(),
-                memory_owner=dlm_holder
+            usm_mem = dpmem.MemoryUSMDevice(sz, queue=q)
+    else:
+        mem_ptr_delta = dl_tensor.byte_offset - (
+            element_offset * element_bytesize
+        )
+        mem_ptr = <char *>dl_tensor.data
+        alloc_sz = dl_tensor.byte_offset + <uint64_t>(
+            (offset_max + 1) * element_bytesize)
+        alloc_sz = max(alloc_sz, <uint64_t>element_bytesize)
+        if zero_copy:
+            tmp = _wrap_dlpack_data(
+                mem_ptr, alloc_sz, <c_dpctl.SyclQueue>q, dlm_holder,
+                host_data
             )
-            if mem_ptr_delta == 0:
-                usm_mem = tmp
-            else:
-                alloc_sz = dlm_tensor.dl_tensor.byte_offset + <uint64_t>(
-                    (offset_max * element_bytesize + mem_ptr_delta))
-                usm_mem = c_dpmem._Memory.create_from_usm_pointer_size_qref(
-                    <DPCTLSyclUSMRef> (mem_ptr + (element_bytesize - mem_ptr_delta)),
-                    max(alloc_sz, <uint64_t>element_bytesize),
-                    (<c_dpctl.SyclQueue>q).get_queue_ref(),
-                    memory_owner=tmp
-                )
-        py_shape = list()
-        for i in range(dlm_tensor.dl_tensor.ndim):
-            py_shape.append(dlm_tensor.dl_tensor.shape[i])
-        if (dlm_tensor.dl_tensor.strides is NULL):
-            py_strides = None
         else:
-            py_strides = list()
-            for i in range(dlm_tensor.dl_tensor.ndim):
-                py_strides.append(dlm_tensor.dl_tensor.strides[i])
-        if (dlm_tensor.dl_tensor.dtype.code == kDLUInt):
-            ary_dt = np.dtype("u" + str(element_bytesize))
-        elif (dlm_tensor.dl_tensor.dtype.code == kDLInt):
-            ary_dt = np.dtype("i" + str(element_bytesize))
-        elif (dlm_tensor.dl_tensor.dtype.code == kDLFloat):
-            ary_dt = np.dtype("f" + str(element_bytesize))
-        elif (dlm_tensor.dl_tensor.dtype.code == kDLComplex):
-            ary_dt = np.dtype("c" + str(element_bytesize))
-        elif (dlm_tensor.dl_tensor.dtype.code == kDLBool):
-            ary_dt = np.dtype("?")
+            # copy host data to USM-host allocation, releasing the tensor
+            tmp = dpmem.MemoryUSMHost(alloc_sz, queue=q)
+            string.memcpy(
+                <void *>(<size_t>tmp._pointer), <void *>mem_ptr, alloc_sz
+            )
+            mem_ptr = <char *>(<size_t>tmp._pointer)
+            host_data = False
+        if mem_ptr_delta == 0:
+            usm_mem = tmp
         else:
-            raise BufferError(
-                "Can not import DLPack tensor with type code {}.".format(
-                    <object>dlm_tensor.dl_tensor.dtype.code
-                )
+            alloc_sz = dl_tensor.byte_offset + <uint64_t>(
+                (offset_max * element_bytesize + mem_ptr_delta))
+            usm_mem = _wrap_dlpack_data(
+                mem_ptr + (element_bytesize - mem_ptr_delta),
+                max(alloc_sz, <uint64_t>element_bytesize),
+                <c_dpctl.SyclQueue>q, tmp, host_data
             )
-        res_ary = usm_ndarray(
-            py_shape,
-            dtype=ary_dt,
-            buffer=usm_mem,
-            strides=py_strides,
-            offset=element_offset
-        )
-        return res_ary
+    py_shape = list()
+    for i in range(dl_tensor.ndim):
+        py_shape.append(dl_tensor.shape[i])
+    if (dl_tensor.strides is NULL):
+        py_strides = None
+    else:
+        py_strides = list()
+        for i in range(dl_tensor.ndim):
+            py_strides.append(dl_tensor.strides[i])
+    if (dl_tensor.dtype.code == kDLUInt):
+        ary_dt = np.dtype("u" + str(element_bytesize))
+    elif (dl_tensor.dtype.code == kDLInt):
+        ary_dt = np.dtype("i" + str(element_bytesize))
+    elif (dl_tensor.dtype.code == kDLFloat):
+        ary_dt = np.dtype("f" + str(element_bytesize))
+    elif (dl_tensor.dtype.code == kDLComplex):
+        ary_dt = np.dtype("c" + str(element_bytesize))
+    elif (dl_tensor.dtype.code == kDLBool):
+        ary_dt = np.dtype("?")
     else:
         raise BufferError(
-            "The DLPack tensor resides on unsupported device."
+            "Can not import DLPack tensor with type code {}.".format(
+                <object>dl_tensor.dtype.code
+            )
         )
+    res_ary = usm_ndarray(
+        py_shape,
+        dtype=ary_dt,
+        buffer=usm_mem,
+        strides=py_strides,
+        offset=element_offset
+    )
+    if read_only:
+        (<usm_ndarray>res_ary)._set_writable_flag(0)
+    return res_ary
 
 
-cpdef from_dlpack(array):
-    """ from_dlpack(obj)
+cpdef from_dlpack(array, device=None):
+    """ from_dlpack(obj, device=None)
 
     Constructs :class:`dpctl.tensor.usm_ndarray` instance from a Python
     object `obj` that implements `__dlpack__` protocol. The output
-    array is always a zero-copy view of the input.
+    array is a zero-copy view of the input, unless the input resides
+    in host memory and the CPU device it is imported onto can not access
+    memory not allocated by SYCL runtime, in which case it is copied.
 
     Args:
         obj: A Python object representing an array that supports `__dlpack__`
             protocol.
+        device: CPU device, given as :class:`dpctl.SyclDevice`,
+            :class:`dpctl.SyclQueue` or a filter selector string, to import
+            an array residing in host memory, e.g. a NumPy array, onto.
+            Default device selected by :func:`dpctl.select_cpu_device` is
+            used if `None`. Ignored for arrays residing on oneAPI devices.
 
     Returns:
         usm_ndarray:
@@ -522,5 +808,12 @@ cpdef from_dlpack(array):
             "The argument of type {type(array)} does not implement "
             "`__dlpack__` method."
         )
-    dlpack_capsule = dlpack_attr()
-    return from_dlpack_capsule(dlpack_capsule)
+    try:
+        # request versioned tensor, which carries read-only flag
+        dlpack_capsule = dlpack_attr(
+            max_version=(DLPACK_MAJOR_VERSION, DLPACK_MINOR_VERSION)
+        )
+    except TypeError:
+        # producer does not support DLPack 1.0 keywords
+        dlpack_capsule = dlpack_attr()
+    return from_dlpack_capsule(dlpack_capsule, device)
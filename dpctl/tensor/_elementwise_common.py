@@ -23,6 +23,7 @@ import dpctl.memory as dpm
 import dpctl.tensor as dpt
 import dpctl.tensor._tensor_impl as ti
 from dpctl.tensor._manipulation_functions import _broadcast_shape_impl
+from dpctl.tensor._sharding import _shard_queues, _shard_view, _submit_sharded
 from dpctl.tensor._usmarray import _is_object_with_buffer_protocol as _is_buffer
 from dpctl.utils import ExecutionPlacementError
 
@@ -107,6 +108,19 @@ class UnaryElementwiseFunc:
                         order = "F" if x.flags.f_contiguous else "C"
                     out = dpt.empty_like(x, dtype=res_dt, order=order)
 
+            shard_qs = _shard_queues(exec_q, x.shape)
+            if shard_qs is not None and (orig_out is None or orig_out is out):
+                _submit_sharded(
+                    shard_qs,
+                    x.shape[0],
+                    lambda q, s: self.unary_fn_(
+                        _shard_view(x, q, s),
+                        _shard_view(out, q, s),
+                        sycl_queue=q,
+                    ),
+                )
+                return out
+
             ht_unary_ev, unary_ev = self.unary_fn_(x, out, sycl_queue=exec_q)
 
             if not (orig_out is None or orig_out is out):
@@ -330,6 +344,11 @@ def _resolve_weak_types(o1_dtype, o2_dtype, dev):
         return o1_dtype, o2_dtype
 
 
+def _is_host_scalar(o):
+    "Returns True if `o` is a Python or NumPy scalar"
+    return isinstance(o, (bool, int, float, complex, np.generic))
+
+
 def _get_shape(o):
     if isinstance(o, dpt.usm_ndarray):
         return o.shape
@@ -352,12 +371,14 @@ class BinaryElementwiseFunc:
         binary_dp_impl_fn,
         docs,
         binary_inplace_fn=None,
+        binary_scalar_fn=None,
     ):
         self.__name__ = "BinaryElementwiseFunc"
         self.name_ = name
         self.result_type_resolver_fn_ = result_type_resolver_fn
         self.binary_fn_ = binary_dp_impl_fn
         self.binary_inplace_fn_ = binary_inplace_fn
+        self.binary_scalar_fn_ = binary_scalar_fn
         self.__doc__ = docs
 
     def __str__(self):
@@ -367,12 +388,10 @@ class BinaryElementwiseFunc:
         return f"<BinaryElementwiseFunc '{self.name_}'>"
 
     def __call__(self, o1, o2, out=None, order="K"):
-        # FIXME: replace with check against base array
-        # when views can be identified
-        if o1 is out:
+        if self.binary_inplace_fn_ is not None and o1 is out:
+            # out=o1 is computed in-place, without allocating
+            # the result array
             return self._inplace(o1, o2)
-        elif o2 is out:
-            return self._inplace(o2, o1)
 
         if order not in ["K", "C", "F", "A"]:
             order = "K"
@@ -463,19 +482,52 @@ class BinaryElementwiseFunc:
                     f"Expected output shape is {o1_shape}, got {out.shape}"
                 )
 
-            if ti._array_overlap(o1, out) or ti._array_overlap(o2, out):
-                raise TypeError("Input and output arrays have memory overlap")
-
             if (
-                dpctl.utils.get_execution_queue(
-                    (o1.sycl_queue, o2.sycl_queue, out.sycl_queue)
-                )
+                dpctl.utils.get_execution_queue((exec_q, out.sycl_queue))
                 is None
             ):
                 raise TypeError(
                     "Input and output allocation queues are not compatible"
                 )
 
+            overlapping = [
+                o
+                for o in (o1, o2)
+                if isinstance(o, dpt.usm_ndarray)
+                and o is not out
+                and ti._array_overlap(o, out)
+            ]
+            if overlapping and not (buf1_dt is None and buf2_dt is None):
+                raise TypeError("Input and output arrays have memory overlap")
+            if any(not ti._same_logical_tensors(o, out) for o in overlapping):
+                # Output overlapping an input other than elementwise is
+                # computed into a temporary and copied back. Output which
+                # is the same logical array as an input is computed
+                # directly, since each element is read by the work-item
+                # that writes it.
+                tmp = dpt.empty_like(out)
+                self.__call__(o1, o2, out=tmp, order=order)
+                ht_copy_ev, _ = ti._copy_usm_ndarray_into_usm_ndarray(
+                    src=tmp, dst=out, sycl_queue=exec_q
+                )
+                ht_copy_ev.wait()
+                return out
+
+        if self.binary_scalar_fn_ is not None:
+            res = self._scalar_operand_call(
+                o1,
+                o2,
+                (o1_dtype, o2_dtype),
+                (buf1_dt, buf2_dt),
+                res_dt,
+                res_usm_type,
+                exec_q,
+                out,
+                order,
+            )
+            if res is not None:
+                return res
+
         if isinstance(o1, dpt.usm_ndarray):
             src1 = o1
         else:
@@ -520,6 +572,19 @@ class BinaryElementwiseFunc:
 
             src1 = dpt.broadcast_to(src1, res_shape)
             src2 = dpt.broadcast_to(src2, res_shape)
+            shard_qs = _shard_queues(exec_q, res_shape)
+            if shard_qs is not None:
+                _submit_sharded(
+                    shard_qs,
+                    res_shape[0],
+                    lambda q, s: self.binary_fn_(
+                        src1=_shard_view(src1, q, s),
+                        src2=_shard_view(src2, q, s),
+                        dst=_shard_view(out, q, s),
+                        sycl_queue=q,
+                    ),
+                )
+                return out
             ht_, _ = self.binary_fn_(
                 src1=src1, src2=src2, dst=out, sycl_queue=exec_q
             )
@@ -662,6 +727,79 @@ class BinaryElementwiseFunc:
         dpctl.SyclEvent.wait_for([ht_copy1_ev, ht_copy2_ev, ht_])
         return out
 
+    def _scalar_operand_call(
+        self,
+        o1,
+        o2,
+        o_dtypes,
+        buf_dts,
+        res_dt,
+        res_usm_type,
+        exec_q,
+        out,
+        order,
+    ):
+        """Evaluates the function for contiguous array and a scalar operand,
+        which is passed to the kernel by value, so that no array is allocated
+        for it. Returns `None` if operands do not qualify."""
+        if isinstance(o1, dpt.usm_ndarray) and _is_host_scalar(o2):
+            arr, scalar, scalar_is_first = o1, o2, False
+            arr_buf_dt, scalar_dt = buf_dts[0], buf_dts[1] or o_dtypes[1]
+        elif isinstance(o2, dpt.usm_ndarray) and _is_host_scalar(o1):
+            arr, scalar, scalar_is_first = o2, o1, True
+            arr_buf_dt, scalar_dt = buf_dts[1], buf_dts[0] or o_dtypes[0]
+        else:
+            return None
+        if arr_buf_dt is not None:
+            return None
+        c_contig = arr.flags.c_contiguous
+        f_contig = arr.flags.f_contiguous
+        if order in ["K", "A"] and (c_contig or f_contig):
+            layout = "C" if c_contig else "F"
+        elif (order == "C" and c_contig) or (order == "F" and f_contig):
+            layout = order
+        else:
+            return None
+        if out is None:
+            out = dpt.empty(
+                arr.shape,
+                dtype=res_dt,
+                usm_type=res_usm_type,
+                sycl_queue=exec_q,
+                order=layout,
+            )
+        elif out.dtype != res_dt or not (
+            out.flags.c_contiguous if layout == "C" else out.flags.f_contiguous
+        ):
+            return None
+        scalar = np.asarray(scalar, dtype=scalar_dt)[()]
+        shard_qs = _shard_queues(exec_q, arr.shape)
+        if shard_qs is not None and layout == "C":
+            # blocks of rows of C-contiguous arrays remain contiguous
+            _submit_sharded(
+                shard_qs,
+                arr.shape[0],
+                lambda q, s: self.binary_scalar_fn_(
+                    src=_shard_view(arr, q, s),
+                    scalar=scalar,
+                    scalar_dtype=scalar_dt,
+                    scalar_is_first=scalar_is_first,
+                    dst=_shard_view(out, q, s),
+                    sycl_queue=q,
+                ),
+            )
+            return out
+        ht_, _ = self.binary_scalar_fn_(
+            src=arr,
+            scalar=scalar,
+            scalar_dtype=scalar_dt,
+            scalar_is_first=scalar_is_first,
+            dst=out,
+            sycl_queue=exec_q,
+        )
+        ht_.wait()
+        return out
+
     def _inplace(self, lhs, val):
         if self.binary_inplace_fn_ is None:
             raise ValueError(
@@ -745,7 +883,11 @@ class BinaryElementwiseFunc:
 
         if isinstance(val, dpt.usm_ndarray):
             rhs = val
+            # rhs identical to lhs is read by the kernel before each
+            # element is written, so needs no copy
             overlap = ti._array_overlap(lhs, rhs)
+            if overlap and ti._same_logical_tensors(lhs, rhs):
+                overlap = False
         else:
             rhs = dpt.asarray(val, dtype=val_dtype, sycl_queue=exec_q)
             overlap = False
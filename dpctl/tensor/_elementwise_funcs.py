@@ -78,6 +78,7 @@ add = BinaryElementwiseFunc(
     ti._add,
     _add_docstring_,
     binary_inplace_fn=ti._add_inplace,
+    binary_scalar_fn=ti._add_scalar,
 )
 
 # U04: ===== ASIN  (x)
@@ -192,7 +193,12 @@ Returns:
 """
 
 divide = BinaryElementwiseFunc(
-    "divide", ti._divide_result_type, ti._divide, _divide_docstring_
+    "divide",
+    ti._divide_result_type,
+    ti._divide,
+    _divide_docstring_,
+    binary_inplace_fn=ti._divide_inplace,
+    binary_scalar_fn=ti._divide_scalar,
 )
 
 # B09: ==== EQUAL         (x1, x2)
@@ -221,7 +227,11 @@ Returns:
 """
 
 equal = BinaryElementwiseFunc(
-    "equal", ti._equal_result_type, ti._equal, _equal_docstring_
+    "equal",
+    ti._equal_result_type,
+    ti._equal,
+    _equal_docstring_,
+    binary_scalar_fn=ti._equal_scalar,
 )
 
 # U13: ==== EXP           (x)
@@ -298,6 +308,8 @@ floor_divide = BinaryElementwiseFunc(
     ti._floor_divide_result_type,
     ti._floor_divide,
     _floor_divide_docstring_,
+    binary_inplace_fn=ti._floor_divide_inplace,
+    binary_scalar_fn=ti._floor_divide_scalar,
 )
 
 # B11: ==== GREATER       (x1, x2)
@@ -324,7 +336,11 @@ Returns:
 """
 
 greater = BinaryElementwiseFunc(
-    "greater", ti._greater_result_type, ti._greater, _greater_docstring_
+    "greater",
+    ti._greater_result_type,
+    ti._greater,
+    _greater_docstring_,
+    binary_scalar_fn=ti._greater_scalar,
 )
 
 # B12: ==== GREATER_EQUAL (x1, x2)
@@ -356,6 +372,7 @@ greater_equal = BinaryElementwiseFunc(
     ti._greater_equal_result_type,
     ti._greater_equal,
     _greater_equal_docstring_,
+    binary_scalar_fn=ti._greater_equal_scalar,
 )
 
 # U16: ==== IMAG        (x)
@@ -486,7 +503,11 @@ Returns:
 """
 
 less = BinaryElementwiseFunc(
-    "less", ti._less_result_type, ti._less, _less_docstring_
+    "less",
+    ti._less_result_type,
+    ti._less,
+    _less_docstring_,
+    binary_scalar_fn=ti._less_scalar,
 )
 
 # B14: ==== LESS_EQUAL  (x1, x2)
@@ -518,6 +539,7 @@ less_equal = BinaryElementwiseFunc(
     ti._less_equal_result_type,
     ti._less_equal,
     _less_equal_docstring_,
+    binary_scalar_fn=ti._less_equal_scalar,
 )
 
 # U20: ==== LOG         (x)
@@ -644,6 +666,7 @@ logical_and = BinaryElementwiseFunc(
     ti._logical_and_result_type,
     ti._logical_and,
     _logical_and_docstring_,
+    binary_scalar_fn=ti._logical_and_scalar,
 )
 
 # U24: ==== LOGICAL_NOT (x)
@@ -698,6 +721,7 @@ logical_or = BinaryElementwiseFunc(
     ti._logical_or_result_type,
     ti._logical_or,
     _logical_or_docstring_,
+    binary_scalar_fn=ti._logical_or_scalar,
 )
 
 # B18: ==== LOGICAL_XOR (x1, x2)
@@ -727,6 +751,7 @@ logical_xor = BinaryElementwiseFunc(
     ti._logical_xor_result_type,
     ti._logical_xor,
     _logical_xor_docstring_,
+    binary_scalar_fn=ti._logical_xor_scalar,
 )
 
 # B19: ==== MULTIPLY    (x1, x2)
@@ -758,6 +783,7 @@ multiply = BinaryElementwiseFunc(
     ti._multiply,
     _multiply_docstring_,
     ti._multiply_inplace,
+    binary_scalar_fn=ti._multiply_scalar,
 )
 
 # U25: ==== NEGATIVE    (x)
@@ -809,7 +835,11 @@ Returns:
 """
 
 not_equal = BinaryElementwiseFunc(
-    "not_equal", ti._not_equal_result_type, ti._not_equal, _not_equal_docstring_
+    "not_equal",
+    ti._not_equal_result_type,
+    ti._not_equal,
+    _not_equal_docstring_,
+    binary_scalar_fn=ti._not_equal_scalar,
 )
 
 # U26: ==== POSITIVE    (x)
@@ -853,7 +883,12 @@ Returns:
         the returned array is determined by the Type Promotion Rules.
 """
 pow = BinaryElementwiseFunc(
-    "pow", ti._pow_result_type, ti._pow, _pow_docstring_
+    "pow",
+    ti._pow_result_type,
+    ti._pow,
+    _pow_docstring_,
+    binary_inplace_fn=ti._pow_inplace,
+    binary_scalar_fn=ti._pow_scalar,
 )
 
 # U??: ==== PROJ        (x)
@@ -1021,6 +1056,7 @@ subtract = BinaryElementwiseFunc(
     ti._subtract,
     _subtract_docstring_,
     ti._subtract_inplace,
+    binary_scalar_fn=ti._subtract_scalar,
 )
 
 
@@ -0,0 +1,337 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import operator
+
+from numpy.core.numeric import normalize_axis_index, normalize_axis_tuple
+
+import dpctl
+import dpctl.tensor as dpt
+import dpctl.tensor._tensor_impl as ti
+from dpctl.tensor._manipulation_functions import _broadcast_shape_impl
+from dpctl.utils import ExecutionPlacementError
+
+from ._type_utils import _find_buf_dtype2
+
+
+def _linalg_exec_placement(x1, x2):
+    """Validates array arguments and returns execution queue
+    and USM type of the result."""
+    if not isinstance(x1, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x1)}")
+    if not isinstance(x2, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x2)}")
+    exec_q = dpctl.utils.get_execution_queue((x1.sycl_queue, x2.sycl_queue))
+    if exec_q is None:
+        raise ExecutionPlacementError(
+            "Execution placement can not be unambiguously inferred "
+            "from input arguments."
+        )
+    res_usm_type = dpctl.utils.get_coerced_usm_type(
+        (
+            x1.usm_type,
+            x2.usm_type,
+        )
+    )
+    dpctl.utils.validate_usm_type(res_usm_type, allow_none=False)
+    return exec_q, res_usm_type
+
+
+def _linalg_buf_dtypes(name, x1, x2, exec_q):
+    """Returns data types of buffers of inputs, or `None` if no
+    cast is needed, and the data type of the result."""
+    buf1_dt, buf2_dt, res_dt = _find_buf_dtype2(
+        x1.dtype, x2.dtype, ti._dot_result_type, exec_q.sycl_device
+    )
+    if res_dt is None:
+        raise TypeError(
+            f"function '{name}' does not support input types "
+            f"({x1.dtype}, {x2.dtype}), "
+            "and the inputs could not be safely coerced to any "
+            "supported types according to the casting rule ''safe''."
+        )
+    return buf1_dt, buf2_dt, res_dt
+
+
+def matrix_transpose(x):
+    """matrix_transpose(x)
+
+    Transposes the innermost two dimensions of `x`, where `x` is a
+    2-dimensional matrix or a stack of 2-dimensional matrices.
+
+    To convert from a 1-dimensional array to a 2-dimensional column
+    vector, use x[:, dpt.newaxis].
+
+    Args:
+        x (usm_ndarray):
+            Input array with shape (..., m, n).
+
+    Returns:
+        usm_ndarray:
+            Array with shape (..., n, m).
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    if x.ndim < 2:
+        raise ValueError(
+            "dpctl.tensor.matrix_transpose requires array to have "
+            "at least 2 dimensions"
+        )
+    return x.mT
+
+
+def matmul(x1, x2):
+    """matmul(x1, x2)
+
+    Computes the matrix product. Implements the same semantics
+    as the built-in operator `@`.
+
+    Args:
+        x1 (usm_ndarray):
+            first input array. Must have at least one dimension.
+            If `x1` is one-dimensional having shape (M,), it is
+            promoted to a two-dimensional array with shape (1, M)
+            for the purpose of computation, and the prepended
+            dimension is removed from the result.
+            If `x1` has more than two dimensions, it is treated as
+            a stack of matrices.
+        x2 (usm_ndarray):
+            second input array. Must have at least one dimension.
+            If `x2` is one-dimensional having shape (N,), it is
+            promoted to a two-dimensional array with shape (N, 1)
+            for the purpose of computation, and the appended dimension
+            is removed from the result.
+            If `x2` has more than two dimensions, it is treated as
+            a stack of matrices. Stack dimensions of `x1` and `x2` are
+            broadcast against each other.
+
+    Returns:
+        usm_ndarray:
+            an array containing the matrix product of `x1` and `x2`.
+            The data type of the returned array is determined by the
+            Type Promotion Rules.
+    """
+    exec_q, res_usm_type = _linalg_exec_placement(x1, x2)
+    x1_nd = x1.ndim
+    x2_nd = x2.ndim
+    if x1_nd == 0 or x2_nd == 0:
+        raise ValueError("one or more operands to matmul is 0 dimensional")
+    buf1_dt, buf2_dt, res_dt = _linalg_buf_dtypes("matmul", x1, x2, exec_q)
+
+    if x1_nd == 1:
+        x1 = dpt.expand_dims(x1, axis=0)
+    if x2_nd == 1:
+        x2 = dpt.expand_dims(x2, axis=-1)
+    n, k = x1.shape[-2:]
+    k2, m = x2.shape[-2:]
+    if k != k2:
+        raise ValueError(
+            "mismatch in contracted dimension of matmul operands: "
+            f"{x1.shape} and {x2.shape}"
+        )
+    try:
+        batch_shape = _broadcast_shape_impl([x1.shape[:-2], x2.shape[:-2]])
+    except ValueError:
+        raise ValueError(
+            "stack dimensions of operands could not be broadcast together "
+            f"with shapes {x1.shape[:-2]} and {x2.shape[:-2]}"
+        )
+
+    if buf1_dt is not None:
+        x1 = dpt.astype(x1, buf1_dt)
+    if buf2_dt is not None:
+        x2 = dpt.astype(x2, buf2_dt)
+
+    res_shape = batch_shape + (n, m)
+    res = dpt.empty(
+        res_shape, dtype=res_dt, usm_type=res_usm_type, sycl_queue=exec_q
+    )
+    x1 = dpt.broadcast_to(x1, batch_shape + (n, k))
+    x2 = dpt.broadcast_to(x2, batch_shape + (k, m))
+    ht_ev, _ = ti._matmul(x1=x1, x2=x2, dst=res, sycl_queue=exec_q)
+    ht_ev.wait()
+
+    if x1_nd == 1:
+        res = dpt.squeeze(res, axis=-2)
+    if x2_nd == 1:
+        res = dpt.squeeze(res, axis=-1)
+    return res
+
+
+def tensordot(x1, x2, axes=2):
+    """tensordot(x1, x2, axes=2)
+
+    Returns a tensor contraction of `x1` and `x2` over specific axes.
+
+    Args:
+        x1 (usm_ndarray):
+            first input array.
+        x2 (usm_ndarray):
+            second input array.
+        axes (Union[int, Tuple[Sequence[int], Sequence[int]]]):
+            number of axes to contract or explicit sequences of axes for
+            `x1` and `x2`, respectively. If `axes` is an integer equal to
+            `N`, then the contraction is performed over last `N` axes of
+            `x1` and the first `N` axis of `x2` in order. The size of each
+            corresponding axis must match. If `axes` is a tuple of two
+            sequences `(x1_axes, x2_axes)`, the first sequence applies to
+            `x1` and the second sequence applies to `x2`. Both sequences
+            must have equal length, and each axis `x1_axes[i]` for `x1`
+            must have the same size as the respective axis `x2_axes[i]`
+            for `x2`. Default: `2`.
+
+    Returns:
+        usm_ndarray:
+            an array containing the tensor contraction whose shape consists
+            of the non-contracted axes of the first array `x1`, followed by
+            the non-contracted axes of the second array `x2`. The data type
+            of the returned array is determined by the Type Promotion Rules.
+    """
+    exec_q, res_usm_type = _linalg_exec_placement(x1, x2)
+    x1_nd = x1.ndim
+    x2_nd = x2.ndim
+    if isinstance(axes, tuple):
+        if len(axes) != 2:
+            raise ValueError(
+                "`axes` tuple is expected to contain two sequences"
+            )
+        x1_axes = tuple(axes[0])
+        x2_axes = tuple(axes[1])
+        if len(x1_axes) != len(x2_axes):
+            raise ValueError(
+                "sequences of axes in `axes` must have the same length"
+            )
+        x1_axes = normalize_axis_tuple(x1_axes, x1_nd, "axes")
+        x2_axes = normalize_axis_tuple(x2_axes, x2_nd, "axes")
+    else:
+        n_axes = operator.index(axes)
+        if n_axes < 0:
+            raise ValueError("`axes` integer is expected to be non-negative")
+        if n_axes > x1_nd or n_axes > x2_nd:
+            raise ValueError(
+                "`axes` exceeds the number of dimensions of an operand"
+            )
+        x1_axes = tuple(range(x1_nd - n_axes, x1_nd))
+        x2_axes = tuple(range(n_axes))
+    for ax1, ax2 in zip(x1_axes, x2_axes):
+        if x1.shape[ax1] != x2.shape[ax2]:
+            raise ValueError(
+                "shapes of contracted axes are not consistent: "
+                f"{x1.shape} and {x2.shape} for axes {x1_axes} and {x2_axes}"
+            )
+    buf1_dt, buf2_dt, res_dt = _linalg_buf_dtypes("tensordot", x1, x2, exec_q)
+
+    x1_free = tuple(i for i in range(x1_nd) if i not in x1_axes)
+    x2_free = tuple(i for i in range(x2_nd) if i not in x2_axes)
+    x1_free_shape = tuple(x1.shape[i] for i in x1_free)
+    x2_free_shape = tuple(x2.shape[i] for i in x2_free)
+    n = 1
+    for s in x1_free_shape:
+        n *= s
+    m = 1
+    for s in x2_free_shape:
+        m *= s
+    k = 1
+    for i in x1_axes:
+        k *= x1.shape[i]
+
+    if buf1_dt is not None:
+        x1 = dpt.astype(x1, buf1_dt)
+    if buf2_dt is not None:
+        x2 = dpt.astype(x2, buf2_dt)
+
+    # contraction is computed as matrix multiplication of (n, k) and (k, m)
+    # matrices, reshape copies only if permuted arrays can not be viewed
+    x1_mat = dpt.reshape(dpt.permute_dims(x1, x1_free + x1_axes), (n, k))
+    x2_mat = dpt.reshape(dpt.permute_dims(x2, x2_axes + x2_free), (k, m))
+    res = dpt.empty(
+        (n, m), dtype=res_dt, usm_type=res_usm_type, sycl_queue=exec_q
+    )
+    ht_ev, _ = ti._matmul(x1=x1_mat, x2=x2_mat, dst=res, sycl_queue=exec_q)
+    ht_ev.wait()
+
+    return dpt.reshape(res, x1_free_shape + x2_free_shape)
+
+
+def vecdot(x1, x2, axis=-1):
+    """vecdot(x1, x2, axis=-1)
+
+    Computes the (vector) dot product of two arrays.
+
+    Args:
+        x1 (usm_ndarray):
+            first input array. If `x1` has complex data type, its
+            complex conjugate is used in the computation.
+        x2 (usm_ndarray):
+            second input array. Must be compatible with `x1` for all
+            non-contracted axes according to Array Broadcasting rules.
+        axis (int):
+            axis over which to compute the dot product. The axis must be
+            an integer on the interval `[-N, N)`, where `N` is the rank
+            of the shape determined according to Array Broadcasting
+            rules. Default: `-1`.
+
+    Returns:
+        usm_ndarray:
+            if `x1` and `x2` are both one-dimensional arrays, a
+            zero-dimensional array containing the dot product value
+            is returned; otherwise, a non-zero-dimensional array containing
+            the dot products and having rank `N-1`, where `N` is the rank
+            of the shape of input arrays after broadcasting rules are
+            applied to non-contracted axes. The data type of the returned
+            array is determined by the Type Promotion Rules.
+    """
+    exec_q, res_usm_type = _linalg_exec_placement(x1, x2)
+    if x1.ndim == 0 or x2.ndim == 0:
+        raise ValueError("one or more operands to vecdot is 0 dimensional")
+    try:
+        br_shape = _broadcast_shape_impl([x1.shape, x2.shape])
+    except ValueError:
+        raise ValueError(
+            "operands could not be broadcast together with shapes "
+            f"{x1.shape} and {x2.shape}"
+        )
+    nd = len(br_shape)
+    axis = normalize_axis_index(operator.index(axis), nd)
+    x1_shape = (1,) * (nd - x1.ndim) + x1.shape
+    x2_shape = (1,) * (nd - x2.ndim) + x2.shape
+    if x1_shape[axis] != x2_shape[axis]:
+        raise ValueError(
+            "shapes of operands along contracted axis are not consistent: "
+            f"{x1.shape} and {x2.shape}"
+        )
+    buf1_dt, buf2_dt, res_dt = _linalg_buf_dtypes("vecdot", x1, x2, exec_q)
+
+    if buf1_dt is not None:
+        x1 = dpt.astype(x1, buf1_dt)
+    if buf2_dt is not None:
+        x2 = dpt.astype(x2, buf2_dt)
+    if x1.dtype.kind == "c":
+        x1 = dpt.conj(x1)
+
+    perm = [i for i in range(nd) if i != axis] + [axis]
+    x1 = dpt.permute_dims(dpt.broadcast_to(x1, br_shape), perm)
+    x2 = dpt.permute_dims(dpt.broadcast_to(x2, br_shape), perm)
+    res = dpt.empty(
+        x1.shape[:-1],
+        dtype=res_dt,
+        usm_type=res_usm_type,
+        sycl_queue=exec_q,
+    )
+    ht_ev, _ = ti._vecdot(x1=x1, x2=x2, dst=res, sycl_queue=exec_q)
+    ht_ev.wait()
+
+    return res
@@ -20,6 +20,7 @@ import dpctl
 import dpctl.tensor as dpt
 import dpctl.tensor._tensor_impl as ti
 
+from ._sharding import _shard_queues, _shard_view, _submit_sharded
 from ._type_utils import _to_device_supported_dtype
 
 
@@ -52,8 +53,53 @@ def _default_reduction_dtype(inp_dt, q):
     return res_dt
 
 
-def sum(arr, axis=None, dtype=None, keepdims=False):
-    """sum(x, axis=None, dtype=None, keepdims=False)
+def _sum_sharded(arr, perm, red_nd, res, queues):
+    """Sums `arr` permuted by `perm` over `red_nd` trailing axes into `res`,
+    splitting the leading axis of `arr` across `queues`."""
+    if red_nd < arr.ndim and perm[0] == 0:
+        # the leading axis is not reduced, so blocks of rows of
+        # the result are computed independently
+        _submit_sharded(
+            queues,
+            arr.shape[0],
+            lambda q, s: ti._sum_over_axis(
+                src=dpt.permute_dims(_shard_view(arr, q, s), perm),
+                trailing_dims_to_reduce=red_nd,
+                dst=_shard_view(res, q, s),
+                sycl_queue=q,
+            ),
+        )
+        return
+    # partial sums over blocks of rows are summed afterwards
+    exec_q = res.sycl_queue
+    partial = dpt.empty(
+        (len(queues),) + res.shape,
+        dtype=res.dtype,
+        usm_type=res.usm_type,
+        sycl_queue=exec_q,
+    )
+    block_ids = iter(range(len(queues)))
+    _submit_sharded(
+        queues,
+        arr.shape[0],
+        lambda q, s: ti._sum_over_axis(
+            src=dpt.permute_dims(_shard_view(arr, q, s), perm),
+            trailing_dims_to_reduce=red_nd,
+            dst=_shard_view(partial, q, next(block_ids)),
+            sycl_queue=q,
+        ),
+    )
+    ht_e, _ = ti._sum_over_axis(
+        src=dpt.moveaxis(partial, 0, -1),
+        trailing_dims_to_reduce=1,
+        dst=res,
+        sycl_queue=exec_q,
+    )
+    ht_e.wait()
+
+
+def sum(arr, axis=None, dtype=None, keepdims=False, deterministic=False):
+    """sum(x, axis=None, dtype=None, keepdims=False, deterministic=False)
 
     Calculates the sum of the input array `x`.
 
@@ -94,6 +140,16 @@ def sum(arr, axis=None, dtype=None, keepdims=False):
             compatible with the input arrays according to Array Broadcasting
             rules. Otherwise, if `False`, the reduced axes are not included in
             the returned array. Default: `False`.
+        deterministic (Optional[bool]):
+            if `True`, sums of real-valued and complex-valued floating-point
+            data types are computed with compensated summation, where
+            rounding errors of all additions, including those combining
+            partial sums, are accumulated and added to the result. The
+            result is as accurate as if it were computed in twice the
+            working precision and then rounded, and is reproducible bit for
+            bit between calls on the same device for the same memory layout
+            of `x`, at the expense of performance. Sums of integral data
+            types are exact and are not affected. Default: `False`.
     Returns:
         usm_ndarray:
             an array containing the sums. If the sum was computed over the
@@ -134,10 +190,20 @@ def sum(arr, axis=None, dtype=None, keepdims=False):
         res = dpt.empty(
             res_shape, dtype=res_dt, usm_type=res_usm_type, sycl_queue=q
         )
-        ht_e, _ = ti._sum_over_axis(
-            src=arr2, trailing_dims_to_reduce=red_nd, dst=res, sycl_queue=q
-        )
-        host_tasks_list.append(ht_e)
+        # sharding changes the order of summation, so is not used for
+        # reproducible sums
+        shard_qs = None if deterministic else _shard_queues(q, arr.shape)
+        if shard_qs is not None:
+            _sum_sharded(arr, perm, red_nd, res, shard_qs)
+        else:
+            ht_e, _ = ti._sum_over_axis(
+                src=arr2,
+                trailing_dims_to_reduce=red_nd,
+                dst=res,
+                sycl_queue=q,
+                deterministic=deterministic,
+            )
+            host_tasks_list.append(ht_e)
     else:
         if dtype is None:
             raise RuntimeError(
@@ -149,7 +215,11 @@ def sum(arr, axis=None, dtype=None, keepdims=False):
             res_shape, dtype=tmp_dt, usm_type=res_usm_type, sycl_queue=q
         )
         ht_e_tmp, r_e = ti._sum_over_axis(
-            src=arr2, trailing_dims_to_reduce=red_nd, dst=tmp, sycl_queue=q
+            src=arr2,
+            trailing_dims_to_reduce=red_nd,
+            dst=tmp,
+            sycl_queue=q,
+            deterministic=deterministic,
         )
         host_tasks_list.append(ht_e_tmp)
         res = dpt.empty(
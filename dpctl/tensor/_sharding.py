@@ -0,0 +1,152 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import contextlib
+import operator
+from contextvars import ContextVar
+from functools import reduce
+
+import dpctl
+
+__doc__ = (
+    "Implementation module for execution of :class:`dpctl.tensor.usm_ndarray` "
+    "operations split along the leading axis across several queues."
+)
+
+
+class _ShardingState:
+    __slots__ = ("queues", "min_size")
+
+    def __init__(self, queues, min_size):
+        self.queues = queues
+        self.min_size = min_size
+
+
+_sharding_state = ContextVar("dpctl_tensor_sharding_state", default=None)
+
+
+def create_shard_queues(device=None, partition="numa"):
+    """create_shard_queues(device=None, partition="numa")
+
+    Partitions the device into sub-devices and returns queues targeting
+    them which share a common context, suitable for use with
+    :func:`dpctl.tensor.sharding`.
+
+    Arrays operated upon with sharding must be allocated with a queue
+    of the returned list, e.g. the first one.
+
+    Args:
+        device (Optional[object]):
+            device to partition, either a :class:`dpctl.SyclDevice` or
+            a filter selector string. Default device is used if `None`.
+        partition (Optional[object]):
+            partition specification passed to
+            :meth:`dpctl.SyclDevice.create_sub_devices`. Default: `"numa"`.
+    Returns:
+        List[dpctl.SyclQueue]:
+            queues targeting each of the sub-devices.
+    """
+    if device is None:
+        device = dpctl.select_default_device()
+    elif not isinstance(device, dpctl.SyclDevice):
+        device = dpctl.SyclDevice(device)
+    sub_devs = device.create_sub_devices(partition=partition)
+    ctx = dpctl.SyclContext(sub_devs)
+    return [dpctl.SyclQueue(ctx, d) for d in sub_devs]
+
+
+@contextlib.contextmanager
+def sharding(queues, min_size=2**20):
+    """sharding(queues, min_size=2**20)
+
+    Context manager splitting operations on arrays across several queues.
+
+    Within the scope of the `with` block, element-wise functions, sums
+    and copies of arrays with at least `min_size` elements, allocated
+    with a queue sharing the context of `queues`, are split along the
+    leading axis into contiguous blocks of rows computed concurrently,
+    each on one of the `queues`. The operation completes when all
+    blocks have been computed. Operations needing temporary arrays, e.g.
+    to cast inputs, are not split.
+
+    :Example:
+        .. code-block:: python
+
+            import dpctl.tensor as dpt
+
+            qs = dpt.create_shard_queues("cpu", partition="numa")
+            x = dpt.ones((10**4, 10**4), sycl_queue=qs[0])
+            with dpt.sharding(qs):
+                y = dpt.exp(x)
+                s = dpt.sum(y, axis=1)
+
+    Args:
+        queues (List[dpctl.SyclQueue]):
+            queues, sharing a common context, to split operations across.
+        min_size (Optional[int]):
+            minimal number of elements of arrays for operations on them
+            to be split. Default: `2**20`.
+    """
+    queues = tuple(queues)
+    if len(queues) == 0 or not all(
+        isinstance(q, dpctl.SyclQueue) for q in queues
+    ):
+        raise TypeError("Expected a non-empty sequence of dpctl.SyclQueue")
+    ctx = queues[0].sycl_context
+    if any(q.sycl_context != ctx for q in queues[1:]):
+        raise ValueError("Queues must share a common SYCL context")
+    min_size = operator.index(min_size)
+    token = _sharding_state.set(_ShardingState(queues, min_size))
+    try:
+        yield
+    finally:
+        _sharding_state.reset(token)
+
+
+def _shard_queues(exec_q, shape):
+    """Returns queues to split an operation with the leading axis of `shape`
+    across, or `None` if the operation should be executed by `exec_q` alone.
+    """
+    state = _sharding_state.get()
+    if state is None or len(state.queues) < 2:
+        return None
+    if len(shape) == 0 or shape[0] < 2:
+        return None
+    if reduce(operator.mul, shape, 1) < state.min_size:
+        return None
+    if exec_q.sycl_context != state.queues[0].sycl_context:
+        return None
+    return state.queues[: min(len(state.queues), shape[0])]
+
+
+def _shard_view(x, q, s):
+    """View of rows `s` of `x` associated with queue `q`"""
+    return x[s].to_device(q)
+
+
+def _submit_sharded(queues, n, submit_fn):
+    """Calls `submit_fn(q, s)` for every queue `q` with a block `s` of
+    rows out of `n`, and waits for the host tasks returned by the calls.
+    """
+    k = len(queues)
+    host_tasks = []
+    start = 0
+    for i, q in enumerate(queues):
+        stop = start + n // k + (1 if i < n % k else 0)
+        ht_ev, _ = submit_fn(q, slice(start, stop))
+        host_tasks.append(ht_ev)
+        start = stop
+    dpctl.SyclEvent.wait_for(host_tasks)
@@ -96,6 +96,42 @@ def _dispatch_binary_elementwise2(other, name, ary):
     return NotImplemented
 
 
+def _inplace_binary_elementwise(ary, fn, other, out_of_place_fn):
+    """
+    Computes `fn` in-place, or if there is no in-place kernel for the types,
+    e.g. for integral `ary` and floating-point result, computes the result
+    with `out_of_place_fn` and casts it back into `ary`.
+    """
+    try:
+        return fn._inplace(ary, other)
+    except TypeError:
+        pass
+    res = out_of_place_fn(other)
+    if res is NotImplemented:
+        return res
+    ary.__setitem__(Ellipsis, res)
+    return ary
+
+
+cdef void _dlpack_synchronize(
+    c_dpctl.SyclQueue producer, c_dpctl.SyclQueue consumer
+) except *:
+    """
+    Makes `consumer` queue wait for operations submitted to `producer`
+    queue, which may be writing into an array allocated on it.
+    """
+    if producer == consumer and producer.is_in_order:
+        # operations submitted by the consumer are ordered after pending
+        # writes already
+        return
+    # Barrier without dependencies completes after all operations
+    # submitted to producer queue so far, including writers which
+    # did not wait for their completion, e.g. kernels submitted to
+    # out-of-order queues by other libraries
+    ev = producer.submit_barrier()
+    consumer.submit_barrier(dependent_events=[ev])
+
+
 cdef class InternalUSMArrayError(Exception):
     """
     A InternalError exception is raised when internal
@@ -833,10 +869,11 @@ cdef class usm_ndarray:
 
         Returns:
             usm_ndarray:
-                A view if data copy is not required, and a copy otherwise.
-                If copying is required, it is done by copying from the original
-                allocation device to the host, followed by copying from host
-                to the target device.
+                A view if the target queue shares the context of the
+                original allocation, and a copy otherwise. Data are copied
+                in chunks through pinned host memory, with copying of a
+                chunk to the target device overlapping with copying of the
+                next chunk to the host.
         """
         cdef c_dpctl.DPCTLSyclQueueRef QRef = NULL
         cdef c_dpmem._Memory arr_buf
@@ -962,25 +999,90 @@ cdef class usm_ndarray:
             return _dispatch_binary_elementwise2(first, "logical_and", other)
         return NotImplemented
 
-    def __dlpack__(self, stream=None):
+    def __dlpack__(
+        self, stream=None, *, max_version=None, dl_device=None, copy=None
+    ):
         """
         Produces DLPack capsule.
 
+        Args:
+            stream (:class:`dpctl.SyclQueue`, optional):
+                Execution queue on which the consumer accesses the tensor.
+                It is made to wait, by means of barriers, for all
+                operations submitted so far to the queue of the array,
+                unless it is that queue and the queue is in-order.
+                Writers of the array are not tracked individually.
+                Default: ``None``, no synchronization is performed.
+            max_version (tuple[int, int], optional):
+                Maximal DLPack version ``(major, minor)`` supported by
+                the consumer. If ``None``, or if the major version is
+                less than 1, capsule "dltensor" with legacy
+                ``DLManagedTensor`` is produced, otherwise capsule
+                "dltensor_versioned" with ``DLManagedTensorVersioned``,
+                which records whether the array is read-only.
+                Default: ``None``.
+            dl_device (tuple[int, int], optional):
+                DLPack device ``(device_type, device_id)`` the consumer
+                requests the tensor on. Only the device of the array, as
+                given by ``__dlpack_device__``, and host device
+                ``(kDLCPU, 0)``, which requires a copy, are supported.
+                Default: ``None``, the device of the array.
+            copy (bool, optional):
+                If ``True``, the exported tensor is always a copy. If
+                ``False``, ``BufferError`` is raised if a copy is required.
+                If ``None``, the array is copied only if required.
+                Default: ``None``.
+
         Raises:
             MemoryError: when host memory can not be allocated.
             DLPackCreationError: when array is allocated on a partitioned
                 SYCL device, or with a non-default context.
-            NotImplementedError: when non-default value of `stream` keyword
-                is used.
+            BufferError: when the tensor can not be exported to the
+                requested device, or a copy is required but ``copy`` is
+                ``False``.
+            TypeError: when ``max_version`` or ``dl_device`` are not
+                tuples of two integers.
         """
-        _caps = c_dlpack.to_dlpack_capsule(self)
-        if (stream is None or type(stream) is not dpctl.SyclQueue or
-            stream == self.sycl_queue):
-            pass
-        else:
-            ev = self.sycl_queue.submit_barrier()
-            stream.submit_barrier(dependent_events=[ev])
-        return _caps
+        cdef bint legacy = True
+        cdef bint to_host = False
+        cdef bint copied = False
+        cdef usm_ndarray ary = self
+        if max_version is not None:
+            if not isinstance(max_version, tuple) or len(max_version) != 2:
+                raise TypeError(
+                    "`__dlpack__` expects `max_version` to be a 2-tuple of "
+                    f"integers `(major, minor)`, got {max_version}"
+                )
+            legacy = max_version[0] < c_dlpack.dlpack_major_version
+        if dl_device is not None:
+            if not isinstance(dl_device, tuple) or len(dl_device) != 2:
+                raise TypeError(
+                    "`__dlpack__` expects `dl_device` to be a 2-tuple of "
+                    f"integers `(device_type, device_id)`, got {dl_device}"
+                )
+            if dl_device[0] == c_dlpack.device_CPU:
+                to_host = True
+            elif dl_device != self.__dlpack_device__():
+                raise BufferError(
+                    f"Can not export array to DLPack device {dl_device}"
+                )
+        if to_host or copy:
+            if copy is False:
+                raise BufferError(
+                    "Exporting array to host device requires a copy, "
+                    "but `copy=False` was specified"
+                )
+            import dpctl.tensor as dpt
+            ary = dpt.empty_like(
+                self, usm_type=("host" if to_host else self.usm_type)
+            )
+            ary[...] = self
+            copied = True
+        elif stream is not None and type(stream) is dpctl.SyclQueue:
+            _dlpack_synchronize(self.sycl_queue, stream)
+        if legacy:
+            return c_dlpack.to_dlpack_capsule(ary, to_host)
+        return c_dlpack.to_dlpack_versioned_capsule(ary, copied, to_host)
 
     def __dlpack_device__(self):
         """
@@ -1133,6 +1235,7 @@ cdef class usm_ndarray:
         from ._copy_utils import (
             _copy_from_numpy_into,
             _copy_from_usm_ndarray_to_usm_ndarray,
+            _fill_with_python_scalar,
             _nonzero_impl,
             _place_impl,
             _put_multi_index,
@@ -1157,6 +1260,10 @@ cdef class usm_ndarray:
                             "converted to usm_ndarray"
                         )
                 else:
+                    if isinstance(
+                        rhs, (bool, int, float, complex)
+                    ) and _fill_with_python_scalar(Xv, rhs):
+                        return
                     rhs_np = np.asarray(rhs)
                     if type_bytesize(rhs_np.dtype.num) < 0:
                         raise ValueError(
@@ -1266,11 +1373,10 @@ cdef class usm_ndarray:
         return self
 
     def __ifloordiv__(self, other):
-        res = self.__floordiv__(other)
-        if res is NotImplemented:
-            return res
-        self.__setitem__(Ellipsis, res)
-        return self
+        from ._elementwise_funcs import floor_divide
+        return _inplace_binary_elementwise(
+            self, floor_divide, other, self.__floordiv__
+        )
 
     def __ilshift__(self, other):
         res = self.__lshift__(other)
@@ -1305,11 +1411,10 @@ cdef class usm_ndarray:
         return self
 
     def __ipow__(self, other):
-        res = self.__pow__(other, None)
-        if res is NotImplemented:
-            return res
-        self.__setitem__(Ellipsis, res)
-        return self
+        from ._elementwise_funcs import pow
+        return _inplace_binary_elementwise(
+            self, pow, other, lambda o: self.__pow__(o, None)
+        )
 
     def __irshift__(self, other):
         res = self.__rshift__(other)
@@ -1323,11 +1428,10 @@ cdef class usm_ndarray:
         return subtract._inplace(self, other)
 
     def __itruediv__(self, other):
-        res = self.__truediv__(other)
-        if res is NotImplemented:
-            return res
-        self.__setitem__(Ellipsis, res)
-        return self
+        from ._elementwise_funcs import divide
+        return _inplace_binary_elementwise(
+            self, divide, other, self.__truediv__
+        )
 
     def __ixor__(self, other):
         res = self.__xor__(other)
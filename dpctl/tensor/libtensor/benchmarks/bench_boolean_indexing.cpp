@@ -0,0 +1,110 @@
+//===-- bench_boolean_indexing.cpp - Benchmarks of mask scan ------*-C++-*-===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// Benchmarks of the inclusive scan of boolean masks used by boolean advanced
+/// indexing, for contiguous and strided masks.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "kernels/boolean_advanced_indexing.hpp"
+
+namespace
+{
+
+namespace py = pybind11;
+namespace bench_ns = dpctl::tensor::benchmarks;
+namespace indexing_ns = dpctl::tensor::kernels::indexing;
+
+/*! Mask positions computation is blocking, since the number of non-zero
+    elements is returned to the host. */
+template <typename ScanFnT>
+void run_timed_blocking(benchmark::State &state, ScanFnT &&scan_fn)
+{
+    benchmark::DoNotOptimize(scan_fn());
+
+    for (auto _ : state) {
+        auto start = std::chrono::high_resolution_clock::now();
+        benchmark::DoNotOptimize(scan_fn());
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::chrono::duration<double> elapsed = end - start;
+        state.SetIterationTime(elapsed.count());
+    }
+}
+
+void BM_mask_positions_contig(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    std::vector<char> mask_host(n);
+    for (size_t i = 0; i < n; ++i) {
+        mask_host[i] = static_cast<char>((i % 3) == 0);
+    }
+    bench_ns::usm_device_vector<char> mask(q, mask_host);
+    bench_ns::usm_device_vector<std::int64_t> cumsum(q, n);
+
+    run_timed_blocking(state, [&]() {
+        return indexing_ns::mask_positions_contig_impl<bool, std::int64_t>(
+            q, n, mask.data(), cumsum.data(), {});
+    });
+    bench_ns::set_throughput_counters(state, n,
+                                      sizeof(bool) + sizeof(std::int64_t));
+}
+
+/*! Mask is every other element of a boolean vector of size 2*n. */
+void BM_mask_positions_strided(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    std::vector<char> mask_host(2 * n);
+    for (size_t i = 0; i < 2 * n; ++i) {
+        mask_host[i] = static_cast<char>((i % 3) == 0);
+    }
+    bench_ns::usm_device_vector<char> mask(q, mask_host);
+    bench_ns::usm_device_vector<std::int64_t> cumsum(q, n);
+
+    const std::vector<py::ssize_t> shape_strides_host = {
+        static_cast<py::ssize_t>(n), 2};
+    bench_ns::usm_device_vector<py::ssize_t> shape_strides(q,
+                                                           shape_strides_host);
+
+    constexpr int nd = 1;
+    run_timed_blocking(state, [&]() {
+        return indexing_ns::mask_positions_strided_impl<bool, std::int64_t>(
+            q, n, mask.data(), nd, 0, shape_strides.get(), cumsum.data(), {});
+    });
+    bench_ns::set_throughput_counters(state, n,
+                                      sizeof(bool) + sizeof(std::int64_t));
+}
+
+} // end of anonymous namespace
+
+BENCHMARK(BM_mask_positions_contig) DPCTL_BENCH_SIZES;
+BENCHMARK(BM_mask_positions_strided) DPCTL_BENCH_SIZES;
@@ -0,0 +1,125 @@
+//===-- bench_copy_and_cast.cpp - Benchmarks of copy kernels -----*-C++-*-===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// Benchmarks of kernels copying arrays with type casting, for contiguous and
+/// strided arrays.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "kernels/copy_and_cast.hpp"
+#include "utils/offset_utils.hpp"
+
+namespace
+{
+
+namespace py = pybind11;
+namespace bench_ns = dpctl::tensor::benchmarks;
+namespace copy_ns = dpctl::tensor::kernels::copy_and_cast;
+namespace offset_ns = dpctl::tensor::offset_utils;
+
+template <typename srcT, typename dstT>
+void BM_copy_and_cast_contig(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<srcT>(q) ||
+        !bench_ns::type_supported<dstT>(q))
+    {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<srcT> src(q, n);
+    bench_ns::usm_device_vector<dstT> dst(q, n);
+    src.fill(srcT(1));
+
+    bench_ns::run_timed(state, [&]() {
+        return copy_ns::copy_and_cast_contig_impl<dstT, srcT>(
+            q, n, src.data(), dst.data(), {});
+    });
+    bench_ns::set_throughput_counters(state, n, sizeof(srcT) + sizeof(dstT));
+}
+
+/*! Copies transposed square matrix with n elements into C-contiguous
+    matrix, e.g. dpt.asarray(x.T, order="C"). */
+template <typename srcT, typename dstT>
+void BM_copy_and_cast_strided(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<srcT>(q) ||
+        !bench_ns::type_supported<dstT>(q))
+    {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+    size_t side = 1;
+    while (side * side < n) {
+        ++side;
+    }
+    const size_t nelems = side * side;
+
+    bench_ns::usm_device_vector<srcT> src(q, nelems);
+    bench_ns::usm_device_vector<dstT> dst(q, nelems);
+    src.fill(srcT(1));
+
+    const py::ssize_t s = static_cast<py::ssize_t>(side);
+    // common shape, source strides, destination strides, divisors of the
+    // shape
+    const std::vector<py::ssize_t> shape = {s, s};
+    std::vector<py::ssize_t> shape_strides_host = {s, s, 1, s, s, 1};
+    const auto divisors = offset_ns::fast_divisors(shape);
+    shape_strides_host.insert(shape_strides_host.end(), divisors.begin(),
+                              divisors.end());
+    bench_ns::usm_device_vector<py::ssize_t> shape_strides(q,
+                                                           shape_strides_host);
+
+    constexpr int nd = 2;
+    // index arithmetic in py::ssize_t, as for arrays with large offsets
+    constexpr bool use_int32_indexing = false;
+    bench_ns::run_timed(state, [&]() {
+        return copy_ns::copy_and_cast_generic_impl<dstT, srcT>(
+            q, nelems, nd, shape_strides.get(), use_int32_indexing, src.data(),
+            0, dst.data(), 0, {}, {});
+    });
+    bench_ns::set_throughput_counters(state, nelems,
+                                      sizeof(srcT) + sizeof(dstT));
+}
+
+} // end of anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_copy_and_cast_contig, float, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_copy_and_cast_contig, float, double) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_copy_and_cast_contig, std::int32_t, float)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_copy_and_cast_contig, bool, std::int64_t)
+DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_copy_and_cast_strided, float, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_copy_and_cast_strided, float, double) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_copy_and_cast_strided, std::int32_t, float)
+DPCTL_BENCH_SIZES;
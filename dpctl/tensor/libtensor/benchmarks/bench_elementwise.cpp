@@ -0,0 +1,293 @@
+//===-- bench_elementwise.cpp - Benchmarks of elementwise kernels -*-C++-*-===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// Benchmarks of binary elementwise kernels for contiguous, strided and
+/// broadcast inputs, and of unary elementwise kernels.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <benchmark/benchmark.h>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "kernels/elementwise_functions/add.hpp"
+#include "kernels/elementwise_functions/sqrt.hpp"
+#include "utils/offset_utils.hpp"
+
+namespace
+{
+
+namespace py = pybind11;
+namespace bench_ns = dpctl::tensor::benchmarks;
+namespace add_ns = dpctl::tensor::kernels::add;
+namespace sqrt_ns = dpctl::tensor::kernels::sqrt;
+namespace offset_ns = dpctl::tensor::offset_utils;
+
+template <typename T> void BM_add_contig(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<T> x1(q, n), x2(q, n), res(q, n);
+    x1.fill(T(1));
+    x2.fill(T(2));
+
+    bench_ns::run_timed(state, [&]() {
+        return add_ns::add_contig_impl<T, T>(q, n, x1.data(), 0, x2.data(), 0,
+                                             res.data(), 0, {});
+    });
+    bench_ns::set_throughput_counters(state, n, 3 * sizeof(T));
+}
+
+/*! Inputs are every other element of arrays of size 2*n, as is the case
+    for x[::2] + y[::2] in Python. */
+template <typename T> void BM_add_strided(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<T> x1(q, 2 * n), x2(q, 2 * n), res(q, n);
+    x1.fill(T(1));
+    x2.fill(T(2));
+
+    // common shape, strides of x1, x2 and res, divisors of the shape
+    const std::vector<py::ssize_t> shape{static_cast<py::ssize_t>(n)};
+    std::vector<py::ssize_t> shape_strides_host = {shape[0], 2, 2, 1};
+    const auto divisors = offset_ns::fast_divisors(shape);
+    shape_strides_host.insert(shape_strides_host.end(), divisors.begin(),
+                              divisors.end());
+    bench_ns::usm_device_vector<py::ssize_t> shape_strides(q,
+                                                           shape_strides_host);
+
+    constexpr int nd = 1;
+    // index arithmetic in py::ssize_t, as for arrays with large offsets
+    constexpr bool use_int32_indexing = false;
+    bench_ns::run_timed(state, [&]() {
+        return add_ns::add_strided_impl<T, T>(
+            q, n, nd, shape_strides.get(), use_int32_indexing, x1.data(), 0,
+            x2.data(), 0, res.data(), 0, {}, {});
+    });
+    bench_ns::set_throughput_counters(state, n, 3 * sizeof(T));
+}
+
+template <typename T, typename IndexerT> class add_strided_3d_bench_krn;
+
+/*! Adds transposes of two cubes with n elements, as is the case for
+    dpt.permute_dims(x, (2, 1, 0)) + dpt.permute_dims(y, (2, 1, 0)) in
+    Python, with the strided indexer `IndexerT`. Compares decomposition of
+    flat indices by division (ThreeOffsets_StridedIndexer) with decomposition
+    by multiplication with precomputed inverses of the shape
+    (ThreeOffsets_FastDivStridedIndexer). */
+template <typename T, typename IndexerT>
+void BM_add_strided_3d(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+    size_t side = 1;
+    while (side * side * side < n) {
+        ++side;
+    }
+    const size_t nelems = side * side * side;
+
+    bench_ns::usm_device_vector<T> x1(q, nelems), x2(q, nelems),
+        res(q, nelems);
+    x1.fill(T(1));
+    x2.fill(T(2));
+
+    const py::ssize_t s = static_cast<py::ssize_t>(side);
+    // common shape, strides of x1, x2 and res, divisors of the shape
+    const std::vector<py::ssize_t> shape = {s, s, s};
+    std::vector<py::ssize_t> shape_strides_host = {
+        s, s, s, 1, s, s * s, 1, s, s * s, s * s, s, 1};
+    const auto divisors = offset_ns::fast_divisors(shape);
+    shape_strides_host.insert(shape_strides_host.end(), divisors.begin(),
+                              divisors.end());
+    bench_ns::usm_device_vector<py::ssize_t> shape_strides(q,
+                                                           shape_strides_host);
+
+    constexpr int nd = 3;
+    bench_ns::run_timed(state, [&]() {
+        return q.submit([&](sycl::handler &cgh) {
+            const IndexerT indexer{nd, 0, 0, 0, shape_strides.get()};
+            cgh.parallel_for<add_strided_3d_bench_krn<T, IndexerT>>(
+                {nelems}, add_ns::AddStridedFunctor<T, T, T, IndexerT>(
+                              x1.data(), x2.data(), res.data(), indexer));
+        });
+    });
+    bench_ns::set_throughput_counters(state, nelems, 3 * sizeof(T));
+}
+
+template <typename T, typename indT> class add_fixed_rank_3d_bench_krn;
+
+/*! Adds transposes of two cubes with n elements as BM_add_strided_3d, with
+    the rank-3 indexer performing index arithmetic in type `indT`, as
+    selected for arrays whose offsets fit in std::int32_t. */
+template <typename T, typename indT>
+void BM_add_fixed_rank_3d(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+    size_t side = 1;
+    while (side * side * side < n) {
+        ++side;
+    }
+    const size_t nelems = side * side * side;
+
+    bench_ns::usm_device_vector<T> x1(q, nelems), x2(q, nelems),
+        res(q, nelems);
+    x1.fill(T(1));
+    x2.fill(T(2));
+
+    const py::ssize_t s = static_cast<py::ssize_t>(side);
+    // common shape, strides of x1, x2 and res, divisors of the shape
+    const std::vector<py::ssize_t> shape = {s, s, s};
+    std::vector<py::ssize_t> shape_strides_host = {
+        s, s, s, 1, s, s * s, 1, s, s * s, s * s, s, 1};
+    const auto divisors = offset_ns::fast_divisors(shape);
+    shape_strides_host.insert(shape_strides_host.end(), divisors.begin(),
+                              divisors.end());
+    bench_ns::usm_device_vector<py::ssize_t> shape_strides(q,
+                                                           shape_strides_host);
+
+    using IndexerT = offset_ns::ThreeOffsets_FixedRankStridedIndexer<3, indT>;
+    bench_ns::run_timed(state, [&]() {
+        return q.submit([&](sycl::handler &cgh) {
+            const IndexerT indexer{0, 0, 0, shape_strides.get()};
+            cgh.parallel_for<add_fixed_rank_3d_bench_krn<T, indT>>(
+                {nelems}, add_ns::AddStridedFunctor<T, T, T, IndexerT>(
+                              x1.data(), x2.data(), res.data(), indexer));
+        });
+    });
+    bench_ns::set_throughput_counters(state, nelems, 3 * sizeof(T));
+}
+
+/*! Adds row of size 1024 to a C-contiguous matrix with n elements. */
+template <typename T> void BM_add_row_broadcast(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+    constexpr size_t n1 = 1024;
+    const size_t n0 = std::max<size_t>(1, n / n1);
+
+    bench_ns::usm_device_vector<T> mat(q, n0 * n1), row(q, n1),
+        res(q, n0 * n1);
+    mat.fill(T(1));
+    row.fill(T(2));
+
+    bench_ns::run_timed(state, [&]() {
+        std::vector<sycl::event> host_tasks;
+        sycl::event comp_ev =
+            add_ns::add_contig_matrix_contig_row_broadcast_impl<T, T, T>(
+                q, host_tasks, n0, n1, mat.data(), 0, row.data(), 0,
+                res.data(), 0, {});
+        // include release of temporaries in the measurement
+        sycl::event::wait(host_tasks);
+        return comp_ev;
+    });
+    bench_ns::set_throughput_counters(state, n0 * n1, 2 * sizeof(T));
+}
+
+template <typename T> void BM_sqrt_contig(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<T> x(q, n), res(q, n);
+    x.fill(T(4));
+
+    bench_ns::run_timed(state, [&]() {
+        return sqrt_ns::sqrt_contig_impl<T>(q, n, x.data(), res.data(), {});
+    });
+    bench_ns::set_throughput_counters(state, n, 2 * sizeof(T));
+}
+
+} // end of anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_add_contig, std::int8_t) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_contig, std::int32_t) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_contig, std::int64_t) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_contig, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_contig, double) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_contig, std::complex<float>) DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_add_strided, std::int32_t) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_strided, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_strided, double) DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_add_strided_3d,
+                   float,
+                   offset_ns::ThreeOffsets_StridedIndexer)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_strided_3d,
+                   float,
+                   offset_ns::ThreeOffsets_FastDivStridedIndexer)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_strided_3d,
+                   double,
+                   offset_ns::ThreeOffsets_StridedIndexer)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_strided_3d,
+                   double,
+                   offset_ns::ThreeOffsets_FastDivStridedIndexer)
+DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_add_fixed_rank_3d, float, py::ssize_t)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_fixed_rank_3d, float, std::int32_t)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_fixed_rank_3d, double, py::ssize_t)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_fixed_rank_3d, double, std::int32_t)
+DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_add_row_broadcast, std::int32_t) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_row_broadcast, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_add_row_broadcast, double) DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_sqrt_contig, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_sqrt_contig, double) DPCTL_BENCH_SIZES;
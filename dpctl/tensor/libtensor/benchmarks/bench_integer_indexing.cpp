@@ -0,0 +1,148 @@
+//===-- bench_integer_indexing.cpp - Benchmarks of take and put ---*-C++-*-===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// Benchmarks of take and put kernels used by integer advanced indexing of
+/// one-dimensional arrays with one-dimensional array of indices.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "kernels/integer_advanced_indexing.hpp"
+
+namespace
+{
+
+namespace py = pybind11;
+namespace bench_ns = dpctl::tensor::benchmarks;
+namespace indexing_ns = dpctl::tensor::kernels::indexing;
+
+/*! @brief Kernel parameters describing x[ind] for vectors x and ind, packed
+    the same way as _tensor_impl._take does. */
+struct VectorIndexingParams
+{
+    bench_ns::usm_device_vector<py::ssize_t> orthog_shape_strides;
+    bench_ns::usm_device_vector<py::ssize_t> axes_shape_strides;
+    bench_ns::usm_device_vector<py::ssize_t> ind_shape_strides;
+    bench_ns::usm_device_vector<py::ssize_t> ind_offsets;
+    bench_ns::usm_device_vector<char *> ind_ptrs;
+
+    VectorIndexingParams(sycl::queue &q,
+                         size_t x_size,
+                         size_t ind_size,
+                         char *ind_data)
+        : orthog_shape_strides(q, std::vector<py::ssize_t>{1, 0, 0}),
+          axes_shape_strides(q,
+                             std::vector<py::ssize_t>{
+                                 static_cast<py::ssize_t>(x_size), 1,
+                                 static_cast<py::ssize_t>(ind_size), 1}),
+          ind_shape_strides(q,
+                            std::vector<py::ssize_t>{
+                                static_cast<py::ssize_t>(ind_size), 1}),
+          ind_offsets(q, std::vector<py::ssize_t>{0}),
+          ind_ptrs(q, std::vector<char *>{ind_data})
+    {
+    }
+};
+
+template <typename T, typename indT>
+std::vector<indT> make_random_indices(size_t n, size_t max_ind)
+{
+    std::vector<indT> ind(n);
+    // linear congruential generator gives reproducible scattered accesses
+    std::uint64_t state = 12345;
+    for (size_t i = 0; i < n; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        ind[i] = static_cast<indT>((state >> 33) % max_ind);
+    }
+    return ind;
+}
+
+template <typename T, typename indT> void BM_take(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<T> x(q, n), res(q, n);
+    x.fill(T(1));
+    bench_ns::usm_device_vector<indT> ind(q,
+                                          make_random_indices<T, indT>(n, n));
+    VectorIndexingParams params(q, n, n, ind.data());
+
+    constexpr size_t orthog_nelems = 1;
+    constexpr int nd = 1;
+    constexpr int ind_nd = 1;
+    constexpr int k = 1;
+    bench_ns::run_timed(state, [&]() {
+        return indexing_ns::take_impl<indexing_ns::WrapIndex, T, indT>(
+            q, orthog_nelems, n, nd, ind_nd, k,
+            params.orthog_shape_strides.get(), params.axes_shape_strides.get(),
+            params.ind_shape_strides.get(), x.data(), res.data(),
+            params.ind_ptrs.get(), 0, 0, params.ind_offsets.get(), {});
+    });
+    bench_ns::set_throughput_counters(state, n, 2 * sizeof(T) + sizeof(indT));
+}
+
+template <typename T, typename indT> void BM_put(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<T> x(q, n), vals(q, n);
+    vals.fill(T(1));
+    bench_ns::usm_device_vector<indT> ind(q,
+                                          make_random_indices<T, indT>(n, n));
+    VectorIndexingParams params(q, n, n, ind.data());
+
+    constexpr size_t orthog_nelems = 1;
+    constexpr int nd = 1;
+    constexpr int ind_nd = 1;
+    constexpr int k = 1;
+    bench_ns::run_timed(state, [&]() {
+        return indexing_ns::put_impl<indexing_ns::ClipIndex, T, indT>(
+            q, orthog_nelems, n, nd, ind_nd, k,
+            params.orthog_shape_strides.get(), params.axes_shape_strides.get(),
+            params.ind_shape_strides.get(), x.data(), vals.data(),
+            params.ind_ptrs.get(), 0, 0, params.ind_offsets.get(), {});
+    });
+    bench_ns::set_throughput_counters(state, n, 2 * sizeof(T) + sizeof(indT));
+}
+
+} // end of anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_take, float, std::int64_t) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_take, double, std::int64_t) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_take, float, std::int32_t) DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_put, float, std::int64_t) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_put, double, std::int64_t) DPCTL_BENCH_SIZES;
@@ -0,0 +1,122 @@
+//===-- bench_linalg.cpp - Benchmarks of linear algebra kernels ---*-C++-*-===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// Benchmarks of matrix multiplication and dot product kernels.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "kernels/linalg_functions/dot_product.hpp"
+#include "kernels/linalg_functions/gemm.hpp"
+
+namespace
+{
+
+namespace py = pybind11;
+namespace bench_ns = dpctl::tensor::benchmarks;
+namespace linalg_ns = dpctl::tensor::kernels::linalg;
+
+/*! Multiplies square C-contiguous matrices of given size. */
+template <typename T> void BM_gemm(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+    const py::ssize_t s = static_cast<py::ssize_t>(n);
+
+    bench_ns::usm_device_vector<T> x1(q, n * n), x2(q, n * n), res(q, n * n);
+    x1.fill(T(1));
+    x2.fill(T(1));
+
+    // batch of a single matrix
+    const std::vector<py::ssize_t> batch_shape_strides_host = {1, 0, 0, 0};
+    bench_ns::usm_device_vector<py::ssize_t> batch_shape_strides(
+        q, batch_shape_strides_host);
+
+    constexpr size_t batch_nelems = 1;
+    constexpr int batch_nd = 1;
+    bench_ns::run_timed(state, [&]() {
+        return linalg_ns::gemm_batch_impl<T, T, T>(
+            q, x1.data(), x2.data(), res.data(), batch_nelems, n, n, n,
+            batch_nd, batch_shape_strides.get(), 0, 0, 0, s, 1, s, 1, s, 1,
+            {});
+    });
+    state.counters["flops"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * 2.0 * n * n * n,
+        benchmark::Counter::kIsRate);
+}
+
+/*! Computes single dot product of contiguous vectors. */
+template <typename T> void BM_dot_product(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<T> x1(q, n), x2(q, n), res(q, 1);
+    x1.fill(T(1));
+    x2.fill(T(1));
+
+    const std::vector<py::ssize_t> batch_shape_strides_host = {1, 0, 0, 0};
+    bench_ns::usm_device_vector<py::ssize_t> batch_shape_strides(
+        q, batch_shape_strides_host);
+
+    constexpr size_t batch_nelems = 1;
+    constexpr int batch_nd = 1;
+    bench_ns::run_timed(state, [&]() {
+        return linalg_ns::dot_product_impl<T, T, T>(
+            q, batch_nelems, n, x1.data(), x2.data(), res.data(), batch_nd,
+            batch_shape_strides.get(), 0, 0, 0, 1, 1, {});
+    });
+    bench_ns::set_throughput_counters(state, n, 2 * sizeof(T));
+}
+
+} // end of anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_gemm, float)
+    ->RangeMultiplier(2)
+    ->Range(64, 1024)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_gemm, double)
+    ->RangeMultiplier(2)
+    ->Range(64, 1024)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_gemm, std::int32_t)
+    ->RangeMultiplier(2)
+    ->Range(64, 1024)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_dot_product, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_dot_product, double) DPCTL_BENCH_SIZES;
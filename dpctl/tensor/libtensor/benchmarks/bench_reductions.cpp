@@ -0,0 +1,246 @@
+//===-- bench_reductions.cpp - Benchmarks of reduction kernels ---*-C++-*-===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// Benchmarks of sum reduction kernels, comparing implementation using atomic
+/// updates with implementation using temporary allocations, and with the
+/// deterministic compensated summation.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "kernels/reductions.hpp"
+
+namespace
+{
+
+namespace py = pybind11;
+namespace bench_ns = dpctl::tensor::benchmarks;
+namespace krn_ns = dpctl::tensor::kernels;
+
+/*! Sums all elements of a contiguous vector with atomic updates. */
+template <typename argT, typename resT>
+void BM_sum_atomic_contig(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<argT>(q) ||
+        !bench_ns::type_supported<resT>(q))
+    {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<argT> x(q, n);
+    bench_ns::usm_device_vector<resT> res(q, 1);
+    x.fill(argT(1));
+
+    constexpr size_t iter_nelems = 1;
+    bench_ns::run_timed(state, [&]() {
+        return krn_ns::sum_reduction_over_group_with_atomics_contig_impl<argT,
+                                                                         resT>(
+            q, iter_nelems, n, x.data(), res.data(), 0, 0, 0, {});
+    });
+    bench_ns::set_throughput_counters(state, n, sizeof(argT));
+}
+
+/*! Sums all elements of a contiguous vector using the implementation
+    with temporaries, which is used when atomics are not available. */
+template <typename argT, typename resT>
+void BM_sum_temps(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<argT>(q) ||
+        !bench_ns::type_supported<resT>(q))
+    {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<argT> x(q, n);
+    bench_ns::usm_device_vector<resT> res(q, 1);
+    x.fill(argT(1));
+
+    // iteration shape, source and destination strides, followed by
+    // reduction shape and source strides
+    const std::vector<py::ssize_t> packed_host = {
+        1, 0, 0, static_cast<py::ssize_t>(n), 1};
+    bench_ns::usm_device_vector<py::ssize_t> packed(q, packed_host);
+
+    constexpr size_t iter_nelems = 1;
+    constexpr int iter_nd = 1;
+    constexpr int red_nd = 1;
+    bench_ns::run_timed(state, [&]() {
+        return krn_ns::sum_reduction_over_group_temps_strided_impl<argT, resT>(
+            q, iter_nelems, n, x.data(), res.data(), iter_nd, packed.get(), 0,
+            0, red_nd, packed.get() + 3 * iter_nd, 0, {});
+    });
+    bench_ns::set_throughput_counters(state, n, sizeof(argT));
+}
+
+/*! Sums rows of a C-contiguous matrix with 64 columns, so that many short
+    reductions are computed. */
+template <typename argT, typename resT>
+void BM_sum_atomic_rows(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<argT>(q) ||
+        !bench_ns::type_supported<resT>(q))
+    {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+    constexpr size_t n_cols = 64;
+    const size_t n_rows = std::max<size_t>(1, n / n_cols);
+
+    bench_ns::usm_device_vector<argT> x(q, n_rows * n_cols);
+    bench_ns::usm_device_vector<resT> res(q, n_rows);
+    x.fill(argT(1));
+
+    bench_ns::run_timed(state, [&]() {
+        return krn_ns::sum_reduction_over_group_with_atomics_contig_impl<argT,
+                                                                         resT>(
+            q, n_rows, n_cols, x.data(), res.data(), 0, 0, 0, {});
+    });
+    bench_ns::set_throughput_counters(state, n_rows * n_cols, sizeof(argT));
+}
+
+/*! Sums columns of a C-contiguous matrix with 64 columns, reducing over
+    the strided axis with work-items along the contiguous one. */
+template <typename argT, typename resT>
+void BM_sum_strided_axis(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<argT>(q) ||
+        !bench_ns::type_supported<resT>(q))
+    {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+    constexpr size_t n_cols = 64;
+    const size_t n_rows = std::max<size_t>(1, n / n_cols);
+
+    bench_ns::usm_device_vector<argT> x(q, n_rows * n_cols);
+    bench_ns::usm_device_vector<resT> res(q, n_cols);
+    x.fill(argT(1));
+
+    bench_ns::run_timed(state, [&]() {
+        return krn_ns::sum_reduction_over_strided_axis_impl<argT, resT>(
+            q, n_cols, n_rows, x.data(), res.data(), 0, 0, 0,
+            static_cast<py::ssize_t>(n_cols), {});
+    });
+    bench_ns::set_throughput_counters(state, n_rows * n_cols, sizeof(argT));
+}
+
+/*! Sums all elements of a contiguous vector with deterministic compensated
+    summation, reading elements with sub-group block loads. */
+template <typename argT, typename resT>
+void BM_sum_compensated_contig(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<argT>(q) ||
+        !bench_ns::type_supported<resT>(q))
+    {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<argT> x(q, n);
+    bench_ns::usm_device_vector<resT> res(q, 1);
+    x.fill(argT(1));
+
+    constexpr size_t iter_nelems = 1;
+    bench_ns::run_timed(state, [&]() {
+        return krn_ns::sum_reduction_compensated_contig_impl<argT, resT>(
+            q, iter_nelems, n, x.data(), res.data(), 0, 0, 0, {});
+    });
+    bench_ns::set_throughput_counters(state, n, sizeof(argT));
+}
+
+/*! Sums all elements of a vector with deterministic compensated summation,
+    with the reduced axis described by packed shape and strides. */
+template <typename argT, typename resT>
+void BM_sum_compensated_strided(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<argT>(q) ||
+        !bench_ns::type_supported<resT>(q))
+    {
+        state.SkipWithError("Data type is not supported by device");
+        return;
+    }
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_device_vector<argT> x(q, n);
+    bench_ns::usm_device_vector<resT> res(q, 1);
+    x.fill(argT(1));
+
+    // iteration shape, source and destination strides, followed by
+    // reduction shape and source strides
+    const std::vector<py::ssize_t> packed_host = {
+        1, 0, 0, static_cast<py::ssize_t>(n), 1};
+    bench_ns::usm_device_vector<py::ssize_t> packed(q, packed_host);
+
+    constexpr size_t iter_nelems = 1;
+    constexpr int iter_nd = 1;
+    constexpr int red_nd = 1;
+    bench_ns::run_timed(state, [&]() {
+        return krn_ns::sum_reduction_compensated_strided_impl<argT, resT>(
+            q, iter_nelems, n, x.data(), res.data(), iter_nd, packed.get(), 0,
+            0, red_nd, packed.get() + 3 * iter_nd, 0, {});
+    });
+    bench_ns::set_throughput_counters(state, n, sizeof(argT));
+}
+
+} // end of anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_sum_atomic_contig, std::int32_t, std::int64_t)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_sum_atomic_contig, float, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_sum_atomic_contig, double, double) DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_sum_temps, std::int32_t, std::int64_t)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_sum_temps, float, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_sum_temps, double, double) DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_sum_atomic_rows, float, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_sum_atomic_rows, double, double) DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_sum_strided_axis, float, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_sum_strided_axis, double, double) DPCTL_BENCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_sum_compensated_contig, float, float) DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_sum_compensated_contig, double, double)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_sum_compensated_strided, float, float)
+DPCTL_BENCH_SIZES;
+BENCHMARK_TEMPLATE(BM_sum_compensated_strided, double, double)
+DPCTL_BENCH_SIZES;
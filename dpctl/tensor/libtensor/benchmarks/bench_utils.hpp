@@ -0,0 +1,187 @@
+//===-- bench_utils.hpp - Common utilities of benchmarks ---------*-C++-*-===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines helpers shared by micro-benchmarks of libtensor kernels:
+/// selection of the benchmarked device, RAII ownership of USM allocations and
+/// timing of submitted kernels.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "pybind11/pybind11.h"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace benchmarks
+{
+
+namespace py = pybind11;
+
+/*! @brief Returns queue used by all benchmarks.
+
+  The OpenCL CPU device is used, since it is available on every
+  development machine and gives stable timings. Setting environment
+  variable DPCTL_BENCH_USE_DEFAULT_DEVICE to 1 makes benchmarks run on the
+  device chosen by the default selector instead.
+ */
+inline sycl::queue &get_bench_queue()
+{
+    static sycl::queue q = []() {
+        const char *use_default = std::getenv("DPCTL_BENCH_USE_DEFAULT_DEVICE");
+        if (use_default == nullptr || std::string(use_default) != "1") {
+            for (const auto &d : sycl::device::get_devices()) {
+                if (d.is_cpu() && d.get_backend() == sycl::backend::opencl) {
+                    return sycl::queue(d, sycl::property::queue::in_order());
+                }
+            }
+        }
+        return sycl::queue(sycl::default_selector_v,
+                           sycl::property::queue::in_order());
+    }();
+    return q;
+}
+
+/*! @brief Returns true if type T can be used on device of the queue. */
+template <typename T> bool type_supported(const sycl::queue &q)
+{
+    const sycl::device &d = q.get_device();
+    if constexpr (std::is_same_v<T, double> ||
+                  std::is_same_v<T, std::complex<double>>)
+    {
+        return d.has(sycl::aspect::fp64);
+    }
+    else if constexpr (std::is_same_v<T, sycl::half>) {
+        return d.has(sycl::aspect::fp16);
+    }
+    else {
+        return true;
+    }
+}
+
+/*! @brief Owner of USM device allocation of `n` elements of type T. */
+template <typename T> class usm_device_vector
+{
+public:
+    usm_device_vector(sycl::queue &q, size_t n) : q_(q), n_(n)
+    {
+        ptr_ = sycl::malloc_device<T>(std::max<size_t>(n, 1), q_);
+        if (ptr_ == nullptr) {
+            throw std::bad_alloc();
+        }
+    }
+
+    usm_device_vector(sycl::queue &q, const std::vector<T> &host_data)
+        : usm_device_vector(q, host_data.size())
+    {
+        q_.copy<T>(host_data.data(), ptr_, n_).wait();
+    }
+
+    usm_device_vector(const usm_device_vector &) = delete;
+    usm_device_vector &operator=(const usm_device_vector &) = delete;
+
+    ~usm_device_vector()
+    {
+        sycl::free(ptr_, q_);
+    }
+
+    void fill(const T &val)
+    {
+        q_.fill<T>(ptr_, val, n_).wait();
+    }
+
+    T *get()
+    {
+        return ptr_;
+    }
+    char *data()
+    {
+        return reinterpret_cast<char *>(ptr_);
+    }
+    size_t size() const
+    {
+        return n_;
+    }
+
+private:
+    sycl::queue q_;
+    size_t n_;
+    T *ptr_ = nullptr;
+};
+
+/*! @brief Runs `submit_fn` in benchmark loop, reporting host wall-clock
+  time of each iteration.
+
+  `submit_fn` must return the event of the last submitted kernel. Timing
+  is measured on the host from before submission until completion of
+  the event, so it includes submission overhead and all kernels submitted
+  by `submit_fn`, which is what users of dpctl.tensor observe.
+ */
+template <typename SubmitFnT>
+void run_timed(benchmark::State &state, SubmitFnT &&submit_fn)
+{
+    // warm-up, also triggers JIT compilation of the kernel
+    submit_fn().wait();
+
+    for (auto _ : state) {
+        auto start = std::chrono::high_resolution_clock::now();
+        submit_fn().wait();
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::chrono::duration<double> elapsed = end - start;
+        state.SetIterationTime(elapsed.count());
+    }
+}
+
+/*! @brief Records processed bytes and elements of the benchmark. */
+inline void set_throughput_counters(benchmark::State &state,
+                                    size_t nelems,
+                                    size_t bytes_per_elem)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(nelems));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(nelems * bytes_per_elem));
+}
+
+// Sizes of benchmarked arrays, from latency bound to bandwidth bound
+#define DPCTL_BENCH_SIZES                                                      \
+    ->RangeMultiplier(16)                                                      \
+        ->Range(1 << 10, 1 << 24)                                              \
+        ->UseManualTime()                                                      \
+        ->Unit(benchmark::kMicrosecond)
+
+} // namespace benchmarks
+} // namespace tensor
+} // namespace dpctl
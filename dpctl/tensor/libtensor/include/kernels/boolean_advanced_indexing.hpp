@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "utils/offset_utils.hpp"
+#include "utils/scratch_allocator.hpp"
 #include "utils/type_dispatch.hpp"
 
 namespace dpctl
@@ -176,7 +177,9 @@ sycl::event inclusive_scan_rec(sycl::queue exec_q,
 
     sycl::event out_event = inc_scan_phase1_ev;
     if (n_groups > 1) {
-        outputT *temp = sycl::malloc_device<outputT>(n_groups - 1, exec_q);
+        using dpctl::tensor::alloc_utils::scratch_allocation;
+        scratch_allocation<outputT> temp_tmp(exec_q, n_groups - 1);
+        outputT *temp = temp_tmp.get();
 
         auto chunk_size = wg_size * n_wi;
 
@@ -201,11 +204,7 @@ sycl::event inclusive_scan_rec(sycl::queue exec_q,
             });
         });
 
-        sycl::event e4 = exec_q.submit([&](sycl::handler &cgh) {
-            cgh.depends_on(e3);
-            auto ctx = exec_q.get_context();
-            cgh.host_task([ctx, temp]() { sycl::free(temp, ctx); });
-        });
+        sycl::event e4 = temp_tmp.release_after(exec_q, e3);
 
         out_event = e4;
     }
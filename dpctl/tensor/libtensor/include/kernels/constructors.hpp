@@ -453,6 +453,136 @@ template <typename fnT, typename Ty> struct FullContigFactory
     }
 };
 
+typedef sycl::event (*full_strided_fn_ptr_t)(sycl::queue,
+                                             int,
+                                             size_t,
+                                             const py::ssize_t *,
+                                             py::ssize_t,
+                                             py::object,
+                                             char *,
+                                             const std::vector<sycl::event> &);
+
+template <typename Ty, typename IndexerT> class FullStridedFunctor
+{
+private:
+    Ty *p = nullptr;
+    Ty fill_v;
+    IndexerT indexer;
+
+public:
+    FullStridedFunctor(Ty *p_, Ty fill_v_, IndexerT indexer_)
+        : p(p_), fill_v(fill_v_), indexer(indexer_)
+    {
+    }
+
+    void operator()(sycl::id<1> id) const
+    {
+        auto offset = indexer(id.get(0));
+        p[offset] = fill_v;
+    }
+};
+
+template <typename Ty> class full_strided_kernel;
+
+/*!
+ * @brief Function to submit kernel to fill given strided memory allocation
+ * with specified value.
+ *
+ * @param exec_q  Sycl queue to which kernel is submitted for execution.
+ * @param nd  Array dimensionality
+ * @param nelems  Number of elements to fill
+ * @param shape_strides  Kernel accessible USM pointer to packed shape and
+ * strides of the array.
+ * @param dst_offset  Displacement of the first element of the array relative
+ * to `dst_p`, in elements.
+ * @param fill_v  Value to fill the array with
+ * @param dst_p Kernel accessible USM pointer to the start of array to be
+ * populated.
+ * @param depends  List of events to wait for before starting computations, if
+ * any.
+ *
+ * @return Event to wait on to ensure that computation completes.
+ * @defgroup CtorKernels
+ */
+template <typename dstTy>
+sycl::event full_strided_impl(sycl::queue q,
+                              int nd,
+                              size_t nelems,
+                              const py::ssize_t *shape_strides,
+                              py::ssize_t dst_offset,
+                              dstTy fill_v,
+                              char *dst_p,
+                              const std::vector<sycl::event> &depends)
+{
+    dpctl::tensor::type_utils::validate_type_for_device<dstTy>(q);
+
+    dstTy *p = reinterpret_cast<dstTy *>(dst_p);
+    StridedIndexer strided_indexer(nd, dst_offset, shape_strides);
+
+    sycl::event fill_ev = q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+        cgh.parallel_for<full_strided_kernel<dstTy>>(
+            sycl::range<1>{nelems},
+            FullStridedFunctor<dstTy, StridedIndexer>(p, fill_v,
+                                                      strided_indexer));
+    });
+
+    return fill_ev;
+}
+
+/*!
+ * @brief Function to submit kernel to fill given strided memory allocation
+ * with specified value.
+ *
+ * @param exec_q  Sycl queue to which kernel is submitted for execution.
+ * @param nd  Array dimensionality
+ * @param nelems  Number of elements to fill
+ * @param shape_strides  Kernel accessible USM pointer to packed shape and
+ * strides of the array.
+ * @param dst_offset  Displacement of the first element of the array relative
+ * to `dst_p`, in elements.
+ * @param py_value Python object representing the value to fill the array with.
+ * Must be convertible to `dstTy`.
+ * @param dst_p Kernel accessible USM pointer to the start of array to be
+ * populated.
+ * @param depends  List of events to wait for before starting computations, if
+ * any.
+ *
+ * @return Event to wait on to ensure that computation completes.
+ * @defgroup CtorKernels
+ */
+template <typename dstTy>
+sycl::event full_strided_impl(sycl::queue exec_q,
+                              int nd,
+                              size_t nelems,
+                              const py::ssize_t *shape_strides,
+                              py::ssize_t dst_offset,
+                              py::object py_value,
+                              char *dst_p,
+                              const std::vector<sycl::event> &depends)
+{
+    dstTy fill_v;
+    try {
+        fill_v = unbox_py_scalar<dstTy>(py_value);
+    } catch (const py::error_already_set &e) {
+        throw;
+    }
+
+    sycl::event fill_ev = full_strided_impl<dstTy>(
+        exec_q, nd, nelems, shape_strides, dst_offset, fill_v, dst_p, depends);
+
+    return fill_ev;
+}
+
+template <typename fnT, typename Ty> struct FullStridedFactory
+{
+    fnT get()
+    {
+        fnT f = full_strided_impl<Ty>;
+        return f;
+    }
+};
+
 /* ================ Eye ================== */
 
 typedef sycl::event (*eye_fn_ptr_t)(sycl::queue,
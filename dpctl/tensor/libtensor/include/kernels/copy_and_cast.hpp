@@ -47,6 +47,8 @@ using namespace dpctl::tensor::offset_utils;
 template <typename srcT, typename dstT, typename IndexerT>
 class copy_cast_generic_kernel;
 
+template <typename srcT, typename dstT> class copy_cast_2d_kernel;
+
 template <typename srcT,
           typename dstT,
           unsigned int vec_sz,
@@ -95,6 +97,39 @@ public:
     }
 };
 
+template <typename srcT, typename dstT, typename CastFnT>
+class Copy2DFunctor
+{
+private:
+    const srcT *src_ = nullptr;
+    dstT *dst_ = nullptr;
+    std::array<py::ssize_t, 2> src_strides_;
+    std::array<py::ssize_t, 2> dst_strides_;
+
+public:
+    Copy2DFunctor(const srcT *src_p,
+                  dstT *dst_p,
+                  const std::array<py::ssize_t, 2> &src_strides,
+                  const std::array<py::ssize_t, 2> &dst_strides)
+        : src_(src_p), dst_(dst_p), src_strides_(src_strides),
+          dst_strides_(dst_strides)
+    {
+    }
+
+    void operator()(sycl::id<2> wiid) const
+    {
+        const py::ssize_t i0 = static_cast<py::ssize_t>(wiid.get(0));
+        const py::ssize_t i1 = static_cast<py::ssize_t>(wiid.get(1));
+        const py::ssize_t src_offset =
+            i0 * src_strides_[0] + i1 * src_strides_[1];
+        const py::ssize_t dst_offset =
+            i0 * dst_strides_[0] + i1 * dst_strides_[1];
+
+        CastFnT fn{};
+        dst_[dst_offset] = fn(src_[src_offset]);
+    }
+};
+
 /*!
   @defgroup CopyAndCastKernels
  */
@@ -107,6 +142,7 @@ typedef sycl::event (*copy_and_cast_generic_fn_ptr_t)(
     size_t,
     int,
     const py::ssize_t *,
+    bool,
     const char *,
     py::ssize_t,
     char *,
@@ -119,9 +155,10 @@ typedef sycl::event (*copy_and_cast_generic_fn_ptr_t)(
  `dst` usm_ndarray while casting from `srcTy` to `dstTy`.
 
    Both arrays have array dimensionality specied via argument `nd`. The
- `shape_and_strides` is kernel accessible USM array of length `3*nd`, where the
+ `shape_and_strides` is kernel accessible USM array of length `5*nd`, where the
  first `nd` elements encode common shape, second `nd` elements contain strides
- of `src` array, and the trailing `nd` elements contain strides of `dst` array.
+ of `src` array, the next `nd` elements contain strides of `dst` array, and the
+ trailing `2*nd` elements are `fast_divisors(shape)`.
  `src_p` and `dst_p` represent pointers into respective arrays, but the start of
  iteration begins at offset of `src_offset` elements for `src` array and at
  offset `dst_offset` elements for `dst` array. Kernel is submitted to sycl queue
@@ -133,6 +170,8 @@ typedef sycl::event (*copy_and_cast_generic_fn_ptr_t)(
  identify an element of each array.
    @param  shape_and_strides  Kernel accessible USM pointer to packed shape and
  strides.
+   @param  use_int32_indexing  Whether flat indices and offsets of elements of
+ both arrays fit in std::int32_t, as computed by `offsets_fit_int32`.
    @param  src_p   Kernel accessible USM pointer for the source array
    @param  src_offset  Offset to the beginning of iteration in number of
  elements of source array from `src_p`.
@@ -153,6 +192,7 @@ copy_and_cast_generic_impl(sycl::queue q,
                            size_t nelems,
                            int nd,
                            const py::ssize_t *shape_and_strides,
+                           bool use_int32_indexing,
                            const char *src_p,
                            py::ssize_t src_offset,
                            char *dst_p,
@@ -167,17 +207,21 @@ copy_and_cast_generic_impl(sycl::queue q,
         cgh.depends_on(depends);
         cgh.depends_on(additional_depends);
 
-        TwoOffsets_StridedIndexer indexer{nd, src_offset, dst_offset,
-                                          shape_and_strides};
         const srcTy *src_tp = reinterpret_cast<const srcTy *>(src_p);
         dstTy *dst_tp = reinterpret_cast<dstTy *>(dst_p);
 
-        cgh.parallel_for<class copy_cast_generic_kernel<
-            srcTy, dstTy, TwoOffsets_StridedIndexer>>(
-            sycl::range<1>(nelems),
-            GenericCopyFunctor<srcTy, dstTy, Caster<srcTy, dstTy>,
-                               TwoOffsets_StridedIndexer>(src_tp, dst_tp,
-                                                          indexer));
+        auto submit_kernel = [&](const auto &indexer) {
+            using IndexerT = std::decay_t<decltype(indexer)>;
+            cgh.parallel_for<
+                class copy_cast_generic_kernel<srcTy, dstTy, IndexerT>>(
+                sycl::range<1>(nelems),
+                GenericCopyFunctor<srcTy, dstTy, Caster<srcTy, dstTy>,
+                                   IndexerT>(src_tp, dst_tp, indexer));
+        };
+        dispatch_fixed_rank_indexer<TwoOffsets_FixedRankStridedIndexer,
+                                    TwoOffsets_FastDivStridedIndexer>(
+            nd, use_int32_indexing, submit_kernel, src_offset, dst_offset,
+            shape_and_strides);
     });
 
     return copy_and_cast_ev;
@@ -462,6 +506,48 @@ template <typename fnT, typename D, typename S> struct CopyAndCast1DFactory
     }
 };
 
+/*!
+ * @brief Function to copy `nelems` elements of 2D `src` usm_ndarray to 2D
+ `dst` usm_ndarray while casting from `srcTy` to `dstTy`.
+
+   Kernel is submitted over 2D range of the common `shape`, so that offsets
+ of elements are computed from indices of work-items without division.
+ Arguments have the same meaning as for `copy_and_cast_nd_specialized_impl`.
+
+   @return  Event to wait on to ensure that computation completes.
+ * @ingroup CopyAndCastKernels
+ */
+template <typename dstTy, typename srcTy>
+sycl::event copy_and_cast_2d_impl(sycl::queue q,
+                                  size_t nelems,
+                                  const std::array<py::ssize_t, 2> shape,
+                                  const std::array<py::ssize_t, 2> src_strides,
+                                  const std::array<py::ssize_t, 2> dst_strides,
+                                  const char *src_p,
+                                  py::ssize_t src_offset,
+                                  char *dst_p,
+                                  py::ssize_t dst_offset,
+                                  const std::vector<sycl::event> &depends)
+{
+    dpctl::tensor::type_utils::validate_type_for_device<dstTy>(q);
+    dpctl::tensor::type_utils::validate_type_for_device<srcTy>(q);
+
+    sycl::event copy_and_cast_ev = q.submit([&](sycl::handler &cgh) {
+        const srcTy *src_tp = reinterpret_cast<const srcTy *>(src_p);
+        dstTy *dst_tp = reinterpret_cast<dstTy *>(dst_p);
+
+        cgh.depends_on(depends);
+        cgh.parallel_for<class copy_cast_2d_kernel<srcTy, dstTy>>(
+            sycl::range<2>(static_cast<size_t>(shape[0]),
+                           static_cast<size_t>(shape[1])),
+            Copy2DFunctor<srcTy, dstTy, Caster<srcTy, dstTy>>(
+                src_tp + src_offset, dst_tp + dst_offset, src_strides,
+                dst_strides));
+    });
+
+    return copy_and_cast_ev;
+}
+
 /*!
  * @brief Factory to get 2D-specialized function pointer of type `fnT` for given
  * source data type `S` and destination data type `D`.
@@ -471,7 +557,7 @@ template <typename fnT, typename D, typename S> struct CopyAndCast2DFactory
 {
     fnT get()
     {
-        fnT f = copy_and_cast_nd_specialized_impl<D, S, 2>;
+        fnT f = copy_and_cast_2d_impl<D, S>;
         return f;
     }
 };
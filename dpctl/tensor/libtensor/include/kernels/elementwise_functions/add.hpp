@@ -225,6 +225,7 @@ sycl::event add_strided_impl(sycl::queue exec_q,
                              size_t nelems,
                              int nd,
                              const py::ssize_t *shape_and_strides,
+                             bool use_int32_indexing,
                              const char *arg1_p,
                              py::ssize_t arg1_offset,
                              const char *arg2_p,
@@ -236,8 +237,9 @@ sycl::event add_strided_impl(sycl::queue exec_q,
 {
     return elementwise_common::binary_strided_impl<
         argTy1, argTy2, AddOutputType, AddStridedFunctor, add_strided_kernel>(
-        exec_q, nelems, nd, shape_and_strides, arg1_p, arg1_offset, arg2_p,
-        arg2_offset, res_p, res_offset, depends, additional_depends);
+        exec_q, nelems, nd, shape_and_strides, use_int32_indexing, arg1_p,
+        arg1_offset, arg2_p, arg2_offset, res_p, res_offset, depends,
+        additional_depends);
 }
 
 template <typename fnT, typename T1, typename T2> struct AddStridedFactory
@@ -256,6 +258,50 @@ template <typename fnT, typename T1, typename T2> struct AddStridedFactory
     }
 };
 
+template <typename T1, typename T2, typename T3, bool scalar_is_first>
+class add_scalar_broadcast_krn;
+
+template <typename T1, typename T2, typename T3>
+class add_2d_broadcast_krn;
+
+template <typename argTy1, typename argTy2>
+sycl::event add_broadcast_impl(sycl::queue exec_q,
+                               int nd,
+                               const py::ssize_t *shape,
+                               const char *arg1_p,
+                               py::ssize_t arg1_offset,
+                               const py::ssize_t *arg1_strides,
+                               const char *arg2_p,
+                               py::ssize_t arg2_offset,
+                               const py::ssize_t *arg2_strides,
+                               char *res_p,
+                               py::ssize_t res_offset,
+                               const py::ssize_t *res_strides,
+                               const std::vector<sycl::event> &depends = {})
+{
+    return elementwise_common::binary_broadcast_impl<
+        argTy1, argTy2, AddOutputType, AddFunctor, add_scalar_broadcast_krn,
+        add_2d_broadcast_krn>(
+        exec_q, nd, shape, arg1_p, arg1_offset, arg1_strides, arg2_p,
+        arg2_offset, arg2_strides, res_p, res_offset, res_strides, depends);
+}
+
+template <typename fnT, typename T1, typename T2> struct AddBroadcastFactory
+{
+    fnT get()
+    {
+        using resT = typename AddOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = add_broadcast_impl<T1, T2>;
+            return fn;
+        }
+    }
+};
+
 template <typename argT1, typename argT2, typename resT>
 class add_matrix_row_broadcast_sg_krn;
 
@@ -449,6 +495,7 @@ add_inplace_strided_impl(sycl::queue exec_q,
                          size_t nelems,
                          int nd,
                          const py::ssize_t *shape_and_strides,
+                         bool use_int32_indexing,
                          const char *arg_p,
                          py::ssize_t arg_offset,
                          char *res_p,
@@ -458,8 +505,8 @@ add_inplace_strided_impl(sycl::queue exec_q,
 {
     return elementwise_common::binary_inplace_strided_impl<
         argTy, resTy, AddInplaceStridedFunctor, add_inplace_strided_kernel>(
-        exec_q, nelems, nd, shape_and_strides, arg_p, arg_offset, res_p,
-        res_offset, depends, additional_depends);
+        exec_q, nelems, nd, shape_and_strides, use_int32_indexing, arg_p,
+        arg_offset, res_p, res_offset, depends, additional_depends);
 }
 
 template <typename fnT, typename T1, typename T2>
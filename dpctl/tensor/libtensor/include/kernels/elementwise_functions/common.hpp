@@ -24,9 +24,16 @@
 
 #pragma once
 #include <CL/sycl.hpp>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <pybind11/pybind11.h>
+#include <type_traits>
+
+#include "kernels/constructors.hpp"
+#include "utils/launch_params.hpp"
+#include "utils/offset_utils.hpp"
+#include "utils/scratch_allocator.hpp"
 
 namespace dpctl
 {
@@ -258,22 +265,25 @@ template <typename argTy,
           class kernel_name,
           unsigned int vec_sz = 4,
           unsigned int n_vecs = 2>
-sycl::event unary_contig_impl(sycl::queue exec_q,
-                              size_t nelems,
-                              const char *arg_p,
-                              char *res_p,
-                              const std::vector<sycl::event> &depends = {})
+sycl::event unary_contig_with_params(
+    sycl::queue exec_q,
+    const dpctl::tensor::launch_params::launch_params_t &lp,
+    size_t nelems,
+    const char *arg_p,
+    char *res_p,
+    const std::vector<sycl::event> &depends = {})
 {
+    using resTy = typename UnaryOutputType<argTy>::value_type;
+    const size_t lws = lp.wg_size;
+
     sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
 
-        size_t lws = 64;
         const size_t n_groups =
             ((nelems + lws * n_vecs * vec_sz - 1) / (lws * n_vecs * vec_sz));
         const auto gws_range = sycl::range<1>(n_groups * lws);
         const auto lws_range = sycl::range<1>(lws);
 
-        using resTy = typename UnaryOutputType<argTy>::value_type;
         const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_p);
         resTy *res_tp = reinterpret_cast<resTy *>(res_p);
 
@@ -285,6 +295,31 @@ sycl::event unary_contig_impl(sycl::queue exec_q,
     return comp_ev;
 }
 
+template <typename argTy,
+          template <typename T>
+          class UnaryOutputType,
+          template <typename A, typename R, unsigned int vs, unsigned int nv>
+          class ContigFunctorT,
+          template <typename A, typename R, unsigned int vs, unsigned int nv>
+          class kernel_name,
+          unsigned int vec_sz = 4,
+          unsigned int n_vecs = 2>
+sycl::event unary_contig_impl(sycl::queue exec_q,
+                              size_t nelems,
+                              const char *arg_p,
+                              char *res_p,
+                              const std::vector<sycl::event> &depends = {})
+{
+    using resTy = typename UnaryOutputType<argTy>::value_type;
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const lp_ns::launch_params_t lp = lp_ns::get_launch_params(
+        exec_q, lp_ns::kernel_family::unary_contig,
+        std::max(sizeof(argTy), sizeof(resTy)));
+    return unary_contig_with_params<argTy, UnaryOutputType, ContigFunctorT,
+                                    kernel_name, vec_sz, n_vecs>(
+        exec_q, lp, nelems, arg_p, res_p, depends);
+}
+
 template <typename argTy,
           template <typename T>
           class UnaryOutputType,
@@ -297,6 +332,7 @@ unary_strided_impl(sycl::queue exec_q,
                    size_t nelems,
                    int nd,
                    const py::ssize_t *shape_and_strides,
+                   bool use_int32_indexing,
                    const char *arg_p,
                    py::ssize_t arg_offset,
                    char *res_p,
@@ -309,17 +345,23 @@ unary_strided_impl(sycl::queue exec_q,
         cgh.depends_on(additional_depends);
 
         using resTy = typename UnaryOutputType<argTy>::value_type;
-        using IndexerT =
-            typename dpctl::tensor::offset_utils::TwoOffsets_StridedIndexer;
-
-        IndexerT indexer{nd, arg_offset, res_offset, shape_and_strides};
+        using dpctl::tensor::offset_utils::dispatch_fixed_rank_indexer;
+        using dpctl::tensor::offset_utils::TwoOffsets_FixedRankStridedIndexer;
+        using dpctl::tensor::offset_utils::TwoOffsets_FastDivStridedIndexer;
 
         const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_p);
         resTy *res_tp = reinterpret_cast<resTy *>(res_p);
 
-        cgh.parallel_for<kernel_name<argTy, resTy, IndexerT>>(
-            {nelems},
-            StridedFunctorT<argTy, resTy, IndexerT>(arg_tp, res_tp, indexer));
+        auto submit_kernel = [&](const auto &indexer) {
+            using IndexerT = std::decay_t<decltype(indexer)>;
+            cgh.parallel_for<kernel_name<argTy, resTy, IndexerT>>(
+                {nelems}, StridedFunctorT<argTy, resTy, IndexerT>(
+                              arg_tp, res_tp, indexer));
+        };
+        dispatch_fixed_rank_indexer<TwoOffsets_FixedRankStridedIndexer,
+                                    TwoOffsets_FastDivStridedIndexer>(
+            nd, use_int32_indexing, submit_kernel, arg_offset, res_offset,
+            shape_and_strides);
     });
     return comp_ev;
 }
@@ -457,6 +499,140 @@ public:
     }
 };
 
+/*! @brief Scalar operand of binary function held by value, e.g. a Python
+    scalar unboxed on the host. */
+template <typename T> struct scalar_by_value
+{
+    T value;
+
+    T get() const
+    {
+        return value;
+    }
+};
+
+/*! @brief Scalar operand of binary function residing in USM memory, e.g. a
+    zero-dimensional array. Read once by each work-item. */
+template <typename T> struct scalar_in_usm
+{
+    const T *ptr;
+
+    T get() const
+    {
+        return *ptr;
+    }
+};
+
+/*! @brief Functor for binary function evaluation on contiguous array and
+    a scalar operand, which is obtained once by each work-item from
+    `ScalarSrcT` and passed to the operator by value.
+    Work distribution and vectorization follow BinaryContigFunctor. */
+template <typename argT1,
+          typename argT2,
+          typename resT,
+          typename BinaryOperatorT,
+          bool scalar_is_first,
+          typename ScalarSrcT,
+          unsigned int vec_sz = 4,
+          unsigned int n_vecs = 2>
+struct BinaryContigScalarFunctor
+{
+private:
+    using arrT = std::conditional_t<scalar_is_first, argT2, argT1>;
+    using scalarT = std::conditional_t<scalar_is_first, argT1, argT2>;
+
+    const arrT *in = nullptr;
+    const ScalarSrcT scalar_src;
+    resT *out = nullptr;
+    const size_t nelems_;
+
+    template <typename ArgT, typename ScalarArgT>
+    static auto apply(BinaryOperatorT &op, const ArgT &a, const ScalarArgT &s)
+    {
+        if constexpr (scalar_is_first) {
+            return op(s, a);
+        }
+        else {
+            return op(a, s);
+        }
+    }
+
+public:
+    BinaryContigScalarFunctor(const arrT *inp,
+                              const ScalarSrcT scalar_source,
+                              resT *res,
+                              const size_t n_elems)
+        : in(inp), scalar_src(scalar_source), out(res), nelems_(n_elems)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> ndit) const
+    {
+        BinaryOperatorT op{};
+        const scalarT scalar = scalar_src.get();
+
+        if constexpr (BinaryOperatorT::supports_sg_loadstore::value) {
+            auto sg = ndit.get_sub_group();
+            std::uint8_t sgSize = sg.get_local_range()[0];
+            std::uint8_t maxsgSize = sg.get_max_local_range()[0];
+
+            size_t base = n_vecs * vec_sz *
+                          (ndit.get_group(0) * ndit.get_local_range(0) +
+                           sg.get_group_id()[0] * sgSize);
+
+            if ((base + n_vecs * vec_sz * sgSize < nelems_) &&
+                (sgSize == maxsgSize)) {
+                using in_ptrT =
+                    sycl::multi_ptr<const arrT,
+                                    sycl::access::address_space::global_space>;
+                using out_ptrT =
+                    sycl::multi_ptr<resT,
+                                    sycl::access::address_space::global_space>;
+                sycl::vec<arrT, vec_sz> arg_vec;
+                sycl::vec<resT, vec_sz> res_vec;
+
+#pragma unroll
+                for (std::uint8_t it = 0; it < n_vecs * vec_sz; it += vec_sz) {
+                    arg_vec =
+                        sg.load<vec_sz>(in_ptrT(&in[base + it * sgSize]));
+                    if constexpr (BinaryOperatorT::supports_vec::value) {
+                        const sycl::vec<scalarT, vec_sz> scalar_vec(scalar);
+                        res_vec = apply(op, arg_vec, scalar_vec);
+                    }
+                    else {
+#pragma unroll
+                        for (std::uint8_t vec_id = 0; vec_id < vec_sz;
+                             ++vec_id) {
+                            res_vec[vec_id] =
+                                apply(op, arg_vec[vec_id], scalar);
+                        }
+                    }
+                    sg.store<vec_sz>(out_ptrT(&out[base + it * sgSize]),
+                                     res_vec);
+                }
+            }
+            else {
+                for (size_t k = base + sg.get_local_id()[0]; k < nelems_;
+                     k += sgSize) {
+                    out[k] = apply(op, in[k], scalar);
+                }
+            }
+        }
+        else {
+            std::uint8_t sgSize = ndit.get_sub_group().get_local_range()[0];
+            size_t base = ndit.get_global_linear_id();
+
+            base = (base / sgSize) * sgSize * n_vecs * vec_sz + (base % sgSize);
+            for (size_t offset = base;
+                 offset < std::min(nelems_, base + sgSize * (n_vecs * vec_sz));
+                 offset += sgSize)
+            {
+                out[offset] = apply(op, in[offset], scalar);
+            }
+        }
+    }
+};
+
 template <typename argT1,
           typename argT2,
           typename resT,
@@ -618,6 +794,51 @@ public:
     }
 };
 
+/*! @brief Functor for binary function evaluation on arrays of at most two
+    dimensions with arbitrary strides, including zero strides of broadcast
+    operands, e.g. column vectors or outer products. Offsets are computed
+    from the 2D index of the work-item, avoiding division of the linear id. */
+template <typename argT1,
+          typename argT2,
+          typename resT,
+          typename BinaryOperatorT>
+struct Binary2DBroadcastingFunctor
+{
+private:
+    const argT1 *in1 = nullptr;
+    const argT2 *in2 = nullptr;
+    resT *out = nullptr;
+    py::ssize_t in1_s0, in1_s1;
+    py::ssize_t in2_s0, in2_s1;
+    py::ssize_t out_s0, out_s1;
+
+public:
+    Binary2DBroadcastingFunctor(const argT1 *inp1,
+                                py::ssize_t inp1_stride0,
+                                py::ssize_t inp1_stride1,
+                                const argT2 *inp2,
+                                py::ssize_t inp2_stride0,
+                                py::ssize_t inp2_stride1,
+                                resT *res,
+                                py::ssize_t res_stride0,
+                                py::ssize_t res_stride1)
+        : in1(inp1), in2(inp2), out(res), in1_s0(inp1_stride0),
+          in1_s1(inp1_stride1), in2_s0(inp2_stride0), in2_s1(inp2_stride1),
+          out_s0(res_stride0), out_s1(res_stride1)
+    {
+    }
+
+    void operator()(sycl::id<2> wid) const
+    {
+        const py::ssize_t i = static_cast<py::ssize_t>(wid.get(0));
+        const py::ssize_t j = static_cast<py::ssize_t>(wid.get(1));
+
+        BinaryOperatorT op{};
+        out[i * out_s0 + j * out_s1] =
+            op(in1[i * in1_s0 + j * in1_s1], in2[i * in2_s0 + j * in2_s1]);
+    }
+};
+
 // Typedefs for function pointers
 
 typedef sycl::event (*unary_contig_impl_fn_ptr_t)(
@@ -632,6 +853,7 @@ typedef sycl::event (*unary_strided_impl_fn_ptr_t)(
     size_t,
     int,
     const py::ssize_t *,
+    bool,
     const char *,
     py::ssize_t,
     char *,
@@ -655,6 +877,7 @@ typedef sycl::event (*binary_strided_impl_fn_ptr_t)(
     size_t,
     int,
     const py::ssize_t *,
+    bool,
     const char *,
     py::ssize_t,
     const char *,
@@ -690,6 +913,32 @@ typedef sycl::event (*binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t)(
     py::ssize_t,
     const std::vector<sycl::event> &);
 
+typedef sycl::event (*binary_contig_scalar_impl_fn_ptr_t)(
+    sycl::queue,
+    size_t,
+    const char *,
+    py::ssize_t,
+    py::object,
+    bool,
+    char *,
+    py::ssize_t,
+    const std::vector<sycl::event> &);
+
+typedef sycl::event (*binary_broadcast_impl_fn_ptr_t)(
+    sycl::queue,
+    int,
+    const py::ssize_t *,
+    const char *,
+    py::ssize_t,
+    const py::ssize_t *,
+    const char *,
+    py::ssize_t,
+    const py::ssize_t *,
+    char *,
+    py::ssize_t,
+    const py::ssize_t *,
+    const std::vector<sycl::event> &);
+
 template <typename argTy1,
           typename argTy2,
           template <typename T1, typename T2>
@@ -708,26 +957,29 @@ template <typename argTy1,
           class kernel_name,
           unsigned int vec_sz = 4,
           unsigned int n_vecs = 2>
-sycl::event binary_contig_impl(sycl::queue exec_q,
-                               size_t nelems,
-                               const char *arg1_p,
-                               py::ssize_t arg1_offset,
-                               const char *arg2_p,
-                               py::ssize_t arg2_offset,
-                               char *res_p,
-                               py::ssize_t res_offset,
-                               const std::vector<sycl::event> &depends = {})
+sycl::event binary_contig_with_params(
+    sycl::queue exec_q,
+    const dpctl::tensor::launch_params::launch_params_t &lp,
+    size_t nelems,
+    const char *arg1_p,
+    py::ssize_t arg1_offset,
+    const char *arg2_p,
+    py::ssize_t arg2_offset,
+    char *res_p,
+    py::ssize_t res_offset,
+    const std::vector<sycl::event> &depends = {})
 {
+    using resTy = typename BinaryOutputType<argTy1, argTy2>::value_type;
+    const size_t lws = lp.wg_size;
+
     sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
 
-        size_t lws = 64;
         const size_t n_groups =
             ((nelems + lws * n_vecs * vec_sz - 1) / (lws * n_vecs * vec_sz));
         const auto gws_range = sycl::range<1>(n_groups * lws);
         const auto lws_range = sycl::range<1>(lws);
 
-        using resTy = typename BinaryOutputType<argTy1, argTy2>::value_type;
 
         const argTy1 *arg1_tp =
             reinterpret_cast<const argTy1 *>(arg1_p) + arg1_offset;
@@ -743,6 +995,46 @@ sycl::event binary_contig_impl(sycl::queue exec_q,
     return comp_ev;
 }
 
+template <typename argTy1,
+          typename argTy2,
+          template <typename T1, typename T2>
+          class BinaryOutputType,
+          template <typename T1,
+                    typename T2,
+                    typename T3,
+                    unsigned int vs,
+                    unsigned int nv>
+          class BinaryContigFunctorT,
+          template <typename T1,
+                    typename T2,
+                    typename T3,
+                    unsigned int vs,
+                    unsigned int nv>
+          class kernel_name,
+          unsigned int vec_sz = 4,
+          unsigned int n_vecs = 2>
+sycl::event binary_contig_impl(sycl::queue exec_q,
+                               size_t nelems,
+                               const char *arg1_p,
+                               py::ssize_t arg1_offset,
+                               const char *arg2_p,
+                               py::ssize_t arg2_offset,
+                               char *res_p,
+                               py::ssize_t res_offset,
+                               const std::vector<sycl::event> &depends = {})
+{
+    using resTy = typename BinaryOutputType<argTy1, argTy2>::value_type;
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const lp_ns::launch_params_t lp = lp_ns::get_launch_params(
+        exec_q, lp_ns::kernel_family::binary_contig,
+        std::max({sizeof(argTy1), sizeof(argTy2), sizeof(resTy)}));
+    return binary_contig_with_params<argTy1, argTy2, BinaryOutputType,
+                                     BinaryContigFunctorT, kernel_name, vec_sz,
+                                     n_vecs>(exec_q, lp, nelems, arg1_p,
+                                             arg1_offset, arg2_p, arg2_offset,
+                                             res_p, res_offset, depends);
+}
+
 template <typename argTy1,
           typename argTy2,
           template <typename T1, typename T2>
@@ -756,6 +1048,7 @@ binary_strided_impl(sycl::queue exec_q,
                     size_t nelems,
                     int nd,
                     const py::ssize_t *shape_and_strides,
+                    bool use_int32_indexing,
                     const char *arg1_p,
                     py::ssize_t arg1_offset,
                     const char *arg2_p,
@@ -770,20 +1063,25 @@ binary_strided_impl(sycl::queue exec_q,
         cgh.depends_on(additional_depends);
 
         using resTy = typename BinaryOutputType<argTy1, argTy2>::value_type;
-
-        using IndexerT =
-            typename dpctl::tensor::offset_utils::ThreeOffsets_StridedIndexer;
-
-        IndexerT indexer{nd, arg1_offset, arg2_offset, res_offset,
-                         shape_and_strides};
+        using dpctl::tensor::offset_utils::dispatch_fixed_rank_indexer;
+        using dpctl::tensor::offset_utils::ThreeOffsets_FixedRankStridedIndexer;
+        using dpctl::tensor::offset_utils::ThreeOffsets_FastDivStridedIndexer;
 
         const argTy1 *arg1_tp = reinterpret_cast<const argTy1 *>(arg1_p);
         const argTy2 *arg2_tp = reinterpret_cast<const argTy2 *>(arg2_p);
         resTy *res_tp = reinterpret_cast<resTy *>(res_p);
 
-        cgh.parallel_for<kernel_name<argTy1, argTy2, resTy, IndexerT>>(
-            {nelems}, BinaryStridedFunctorT<argTy1, argTy2, resTy, IndexerT>(
-                          arg1_tp, arg2_tp, res_tp, indexer));
+        auto submit_kernel = [&](const auto &indexer) {
+            using IndexerT = std::decay_t<decltype(indexer)>;
+            cgh.parallel_for<kernel_name<argTy1, argTy2, resTy, IndexerT>>(
+                {nelems},
+                BinaryStridedFunctorT<argTy1, argTy2, resTy, IndexerT>(
+                    arg1_tp, arg2_tp, res_tp, indexer));
+        };
+        dispatch_fixed_rank_indexer<ThreeOffsets_FixedRankStridedIndexer,
+                                    ThreeOffsets_FastDivStridedIndexer>(
+            nd, use_int32_indexing, submit_kernel, arg1_offset, arg2_offset,
+            res_offset, shape_and_strides);
     });
     return comp_ev;
 }
@@ -820,11 +1118,9 @@ sycl::event binary_contig_matrix_contig_row_broadcast_impl(
         *(std::max_element(std::begin(sg_sizes), std::end(sg_sizes)));
 
     size_t n1_padded = n1 + max_sgSize;
-    argT2 *padded_vec = sycl::malloc_device<argT2>(n1_padded, exec_q);
-
-    if (padded_vec == nullptr) {
-        throw std::runtime_error("Could not allocate memory on the device");
-    }
+    using dpctl::tensor::alloc_utils::scratch_allocation;
+    scratch_allocation<argT2> padded_vec_tmp(exec_q, n1_padded);
+    argT2 *padded_vec = padded_vec_tmp.get();
     sycl::event make_padded_vec_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends); // ensure vec contains actual data
         cgh.parallel_for({n1_padded}, [=](sycl::id<1> id) {
@@ -840,7 +1136,10 @@ sycl::event binary_contig_matrix_contig_row_broadcast_impl(
     // We read sg.load(&padded_vec[(base / n0)]). The vector is padded to
     // ensure that reads are accessible
 
-    size_t lws = 64;
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const size_t lws = lp_ns::elementwise_lws(
+        exec_q, lp_ns::kernel_family::binary_contig,
+        std::max({sizeof(argT1), sizeof(argT2), sizeof(resT)}));
 
     sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(make_padded_vec_ev);
@@ -856,11 +1155,7 @@ sycl::event binary_contig_matrix_contig_row_broadcast_impl(
                 mat, padded_vec, res, n_elems, n1));
     });
 
-    sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(comp_ev);
-        sycl::context ctx = exec_q.get_context();
-        cgh.host_task([ctx, padded_vec]() { sycl::free(padded_vec, ctx); });
-    });
+    sycl::event tmp_cleanup_ev = padded_vec_tmp.release_after(exec_q, comp_ev);
     host_tasks.push_back(tmp_cleanup_ev);
 
     return comp_ev;
@@ -898,11 +1193,9 @@ sycl::event binary_contig_row_contig_matrix_broadcast_impl(
         *(std::max_element(std::begin(sg_sizes), std::end(sg_sizes)));
 
     size_t n1_padded = n1 + max_sgSize;
-    argT2 *padded_vec = sycl::malloc_device<argT2>(n1_padded, exec_q);
-
-    if (padded_vec == nullptr) {
-        throw std::runtime_error("Could not allocate memory on the device");
-    }
+    using dpctl::tensor::alloc_utils::scratch_allocation;
+    scratch_allocation<argT2> padded_vec_tmp(exec_q, n1_padded);
+    argT2 *padded_vec = padded_vec_tmp.get();
 
     sycl::event make_padded_vec_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends); // ensure vec contains actual data
@@ -919,7 +1212,10 @@ sycl::event binary_contig_row_contig_matrix_broadcast_impl(
     // We read sg.load(&padded_vec[(base / n0)]). The vector is padded to
     // ensure that reads are accessible
 
-    size_t lws = 64;
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const size_t lws = lp_ns::elementwise_lws(
+        exec_q, lp_ns::kernel_family::binary_contig,
+        std::max({sizeof(argT1), sizeof(argT2), sizeof(resT)}));
 
     sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(make_padded_vec_ev);
@@ -935,16 +1231,237 @@ sycl::event binary_contig_row_contig_matrix_broadcast_impl(
                 padded_vec, mat, res, n_elems, n1));
     });
 
-    sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(comp_ev);
-        sycl::context ctx = exec_q.get_context();
-        cgh.host_task([ctx, padded_vec]() { sycl::free(padded_vec, ctx); });
-    });
+    sycl::event tmp_cleanup_ev = padded_vec_tmp.release_after(exec_q, comp_ev);
     host_tasks.push_back(tmp_cleanup_ev);
 
     return comp_ev;
 };
 
+template <typename KernelName> class scalar_by_value_krn;
+
+/*! @brief Submits BinaryContigScalarFunctor over `nelems` elements of
+    contiguous array `arr_tp`, with the scalar operand given by `scalar_src`.
+ */
+template <typename argTy1,
+          typename argTy2,
+          typename resTy,
+          typename BinaryOperatorT,
+          bool scalar_is_first,
+          typename KernelName,
+          unsigned int vec_sz,
+          unsigned int n_vecs,
+          typename arrTy,
+          typename ScalarSrcT>
+sycl::event
+submit_binary_contig_scalar(sycl::queue &exec_q,
+                            size_t nelems,
+                            const arrTy *arr_tp,
+                            const ScalarSrcT &scalar_src,
+                            resTy *res_tp,
+                            const std::vector<sycl::event> &depends)
+{
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const size_t lws = lp_ns::elementwise_lws(
+        exec_q, lp_ns::kernel_family::binary_contig,
+        std::max({sizeof(argTy1), sizeof(argTy2), sizeof(resTy)}));
+    const size_t n_groups =
+        ((nelems + lws * n_vecs * vec_sz - 1) / (lws * n_vecs * vec_sz));
+    const auto ndRange = sycl::nd_range<1>(sycl::range<1>(n_groups * lws),
+                                           sycl::range<1>(lws));
+
+    return exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+        cgh.parallel_for<KernelName>(
+            ndRange,
+            BinaryContigScalarFunctor<argTy1, argTy2, resTy, BinaryOperatorT,
+                                      scalar_is_first, ScalarSrcT, vec_sz,
+                                      n_vecs>(arr_tp, scalar_src, res_tp,
+                                              nelems));
+    });
+}
+
+/*! @brief Evaluates binary operation on contiguous array and a Python scalar,
+    which is unboxed into the corresponding argument type and passed to the
+    kernel by value. No memory is allocated for the scalar operand.
+
+    If `scalar_is_first` is true, computes res[i] = op(scalar, arg[i]),
+    otherwise computes res[i] = op(arg[i], scalar). The kernel is the one
+    used by `binary_broadcast_impl` for zero-dimensional array operands,
+    with `kernel_name` being the name of that kernel.
+ */
+template <typename argTy1,
+          typename argTy2,
+          template <typename T1, typename T2>
+          class BinaryOutputType,
+          template <typename T1, typename T2, typename T3>
+          class BinaryOperatorT,
+          template <typename T1, typename T2, typename T3, bool>
+          class kernel_name,
+          unsigned int vec_sz = 4,
+          unsigned int n_vecs = 2>
+sycl::event
+binary_contig_scalar_impl(sycl::queue exec_q,
+                          size_t nelems,
+                          const char *arg_p,
+                          py::ssize_t arg_offset,
+                          py::object py_scalar,
+                          bool scalar_is_first,
+                          char *res_p,
+                          py::ssize_t res_offset,
+                          const std::vector<sycl::event> &depends = {})
+{
+    using resTy = typename BinaryOutputType<argTy1, argTy2>::value_type;
+    using OpT = BinaryOperatorT<argTy1, argTy2, resTy>;
+    using dpctl::tensor::kernels::constructors::unbox_py_scalar;
+
+    resTy *res_tp = reinterpret_cast<resTy *>(res_p) + res_offset;
+
+    if (scalar_is_first) {
+        const scalar_by_value<argTy1> scalar{
+            unbox_py_scalar<argTy1>(py_scalar)};
+        const argTy2 *arg_tp =
+            reinterpret_cast<const argTy2 *>(arg_p) + arg_offset;
+
+        using KernelName =
+            scalar_by_value_krn<kernel_name<argTy1, argTy2, resTy, true>>;
+        return submit_binary_contig_scalar<argTy1, argTy2, resTy, OpT, true,
+                                           KernelName, vec_sz, n_vecs>(
+            exec_q, nelems, arg_tp, scalar, res_tp, depends);
+    }
+    else {
+        const scalar_by_value<argTy2> scalar{
+            unbox_py_scalar<argTy2>(py_scalar)};
+        const argTy1 *arg_tp =
+            reinterpret_cast<const argTy1 *>(arg_p) + arg_offset;
+
+        using KernelName =
+            scalar_by_value_krn<kernel_name<argTy1, argTy2, resTy, false>>;
+        return submit_binary_contig_scalar<argTy1, argTy2, resTy, OpT, false,
+                                           KernelName, vec_sz, n_vecs>(
+            exec_q, nelems, arg_tp, scalar, res_tp, depends);
+    }
+}
+
+/*! @brief Factory of `binary_contig_scalar_impl` for the binary operation
+    with the given output type, operator and name of its scalar broadcasting
+    kernel, passed to DispatchTableBuilder as
+    `BinaryContigScalarFactory<...>::factory`. */
+template <template <typename T1, typename T2> class BinaryOutputType,
+          template <typename T1, typename T2, typename T3>
+          class BinaryOperatorT,
+          template <typename T1, typename T2, typename T3, bool>
+          class kernel_name>
+struct BinaryContigScalarFactory
+{
+    template <typename fnT, typename T1, typename T2> struct factory
+    {
+        fnT get()
+        {
+            using resT = typename BinaryOutputType<T1, T2>::value_type;
+            if constexpr (std::is_same_v<resT, void>) {
+                fnT fn = nullptr;
+                return fn;
+            }
+            else {
+                fnT fn =
+                    binary_contig_scalar_impl<T1, T2, BinaryOutputType,
+                                              BinaryOperatorT, kernel_name>;
+                return fn;
+            }
+        }
+    };
+};
+
+/*! @brief Evaluates binary operation on arrays of `nd` = 1 or 2 dimensions,
+    with shape and strides given in host memory, as obtained after
+    simplification of the iteration space of broadcast operands.
+
+    A contiguous array combined with a scalar (zero-stride) operand is
+    processed by the kernel of `binary_contig_scalar_impl`, reading the
+    scalar once per work-item, other patterns by a kernel using 2D indexing.
+    Neither kernel needs shape and strides packed in device memory, nor
+    padded copies of operands.
+ */
+template <typename argTy1,
+          typename argTy2,
+          template <typename T1, typename T2>
+          class BinaryOutputType,
+          template <typename T1, typename T2, typename T3>
+          class BinaryOperatorT,
+          template <typename T1, typename T2, typename T3, bool>
+          class scalar_kernel_name,
+          template <typename T1, typename T2, typename T3>
+          class kernel_name_2d>
+sycl::event binary_broadcast_impl(sycl::queue exec_q,
+                                  int nd,
+                                  const py::ssize_t *shape,
+                                  const char *arg1_p,
+                                  py::ssize_t arg1_offset,
+                                  const py::ssize_t *arg1_strides,
+                                  const char *arg2_p,
+                                  py::ssize_t arg2_offset,
+                                  const py::ssize_t *arg2_strides,
+                                  char *res_p,
+                                  py::ssize_t res_offset,
+                                  const py::ssize_t *res_strides,
+                                  const std::vector<sycl::event> &depends = {})
+{
+    using resTy = typename BinaryOutputType<argTy1, argTy2>::value_type;
+    using OpT = BinaryOperatorT<argTy1, argTy2, resTy>;
+
+    const argTy1 *arg1_tp =
+        reinterpret_cast<const argTy1 *>(arg1_p) + arg1_offset;
+    const argTy2 *arg2_tp =
+        reinterpret_cast<const argTy2 *>(arg2_p) + arg2_offset;
+    resTy *res_tp = reinterpret_cast<resTy *>(res_p) + res_offset;
+
+    if (nd == 1 && res_strides[0] == 1 &&
+        ((arg1_strides[0] == 0 && arg2_strides[0] == 1) ||
+         (arg1_strides[0] == 1 && arg2_strides[0] == 0)))
+    {
+        constexpr unsigned int vec_sz = 4;
+        constexpr unsigned int n_vecs = 2;
+        const size_t nelems = static_cast<size_t>(shape[0]);
+
+        if (arg1_strides[0] == 0) {
+            using KernelName = scalar_kernel_name<argTy1, argTy2, resTy, true>;
+            return submit_binary_contig_scalar<argTy1, argTy2, resTy, OpT, true,
+                                               KernelName, vec_sz, n_vecs>(
+                exec_q, nelems, arg2_tp, scalar_in_usm<argTy1>{arg1_tp},
+                res_tp, depends);
+        }
+        else {
+            using KernelName =
+                scalar_kernel_name<argTy1, argTy2, resTy, false>;
+            return submit_binary_contig_scalar<argTy1, argTy2, resTy, OpT,
+                                               false, KernelName, vec_sz,
+                                               n_vecs>(
+                exec_q, nelems, arg1_tp, scalar_in_usm<argTy2>{arg2_tp},
+                res_tp, depends);
+        }
+    }
+
+    // a vector is treated as a matrix with a single row
+    const size_t n0 = (nd == 1) ? 1 : static_cast<size_t>(shape[0]);
+    const size_t n1 = static_cast<size_t>(shape[nd - 1]);
+    const py::ssize_t arg1_s0 = (nd == 1) ? 0 : arg1_strides[0];
+    const py::ssize_t arg2_s0 = (nd == 1) ? 0 : arg2_strides[0];
+    const py::ssize_t res_s0 = (nd == 1) ? 0 : res_strides[0];
+    const py::ssize_t arg1_s1 = arg1_strides[nd - 1];
+    const py::ssize_t arg2_s1 = arg2_strides[nd - 1];
+    const py::ssize_t res_s1 = res_strides[nd - 1];
+
+    return exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        cgh.parallel_for<kernel_name_2d<argTy1, argTy2, resTy>>(
+            sycl::range<2>(n0, n1),
+            Binary2DBroadcastingFunctor<argTy1, argTy2, resTy, OpT>(
+                arg1_tp, arg1_s0, arg1_s1, arg2_tp, arg2_s0, arg2_s1, res_tp,
+                res_s0, res_s1));
+    });
+}
+
 } // namespace elementwise_common
 } // namespace kernels
 } // namespace tensor
@@ -25,9 +25,15 @@
 
 #pragma once
 #include <CL/sycl.hpp>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <pybind11/pybind11.h>
+#include <type_traits>
+
+#include "utils/launch_params.hpp"
+#include "utils/offset_utils.hpp"
+#include "utils/scratch_allocator.hpp"
 
 namespace dpctl
 {
@@ -262,6 +268,7 @@ typedef sycl::event (*binary_inplace_strided_impl_fn_ptr_t)(
     size_t,
     int,
     const py::ssize_t *,
+    bool,
     const char *,
     py::ssize_t,
     char *,
@@ -297,10 +304,14 @@ binary_inplace_contig_impl(sycl::queue exec_q,
                            py::ssize_t lhs_offset,
                            const std::vector<sycl::event> &depends = {})
 {
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const size_t lws =
+        lp_ns::elementwise_lws(exec_q, lp_ns::kernel_family::binary_contig,
+                               std::max(sizeof(argTy), sizeof(resTy)));
+
     sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
 
-        size_t lws = 64;
         const size_t n_groups =
             ((nelems + lws * n_vecs * vec_sz - 1) / (lws * n_vecs * vec_sz));
         const auto gws_range = sycl::range<1>(n_groups * lws);
@@ -329,6 +340,7 @@ binary_inplace_strided_impl(sycl::queue exec_q,
                             size_t nelems,
                             int nd,
                             const py::ssize_t *shape_and_strides,
+                            bool use_int32_indexing,
                             const char *rhs_p,
                             py::ssize_t rhs_offset,
                             char *lhs_p,
@@ -340,17 +352,24 @@ binary_inplace_strided_impl(sycl::queue exec_q,
         cgh.depends_on(depends);
         cgh.depends_on(additional_depends);
 
-        using IndexerT =
-            typename dpctl::tensor::offset_utils::TwoOffsets_StridedIndexer;
-
-        IndexerT indexer{nd, rhs_offset, lhs_offset, shape_and_strides};
+        using dpctl::tensor::offset_utils::dispatch_fixed_rank_indexer;
+        using dpctl::tensor::offset_utils::TwoOffsets_FixedRankStridedIndexer;
+        using dpctl::tensor::offset_utils::TwoOffsets_FastDivStridedIndexer;
 
         const argTy *arg_tp = reinterpret_cast<const argTy *>(rhs_p);
         resTy *res_tp = reinterpret_cast<resTy *>(lhs_p);
 
-        cgh.parallel_for<kernel_name<argTy, resTy, IndexerT>>(
-            {nelems}, BinaryInplaceStridedFunctorT<argTy, resTy, IndexerT>(
-                          arg_tp, res_tp, indexer));
+        auto submit_kernel = [&](const auto &indexer) {
+            using IndexerT = std::decay_t<decltype(indexer)>;
+            cgh.parallel_for<kernel_name<argTy, resTy, IndexerT>>(
+                {nelems},
+                BinaryInplaceStridedFunctorT<argTy, resTy, IndexerT>(
+                    arg_tp, res_tp, indexer));
+        };
+        dispatch_fixed_rank_indexer<TwoOffsets_FixedRankStridedIndexer,
+                                    TwoOffsets_FastDivStridedIndexer>(
+            nd, use_int32_indexing, submit_kernel, rhs_offset, lhs_offset,
+            shape_and_strides);
     });
     return comp_ev;
 }
@@ -382,11 +401,9 @@ sycl::event binary_inplace_row_matrix_broadcast_impl(
         *(std::max_element(std::begin(sg_sizes), std::end(sg_sizes)));
 
     size_t n1_padded = n1 + max_sgSize;
-    argT *padded_vec = sycl::malloc_device<argT>(n1_padded, exec_q);
-
-    if (padded_vec == nullptr) {
-        throw std::runtime_error("Could not allocate memory on the device");
-    }
+    using dpctl::tensor::alloc_utils::scratch_allocation;
+    scratch_allocation<argT> padded_vec_tmp(exec_q, n1_padded);
+    argT *padded_vec = padded_vec_tmp.get();
     sycl::event make_padded_vec_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends); // ensure vec contains actual data
         cgh.parallel_for({n1_padded}, [=](sycl::id<1> id) {
@@ -402,7 +419,10 @@ sycl::event binary_inplace_row_matrix_broadcast_impl(
     // We read sg.load(&padded_vec[(base / n0)]). The vector is padded to
     // ensure that reads are accessible
 
-    size_t lws = 64;
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const size_t lws =
+        lp_ns::elementwise_lws(exec_q, lp_ns::kernel_family::binary_contig,
+                               std::max(sizeof(argT), sizeof(resT)));
 
     sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(make_padded_vec_ev);
@@ -418,11 +438,7 @@ sycl::event binary_inplace_row_matrix_broadcast_impl(
                                                                 n_elems, n1));
     });
 
-    sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(comp_ev);
-        sycl::context ctx = exec_q.get_context();
-        cgh.host_task([ctx, padded_vec]() { sycl::free(padded_vec, ctx); });
-    });
+    sycl::event tmp_cleanup_ev = padded_vec_tmp.release_after(exec_q, comp_ev);
     host_tasks.push_back(tmp_cleanup_ev);
 
     return comp_ev;
@@ -28,6 +28,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <stdexcept>
 #include <type_traits>
 
 #include "kernels/elementwise_functions/common.hpp"
@@ -135,18 +136,27 @@ sycl::event expm1_contig_impl(sycl::queue exec_q,
                               char *res_p,
                               const std::vector<sycl::event> &depends = {})
 {
+    using resTy = typename Expm1OutputType<argTy>::value_type;
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const size_t lws = lp_ns::elementwise_lws(
+        exec_q, lp_ns::kernel_family::unary_contig,
+        std::max(sizeof(argTy), sizeof(resTy)));
+    constexpr unsigned int vec_sz = 4;
+    constexpr unsigned int n_vecs = 2;
+    // work-group sizes below the granularity of launch parameters are only
+    // used by devices with a smaller limit
+    if (lws % vec_sz != 0) {
+        throw std::runtime_error("Work-group size of expm1 kernel must be a "
+                                 "multiple of its vector size");
+    }
+
     sycl::event expm1_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
-        constexpr size_t lws = 64;
-        constexpr unsigned int vec_sz = 4;
-        constexpr unsigned int n_vecs = 2;
-        static_assert(lws % vec_sz == 0);
         auto gws_range = sycl::range<1>(
             ((nelems + n_vecs * lws * vec_sz - 1) / (lws * n_vecs * vec_sz)) *
             lws);
         auto lws_range = sycl::range<1>(lws);
 
-        using resTy = typename Expm1OutputType<argTy>::value_type;
         const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_p);
         resTy *res_tp = reinterpret_cast<resTy *>(res_p);
 
@@ -193,6 +203,7 @@ typedef sycl::event (*expm1_strided_impl_fn_ptr_t)(
     size_t,
     int,
     const py::ssize_t *,
+    bool,
     const char *,
     py::ssize_t,
     char *,
@@ -206,6 +217,7 @@ expm1_strided_impl(sycl::queue exec_q,
                    size_t nelems,
                    int nd,
                    const py::ssize_t *shape_and_strides,
+                   bool use_int32_indexing,
                    const char *arg_p,
                    py::ssize_t arg_offset,
                    char *res_p,
@@ -218,19 +230,24 @@ expm1_strided_impl(sycl::queue exec_q,
         cgh.depends_on(additional_depends);
 
         using resTy = typename Expm1OutputType<argTy>::value_type;
-        using IndexerT =
-            typename dpctl::tensor::offset_utils::TwoOffsets_StridedIndexer;
-
-        IndexerT arg_res_indexer(nd, arg_offset, res_offset, shape_and_strides);
+        using dpctl::tensor::offset_utils::dispatch_fixed_rank_indexer;
+        using dpctl::tensor::offset_utils::TwoOffsets_FixedRankStridedIndexer;
+        using dpctl::tensor::offset_utils::TwoOffsets_FastDivStridedIndexer;
 
         const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_p);
         resTy *res_tp = reinterpret_cast<resTy *>(res_p);
 
-        sycl::range<1> gRange{nelems};
-
-        cgh.parallel_for<expm1_strided_kernel<argTy, resTy, IndexerT>>(
-            gRange, Expm1StridedFunctor<argTy, resTy, IndexerT>(
-                        arg_tp, res_tp, arg_res_indexer));
+        auto submit_kernel = [&](const auto &indexer) {
+            using IndexerT = std::decay_t<decltype(indexer)>;
+            cgh.parallel_for<expm1_strided_kernel<argTy, resTy, IndexerT>>(
+                {nelems},
+                Expm1StridedFunctor<argTy, resTy, IndexerT>(
+                    arg_tp, res_tp, indexer));
+        };
+        dispatch_fixed_rank_indexer<TwoOffsets_FixedRankStridedIndexer,
+                                    TwoOffsets_FastDivStridedIndexer>(
+            nd, use_int32_indexing, submit_kernel, arg_offset, res_offset,
+            shape_and_strides);
     });
     return comp_ev;
 }
@@ -34,6 +34,7 @@
 #include "utils/type_utils.hpp"
 
 #include "kernels/elementwise_functions/common.hpp"
+#include "kernels/elementwise_functions/common_inplace.hpp"
 #include <pybind11/pybind11.h>
 
 namespace dpctl
@@ -274,6 +275,7 @@ floor_divide_strided_impl(sycl::queue exec_q,
                           size_t nelems,
                           int nd,
                           const py::ssize_t *shape_and_strides,
+                          bool use_int32_indexing,
                           const char *arg1_p,
                           py::ssize_t arg1_offset,
                           const char *arg2_p,
@@ -286,8 +288,9 @@ floor_divide_strided_impl(sycl::queue exec_q,
     return elementwise_common::binary_strided_impl<
         argTy1, argTy2, FloorDivideOutputType, FloorDivideStridedFunctor,
         floor_divide_strided_kernel>(
-        exec_q, nelems, nd, shape_and_strides, arg1_p, arg1_offset, arg2_p,
-        arg2_offset, res_p, res_offset, depends, additional_depends);
+        exec_q, nelems, nd, shape_and_strides, use_int32_indexing, arg1_p,
+        arg1_offset, arg2_p, arg2_offset, res_p, res_offset, depends,
+        additional_depends);
 }
 
 template <typename fnT, typename T1, typename T2>
@@ -309,6 +312,229 @@ struct FloorDivideStridedFactory
     }
 };
 
+template <typename T1, typename T2, typename T3, bool scalar_is_first>
+class floor_divide_scalar_broadcast_krn;
+
+template <typename T1, typename T2, typename T3>
+class floor_divide_2d_broadcast_krn;
+
+template <typename argTy1, typename argTy2>
+sycl::event
+floor_divide_broadcast_impl(sycl::queue exec_q,
+                            int nd,
+                            const py::ssize_t *shape,
+                            const char *arg1_p,
+                            py::ssize_t arg1_offset,
+                            const py::ssize_t *arg1_strides,
+                            const char *arg2_p,
+                            py::ssize_t arg2_offset,
+                            const py::ssize_t *arg2_strides,
+                            char *res_p,
+                            py::ssize_t res_offset,
+                            const py::ssize_t *res_strides,
+                            const std::vector<sycl::event> &depends = {})
+{
+    return elementwise_common::binary_broadcast_impl<
+        argTy1, argTy2, FloorDivideOutputType, FloorDivideFunctor,
+        floor_divide_scalar_broadcast_krn, floor_divide_2d_broadcast_krn>(
+        exec_q, nd, shape, arg1_p, arg1_offset, arg1_strides, arg2_p,
+        arg2_offset, arg2_strides, res_p, res_offset, res_strides, depends);
+}
+
+template <typename fnT, typename T1, typename T2>
+struct FloorDivideBroadcastFactory
+{
+    fnT get()
+    {
+        using resT = typename FloorDivideOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = floor_divide_broadcast_impl<T1, T2>;
+            return fn;
+        }
+    }
+};
+
+template <typename argT, typename resT> struct FloorDivideInplaceFunctor
+{
+
+    using supports_sg_loadstore = std::negation<
+        std::disjunction<tu_ns::is_complex<argT>, tu_ns::is_complex<resT>>>;
+    using supports_vec = std::negation<
+        std::disjunction<tu_ns::is_complex<argT>, tu_ns::is_complex<resT>>>;
+
+    void operator()(resT &res, const argT &in)
+    {
+        res = FloorDivideFunctor<resT, argT, resT>{}(res, in);
+    }
+
+    template <int vec_sz>
+    void operator()(sycl::vec<resT, vec_sz> &res,
+                    const sycl::vec<argT, vec_sz> &in)
+    {
+        res = FloorDivideFunctor<resT, argT, resT>{}(res, in);
+    }
+};
+
+template <typename argT,
+          typename resT,
+          unsigned int vec_sz = 4,
+          unsigned int n_vecs = 2>
+using FloorDivideInplaceContigFunctor =
+    elementwise_common::BinaryInplaceContigFunctor<
+        argT,
+        resT,
+        FloorDivideInplaceFunctor<argT, resT>,
+        vec_sz,
+        n_vecs>;
+
+template <typename argT, typename resT, typename IndexerT>
+using FloorDivideInplaceStridedFunctor =
+    elementwise_common::BinaryInplaceStridedFunctor<
+        argT,
+        resT,
+        IndexerT,
+        FloorDivideInplaceFunctor<argT, resT>>;
+
+template <typename argT,
+          typename resT,
+          unsigned int vec_sz,
+          unsigned int n_vecs>
+class floor_divide_inplace_contig_kernel;
+
+template <typename argTy, typename resTy>
+sycl::event
+floor_divide_inplace_contig_impl(sycl::queue exec_q,
+                                 size_t nelems,
+                                 const char *arg_p,
+                                 py::ssize_t arg_offset,
+                                 char *res_p,
+                                 py::ssize_t res_offset,
+                                 const std::vector<sycl::event> &depends = {})
+{
+    return elementwise_common::binary_inplace_contig_impl<
+        argTy, resTy, FloorDivideInplaceContigFunctor,
+        floor_divide_inplace_contig_kernel>(exec_q, nelems, arg_p, arg_offset,
+                                            res_p, res_offset, depends);
+}
+
+template <typename fnT, typename T1, typename T2>
+struct FloorDivideInplaceContigFactory
+{
+    fnT get()
+    {
+        using resT = typename FloorDivideOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = floor_divide_inplace_contig_impl<T1, T2>;
+            return fn;
+        }
+    }
+};
+
+template <typename resT, typename argT, typename IndexerT>
+class floor_divide_inplace_strided_kernel;
+
+template <typename argTy, typename resTy>
+sycl::event floor_divide_inplace_strided_impl(
+    sycl::queue exec_q,
+    size_t nelems,
+    int nd,
+    const py::ssize_t *shape_and_strides,
+    bool use_int32_indexing,
+    const char *arg_p,
+    py::ssize_t arg_offset,
+    char *res_p,
+    py::ssize_t res_offset,
+    const std::vector<sycl::event> &depends,
+    const std::vector<sycl::event> &additional_depends)
+{
+    return elementwise_common::binary_inplace_strided_impl<
+        argTy, resTy, FloorDivideInplaceStridedFunctor,
+        floor_divide_inplace_strided_kernel>(exec_q, nelems, nd,
+                                             shape_and_strides,
+                                             use_int32_indexing, arg_p,
+                                             arg_offset, res_p, res_offset,
+                                             depends, additional_depends);
+}
+
+template <typename fnT, typename T1, typename T2>
+struct FloorDivideInplaceStridedFactory
+{
+    fnT get()
+    {
+        using resT = typename FloorDivideOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = floor_divide_inplace_strided_impl<T1, T2>;
+            return fn;
+        }
+    }
+};
+
+template <typename argT, typename resT>
+class floor_divide_inplace_row_matrix_broadcast_sg_krn;
+
+template <typename argT, typename resT>
+using FloorDivideInplaceRowMatrixBroadcastingFunctor =
+    elementwise_common::BinaryInplaceRowMatrixBroadcastingFunctor<
+        argT,
+        resT,
+        FloorDivideInplaceFunctor<argT, resT>>;
+
+template <typename argT, typename resT>
+sycl::event floor_divide_inplace_row_matrix_broadcast_impl(
+    sycl::queue exec_q,
+    std::vector<sycl::event> &host_tasks,
+    size_t n0,
+    size_t n1,
+    const char *vec_p, // typeless pointer to (n1,) contiguous row
+    py::ssize_t vec_offset,
+    char *mat_p, // typeless pointer to (n0, n1) C-contiguous matrix
+    py::ssize_t mat_offset,
+    const std::vector<sycl::event> &depends = {})
+{
+    return elementwise_common::binary_inplace_row_matrix_broadcast_impl<
+        argT, resT, FloorDivideInplaceRowMatrixBroadcastingFunctor,
+        floor_divide_inplace_row_matrix_broadcast_sg_krn>(
+        exec_q, host_tasks, n0, n1, vec_p, vec_offset, mat_p, mat_offset,
+        depends);
+}
+
+template <typename fnT, typename T1, typename T2>
+struct FloorDivideInplaceRowMatrixBroadcastFactory
+{
+    fnT get()
+    {
+        using resT = typename FloorDivideOutputType<T1, T2>::value_type;
+        if constexpr (!std::is_same_v<resT, T2>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            if constexpr (dpctl::tensor::type_utils::is_complex<T1>::value ||
+                          dpctl::tensor::type_utils::is_complex<T2>::value)
+            {
+                fnT fn = nullptr;
+                return fn;
+            }
+            else {
+                fnT fn = floor_divide_inplace_row_matrix_broadcast_impl<T1, T2>;
+                return fn;
+            }
+        }
+    }
+};
+
 } // namespace floor_divide
 } // namespace kernels
 } // namespace tensor
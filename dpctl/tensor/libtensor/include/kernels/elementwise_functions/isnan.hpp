@@ -151,6 +151,7 @@ isnan_strided_impl(sycl::queue exec_q,
                    size_t nelems,
                    int nd,
                    const py::ssize_t *shape_and_strides,
+                   bool use_int32_indexing,
                    const char *arg_p,
                    py::ssize_t arg_offset,
                    char *res_p,
@@ -160,8 +161,8 @@ isnan_strided_impl(sycl::queue exec_q,
 {
     return elementwise_common::unary_strided_impl<
         argTy, IsNanOutputType, IsNanStridedFunctor, isnan_strided_kernel>(
-        exec_q, nelems, nd, shape_and_strides, arg_p, arg_offset, res_p,
-        res_offset, depends, additional_depends);
+        exec_q, nelems, nd, shape_and_strides, use_int32_indexing, arg_p,
+        arg_offset, res_p, res_offset, depends, additional_depends);
 }
 
 template <typename fnT, typename T> struct IsNanStridedFactory
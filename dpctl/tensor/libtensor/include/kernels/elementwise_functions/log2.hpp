@@ -172,6 +172,7 @@ typedef sycl::event (*log2_strided_impl_fn_ptr_t)(
     size_t,
     int,
     const py::ssize_t *,
+    bool,
     const char *,
     py::ssize_t,
     char *,
@@ -185,6 +186,7 @@ log2_strided_impl(sycl::queue exec_q,
                   size_t nelems,
                   int nd,
                   const py::ssize_t *shape_and_strides,
+                  bool use_int32_indexing,
                   const char *arg_p,
                   py::ssize_t arg_offset,
                   char *res_p,
@@ -194,8 +196,8 @@ log2_strided_impl(sycl::queue exec_q,
 {
     return elementwise_common::unary_strided_impl<
         argTy, Log2OutputType, Log2StridedFunctor, log2_strided_kernel>(
-        exec_q, nelems, nd, shape_and_strides, arg_p, arg_offset, res_p,
-        res_offset, depends, additional_depends);
+        exec_q, nelems, nd, shape_and_strides, use_int32_indexing, arg_p,
+        arg_offset, res_p, res_offset, depends, additional_depends);
 }
 
 template <typename fnT, typename T> struct Log2StridedFactory
@@ -177,10 +177,15 @@ sycl::event logical_or_contig_impl(sycl::queue exec_q,
                                    py::ssize_t res_offset,
                                    const std::vector<sycl::event> &depends = {})
 {
+    using resTy = typename LogicalOrOutputType<argTy1, argTy2>::value_type;
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const size_t lws = lp_ns::elementwise_lws(
+        exec_q, lp_ns::kernel_family::binary_contig,
+        std::max({sizeof(argTy1), sizeof(argTy2), sizeof(resTy)}));
+
     sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
 
-        size_t lws = 64;
         constexpr unsigned int vec_sz = 4;
         constexpr unsigned int n_vecs = 2;
         const size_t n_groups =
@@ -188,8 +193,6 @@ sycl::event logical_or_contig_impl(sycl::queue exec_q,
         const auto gws_range = sycl::range<1>(n_groups * lws);
         const auto lws_range = sycl::range<1>(lws);
 
-        using resTy = typename LogicalOrOutputType<argTy1, argTy2>::value_type;
-
         const argTy1 *arg1_tp =
             reinterpret_cast<const argTy1 *>(arg1_p) + arg1_offset;
         const argTy2 *arg2_tp =
@@ -243,6 +246,7 @@ logical_or_strided_impl(sycl::queue exec_q,
                         size_t nelems,
                         int nd,
                         const py::ssize_t *shape_and_strides,
+                        bool use_int32_indexing,
                         const char *arg1_p,
                         py::ssize_t arg1_offset,
                         const char *arg2_p,
@@ -258,20 +262,26 @@ logical_or_strided_impl(sycl::queue exec_q,
 
         using resTy = typename LogicalOrOutputType<argTy1, argTy2>::value_type;
 
-        using IndexerT =
-            typename dpctl::tensor::offset_utils::ThreeOffsets_StridedIndexer;
-
-        IndexerT indexer{nd, arg1_offset, arg2_offset, res_offset,
-                         shape_and_strides};
+        using dpctl::tensor::offset_utils::dispatch_fixed_rank_indexer;
+        using dpctl::tensor::offset_utils::ThreeOffsets_FixedRankStridedIndexer;
+        using dpctl::tensor::offset_utils::ThreeOffsets_FastDivStridedIndexer;
 
         const argTy1 *arg1_tp = reinterpret_cast<const argTy1 *>(arg1_p);
         const argTy2 *arg2_tp = reinterpret_cast<const argTy2 *>(arg2_p);
         resTy *res_tp = reinterpret_cast<resTy *>(res_p);
 
-        cgh.parallel_for<
-            logical_or_strided_kernel<argTy1, argTy2, resTy, IndexerT>>(
-            {nelems}, LogicalOrStridedFunctor<argTy1, argTy2, resTy, IndexerT>(
-                          arg1_tp, arg2_tp, res_tp, indexer));
+        auto submit_kernel = [&](const auto &indexer) {
+            using IndexerT = std::decay_t<decltype(indexer)>;
+            cgh.parallel_for<
+                logical_or_strided_kernel<argTy1, argTy2, resTy, IndexerT>>(
+                {nelems},
+                LogicalOrStridedFunctor<argTy1, argTy2, resTy, IndexerT>(
+                    arg1_tp, arg2_tp, res_tp, indexer));
+        };
+        dispatch_fixed_rank_indexer<ThreeOffsets_FixedRankStridedIndexer,
+                                    ThreeOffsets_FastDivStridedIndexer>(
+            nd, use_int32_indexing, submit_kernel, arg1_offset, arg2_offset,
+            res_offset, shape_and_strides);
     });
     return comp_ev;
 }
@@ -294,6 +304,52 @@ template <typename fnT, typename T1, typename T2> struct LogicalOrStridedFactory
     }
 };
 
+template <typename T1, typename T2, typename T3, bool scalar_is_first>
+class logical_or_scalar_broadcast_krn;
+
+template <typename T1, typename T2, typename T3>
+class logical_or_2d_broadcast_krn;
+
+template <typename argTy1, typename argTy2>
+sycl::event
+logical_or_broadcast_impl(sycl::queue exec_q,
+                          int nd,
+                          const py::ssize_t *shape,
+                          const char *arg1_p,
+                          py::ssize_t arg1_offset,
+                          const py::ssize_t *arg1_strides,
+                          const char *arg2_p,
+                          py::ssize_t arg2_offset,
+                          const py::ssize_t *arg2_strides,
+                          char *res_p,
+                          py::ssize_t res_offset,
+                          const py::ssize_t *res_strides,
+                          const std::vector<sycl::event> &depends = {})
+{
+    return elementwise_common::binary_broadcast_impl<
+        argTy1, argTy2, LogicalOrOutputType, LogicalOrFunctor,
+        logical_or_scalar_broadcast_krn, logical_or_2d_broadcast_krn>(
+        exec_q, nd, shape, arg1_p, arg1_offset, arg1_strides, arg2_p,
+        arg2_offset, arg2_strides, res_p, res_offset, res_strides, depends);
+}
+
+template <typename fnT, typename T1, typename T2>
+struct LogicalOrBroadcastFactory
+{
+    fnT get()
+    {
+        using resT = typename LogicalOrOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = logical_or_broadcast_impl<T1, T2>;
+            return fn;
+        }
+    }
+};
+
 } // namespace logical_or
 } // namespace kernels
 } // namespace tensor
@@ -229,6 +229,7 @@ multiply_strided_impl(sycl::queue exec_q,
                       size_t nelems,
                       int nd,
                       const py::ssize_t *shape_and_strides,
+                      bool use_int32_indexing,
                       const char *arg1_p,
                       py::ssize_t arg1_offset,
                       const char *arg2_p,
@@ -240,9 +241,10 @@ multiply_strided_impl(sycl::queue exec_q,
 {
     return elementwise_common::binary_strided_impl<
         argTy1, argTy2, MultiplyOutputType, MultiplyStridedFunctor,
-        multiply_strided_kernel>(exec_q, nelems, nd, shape_and_strides, arg1_p,
-                                 arg1_offset, arg2_p, arg2_offset, res_p,
-                                 res_offset, depends, additional_depends);
+        multiply_strided_kernel>(exec_q, nelems, nd, shape_and_strides,
+                                 use_int32_indexing, arg1_p, arg1_offset,
+                                 arg2_p, arg2_offset, res_p, res_offset,
+                                 depends, additional_depends);
 }
 
 template <typename fnT, typename T1, typename T2> struct MultiplyStridedFactory
@@ -263,6 +265,52 @@ template <typename fnT, typename T1, typename T2> struct MultiplyStridedFactory
     }
 };
 
+template <typename T1, typename T2, typename T3, bool scalar_is_first>
+class multiply_scalar_broadcast_krn;
+
+template <typename T1, typename T2, typename T3>
+class multiply_2d_broadcast_krn;
+
+template <typename argTy1, typename argTy2>
+sycl::event
+multiply_broadcast_impl(sycl::queue exec_q,
+                        int nd,
+                        const py::ssize_t *shape,
+                        const char *arg1_p,
+                        py::ssize_t arg1_offset,
+                        const py::ssize_t *arg1_strides,
+                        const char *arg2_p,
+                        py::ssize_t arg2_offset,
+                        const py::ssize_t *arg2_strides,
+                        char *res_p,
+                        py::ssize_t res_offset,
+                        const py::ssize_t *res_strides,
+                        const std::vector<sycl::event> &depends = {})
+{
+    return elementwise_common::binary_broadcast_impl<
+        argTy1, argTy2, MultiplyOutputType, MultiplyFunctor,
+        multiply_scalar_broadcast_krn, multiply_2d_broadcast_krn>(
+        exec_q, nd, shape, arg1_p, arg1_offset, arg1_strides, arg2_p,
+        arg2_offset, arg2_strides, res_p, res_offset, res_strides, depends);
+}
+
+template <typename fnT, typename T1, typename T2>
+struct MultiplyBroadcastFactory
+{
+    fnT get()
+    {
+        using resT = typename MultiplyOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = multiply_broadcast_impl<T1, T2>;
+            return fn;
+        }
+    }
+};
+
 template <typename argT1, typename argT2, typename resT>
 class multiply_matrix_row_broadcast_sg_krn;
 
@@ -463,6 +511,7 @@ sycl::event multiply_inplace_strided_impl(
     size_t nelems,
     int nd,
     const py::ssize_t *shape_and_strides,
+    bool use_int32_indexing,
     const char *arg_p,
     py::ssize_t arg_offset,
     char *res_p,
@@ -473,8 +522,9 @@ sycl::event multiply_inplace_strided_impl(
     return elementwise_common::binary_inplace_strided_impl<
         argTy, resTy, MultiplyInplaceStridedFunctor,
         multiply_inplace_strided_kernel>(exec_q, nelems, nd, shape_and_strides,
-                                         arg_p, arg_offset, res_p, res_offset,
-                                         depends, additional_depends);
+                                         use_int32_indexing, arg_p, arg_offset,
+                                         res_p, res_offset, depends,
+                                         additional_depends);
 }
 
 template <typename fnT, typename T1, typename T2>
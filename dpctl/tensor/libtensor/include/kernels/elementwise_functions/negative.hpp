@@ -113,10 +113,15 @@ sycl::event negative_contig_impl(sycl::queue exec_q,
                                  char *res_p,
                                  const std::vector<sycl::event> &depends = {})
 {
+    using resTy = typename NegativeOutputType<argTy>::value_type;
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const size_t lws = lp_ns::elementwise_lws(
+        exec_q, lp_ns::kernel_family::unary_contig,
+        std::max(sizeof(argTy), sizeof(resTy)));
+
     sycl::event negative_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
 
-        size_t lws = 64;
         constexpr unsigned int vec_sz = 4;
         constexpr unsigned int n_vecs = 2;
         const size_t n_groups =
@@ -124,7 +129,6 @@ sycl::event negative_contig_impl(sycl::queue exec_q,
         const auto gws_range = sycl::range<1>(n_groups * lws);
         const auto lws_range = sycl::range<1>(lws);
 
-        using resTy = typename NegativeOutputType<argTy>::value_type;
         const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_p);
         resTy *res_tp = reinterpret_cast<resTy *>(res_p);
 
@@ -174,6 +178,7 @@ typedef sycl::event (*negative_strided_impl_fn_ptr_t)(
     size_t,
     int,
     const py::ssize_t *,
+    bool,
     const char *,
     py::ssize_t,
     char *,
@@ -187,6 +192,7 @@ negative_strided_impl(sycl::queue exec_q,
                       size_t nelems,
                       int nd,
                       const py::ssize_t *shape_and_strides,
+                      bool use_int32_indexing,
                       const char *arg_p,
                       py::ssize_t arg_offset,
                       char *res_p,
@@ -199,17 +205,24 @@ negative_strided_impl(sycl::queue exec_q,
         cgh.depends_on(additional_depends);
 
         using resTy = typename NegativeOutputType<argTy>::value_type;
-        using IndexerT =
-            typename dpctl::tensor::offset_utils::TwoOffsets_StridedIndexer;
-
-        IndexerT indexer{nd, arg_offset, res_offset, shape_and_strides};
+        using dpctl::tensor::offset_utils::dispatch_fixed_rank_indexer;
+        using dpctl::tensor::offset_utils::TwoOffsets_FixedRankStridedIndexer;
+        using dpctl::tensor::offset_utils::TwoOffsets_FastDivStridedIndexer;
 
         const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_p);
         resTy *res_tp = reinterpret_cast<resTy *>(res_p);
 
-        cgh.parallel_for<negative_strided_kernel<argTy, resTy, IndexerT>>(
-            {nelems}, NegativeStridedFunctor<argTy, resTy, IndexerT>(
-                          arg_tp, res_tp, indexer));
+        auto submit_kernel = [&](const auto &indexer) {
+            using IndexerT = std::decay_t<decltype(indexer)>;
+            cgh.parallel_for<negative_strided_kernel<argTy, resTy, IndexerT>>(
+                {nelems},
+                NegativeStridedFunctor<argTy, resTy, IndexerT>(
+                    arg_tp, res_tp, indexer));
+        };
+        dispatch_fixed_rank_indexer<TwoOffsets_FixedRankStridedIndexer,
+                                    TwoOffsets_FastDivStridedIndexer>(
+            nd, use_int32_indexing, submit_kernel, arg_offset, res_offset,
+            shape_and_strides);
     });
     return negative_ev;
 }
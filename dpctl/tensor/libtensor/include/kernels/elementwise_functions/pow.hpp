@@ -35,6 +35,7 @@
 #include "utils/type_utils.hpp"
 
 #include "kernels/elementwise_functions/common.hpp"
+#include "kernels/elementwise_functions/common_inplace.hpp"
 #include <pybind11/pybind11.h>
 
 namespace dpctl
@@ -254,6 +255,7 @@ sycl::event pow_strided_impl(sycl::queue exec_q,
                              size_t nelems,
                              int nd,
                              const py::ssize_t *shape_and_strides,
+                             bool use_int32_indexing,
                              const char *arg1_p,
                              py::ssize_t arg1_offset,
                              const char *arg2_p,
@@ -266,8 +268,9 @@ sycl::event pow_strided_impl(sycl::queue exec_q,
     return elementwise_common::binary_strided_impl<
         argTy1, argTy2, PowOutputType, PowStridedFunctor,
         pow_strided_strided_kernel>(
-        exec_q, nelems, nd, shape_and_strides, arg1_p, arg1_offset, arg2_p,
-        arg2_offset, res_p, res_offset, depends, additional_depends);
+        exec_q, nelems, nd, shape_and_strides, use_int32_indexing, arg1_p,
+        arg1_offset, arg2_p, arg2_offset, res_p, res_offset, depends,
+        additional_depends);
 }
 
 template <typename fnT, typename T1, typename T2> struct PowStridedFactory
@@ -286,6 +289,228 @@ template <typename fnT, typename T1, typename T2> struct PowStridedFactory
     }
 };
 
+template <typename T1, typename T2, typename T3, bool scalar_is_first>
+class pow_scalar_broadcast_krn;
+
+template <typename T1, typename T2, typename T3>
+class pow_2d_broadcast_krn;
+
+template <typename argTy1, typename argTy2>
+sycl::event pow_broadcast_impl(sycl::queue exec_q,
+                               int nd,
+                               const py::ssize_t *shape,
+                               const char *arg1_p,
+                               py::ssize_t arg1_offset,
+                               const py::ssize_t *arg1_strides,
+                               const char *arg2_p,
+                               py::ssize_t arg2_offset,
+                               const py::ssize_t *arg2_strides,
+                               char *res_p,
+                               py::ssize_t res_offset,
+                               const py::ssize_t *res_strides,
+                               const std::vector<sycl::event> &depends = {})
+{
+    return elementwise_common::binary_broadcast_impl<
+        argTy1, argTy2, PowOutputType, PowFunctor, pow_scalar_broadcast_krn,
+        pow_2d_broadcast_krn>(
+        exec_q, nd, shape, arg1_p, arg1_offset, arg1_strides, arg2_p,
+        arg2_offset, arg2_strides, res_p, res_offset, res_strides, depends);
+}
+
+template <typename fnT, typename T1, typename T2> struct PowBroadcastFactory
+{
+    fnT get()
+    {
+        using resT = typename PowOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = pow_broadcast_impl<T1, T2>;
+            return fn;
+        }
+    }
+};
+
+template <typename argT, typename resT> struct PowInplaceFunctor
+{
+
+    using supports_sg_loadstore = std::negation<
+        std::disjunction<tu_ns::is_complex<argT>, tu_ns::is_complex<resT>>>;
+    using supports_vec =
+        std::negation<std::disjunction<tu_ns::is_complex<argT>,
+                                       tu_ns::is_complex<resT>,
+                                       std::is_integral<argT>,
+                                       std::is_integral<resT>>>;
+
+    void operator()(resT &res, const argT &in)
+    {
+        res = PowFunctor<resT, argT, resT>{}(res, in);
+    }
+
+    template <int vec_sz>
+    void operator()(sycl::vec<resT, vec_sz> &res,
+                    const sycl::vec<argT, vec_sz> &in)
+    {
+        res = PowFunctor<resT, argT, resT>{}(res, in);
+    }
+};
+
+template <typename argT,
+          typename resT,
+          unsigned int vec_sz = 4,
+          unsigned int n_vecs = 2>
+using PowInplaceContigFunctor =
+    elementwise_common::BinaryInplaceContigFunctor<
+        argT,
+        resT,
+        PowInplaceFunctor<argT, resT>,
+        vec_sz,
+        n_vecs>;
+
+template <typename argT, typename resT, typename IndexerT>
+using PowInplaceStridedFunctor =
+    elementwise_common::BinaryInplaceStridedFunctor<
+        argT,
+        resT,
+        IndexerT,
+        PowInplaceFunctor<argT, resT>>;
+
+template <typename argT,
+          typename resT,
+          unsigned int vec_sz,
+          unsigned int n_vecs>
+class pow_inplace_contig_kernel;
+
+template <typename argTy, typename resTy>
+sycl::event
+pow_inplace_contig_impl(sycl::queue exec_q,
+                        size_t nelems,
+                        const char *arg_p,
+                        py::ssize_t arg_offset,
+                        char *res_p,
+                        py::ssize_t res_offset,
+                        const std::vector<sycl::event> &depends = {})
+{
+    return elementwise_common::binary_inplace_contig_impl<
+        argTy, resTy, PowInplaceContigFunctor,
+        pow_inplace_contig_kernel>(exec_q, nelems, arg_p, arg_offset, res_p,
+                                   res_offset, depends);
+}
+
+template <typename fnT, typename T1, typename T2> struct PowInplaceContigFactory
+{
+    fnT get()
+    {
+        using resT = typename PowOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = pow_inplace_contig_impl<T1, T2>;
+            return fn;
+        }
+    }
+};
+
+template <typename resT, typename argT, typename IndexerT>
+class pow_inplace_strided_kernel;
+
+template <typename argTy, typename resTy>
+sycl::event pow_inplace_strided_impl(
+    sycl::queue exec_q,
+    size_t nelems,
+    int nd,
+    const py::ssize_t *shape_and_strides,
+    bool use_int32_indexing,
+    const char *arg_p,
+    py::ssize_t arg_offset,
+    char *res_p,
+    py::ssize_t res_offset,
+    const std::vector<sycl::event> &depends,
+    const std::vector<sycl::event> &additional_depends)
+{
+    return elementwise_common::binary_inplace_strided_impl<
+        argTy, resTy, PowInplaceStridedFunctor,
+        pow_inplace_strided_kernel>(exec_q, nelems, nd, shape_and_strides,
+                                    use_int32_indexing, arg_p, arg_offset,
+                                    res_p, res_offset, depends,
+                                    additional_depends);
+}
+
+template <typename fnT, typename T1, typename T2>
+struct PowInplaceStridedFactory
+{
+    fnT get()
+    {
+        using resT = typename PowOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = pow_inplace_strided_impl<T1, T2>;
+            return fn;
+        }
+    }
+};
+
+template <typename argT, typename resT>
+class pow_inplace_row_matrix_broadcast_sg_krn;
+
+template <typename argT, typename resT>
+using PowInplaceRowMatrixBroadcastingFunctor =
+    elementwise_common::BinaryInplaceRowMatrixBroadcastingFunctor<
+        argT,
+        resT,
+        PowInplaceFunctor<argT, resT>>;
+
+template <typename argT, typename resT>
+sycl::event pow_inplace_row_matrix_broadcast_impl(
+    sycl::queue exec_q,
+    std::vector<sycl::event> &host_tasks,
+    size_t n0,
+    size_t n1,
+    const char *vec_p, // typeless pointer to (n1,) contiguous row
+    py::ssize_t vec_offset,
+    char *mat_p, // typeless pointer to (n0, n1) C-contiguous matrix
+    py::ssize_t mat_offset,
+    const std::vector<sycl::event> &depends = {})
+{
+    return elementwise_common::binary_inplace_row_matrix_broadcast_impl<
+        argT, resT, PowInplaceRowMatrixBroadcastingFunctor,
+        pow_inplace_row_matrix_broadcast_sg_krn>(
+        exec_q, host_tasks, n0, n1, vec_p, vec_offset, mat_p, mat_offset,
+        depends);
+}
+
+template <typename fnT, typename T1, typename T2>
+struct PowInplaceRowMatrixBroadcastFactory
+{
+    fnT get()
+    {
+        using resT = typename PowOutputType<T1, T2>::value_type;
+        if constexpr (!std::is_same_v<resT, T2>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            if constexpr (dpctl::tensor::type_utils::is_complex<T1>::value ||
+                          dpctl::tensor::type_utils::is_complex<T2>::value)
+            {
+                fnT fn = nullptr;
+                return fn;
+            }
+            else {
+                fnT fn = pow_inplace_row_matrix_broadcast_impl<T1, T2>;
+                return fn;
+            }
+        }
+    }
+};
+
 } // namespace pow
 } // namespace kernels
 } // namespace tensor
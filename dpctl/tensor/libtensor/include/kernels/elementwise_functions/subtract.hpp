@@ -226,6 +226,7 @@ subtract_strided_impl(sycl::queue exec_q,
                       size_t nelems,
                       int nd,
                       const py::ssize_t *shape_and_strides,
+                      bool use_int32_indexing,
                       const char *arg1_p,
                       py::ssize_t arg1_offset,
                       const char *arg2_p,
@@ -237,9 +238,10 @@ subtract_strided_impl(sycl::queue exec_q,
 {
     return elementwise_common::binary_strided_impl<
         argTy1, argTy2, SubtractOutputType, SubtractStridedFunctor,
-        subtract_strided_kernel>(exec_q, nelems, nd, shape_and_strides, arg1_p,
-                                 arg1_offset, arg2_p, arg2_offset, res_p,
-                                 res_offset, depends, additional_depends);
+        subtract_strided_kernel>(exec_q, nelems, nd, shape_and_strides,
+                                 use_int32_indexing, arg1_p, arg1_offset,
+                                 arg2_p, arg2_offset, res_p, res_offset,
+                                 depends, additional_depends);
 }
 
 template <typename fnT, typename T1, typename T2> struct SubtractStridedFactory
@@ -260,6 +262,52 @@ template <typename fnT, typename T1, typename T2> struct SubtractStridedFactory
     }
 };
 
+template <typename T1, typename T2, typename T3, bool scalar_is_first>
+class subtract_scalar_broadcast_krn;
+
+template <typename T1, typename T2, typename T3>
+class subtract_2d_broadcast_krn;
+
+template <typename argTy1, typename argTy2>
+sycl::event
+subtract_broadcast_impl(sycl::queue exec_q,
+                        int nd,
+                        const py::ssize_t *shape,
+                        const char *arg1_p,
+                        py::ssize_t arg1_offset,
+                        const py::ssize_t *arg1_strides,
+                        const char *arg2_p,
+                        py::ssize_t arg2_offset,
+                        const py::ssize_t *arg2_strides,
+                        char *res_p,
+                        py::ssize_t res_offset,
+                        const py::ssize_t *res_strides,
+                        const std::vector<sycl::event> &depends = {})
+{
+    return elementwise_common::binary_broadcast_impl<
+        argTy1, argTy2, SubtractOutputType, SubtractFunctor,
+        subtract_scalar_broadcast_krn, subtract_2d_broadcast_krn>(
+        exec_q, nd, shape, arg1_p, arg1_offset, arg1_strides, arg2_p,
+        arg2_offset, arg2_strides, res_p, res_offset, res_strides, depends);
+}
+
+template <typename fnT, typename T1, typename T2>
+struct SubtractBroadcastFactory
+{
+    fnT get()
+    {
+        using resT = typename SubtractOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = subtract_broadcast_impl<T1, T2>;
+            return fn;
+        }
+    }
+};
+
 template <typename argT1, typename argT2, typename resT>
 using SubtractContigMatrixContigRowBroadcastingFunctor =
     elementwise_common::BinaryContigMatrixContigRowBroadcastingFunctor<
@@ -476,6 +524,7 @@ sycl::event subtract_inplace_strided_impl(
     size_t nelems,
     int nd,
     const py::ssize_t *shape_and_strides,
+    bool use_int32_indexing,
     const char *arg_p,
     py::ssize_t arg_offset,
     char *res_p,
@@ -486,8 +535,9 @@ sycl::event subtract_inplace_strided_impl(
     return elementwise_common::binary_inplace_strided_impl<
         argTy, resTy, SubtractInplaceStridedFunctor,
         subtract_inplace_strided_kernel>(exec_q, nelems, nd, shape_and_strides,
-                                         arg_p, arg_offset, res_p, res_offset,
-                                         depends, additional_depends);
+                                         use_int32_indexing, arg_p, arg_offset,
+                                         res_p, res_offset, depends,
+                                         additional_depends);
 }
 
 template <typename fnT, typename T1, typename T2>
@@ -0,0 +1,323 @@
+//=== dot_product.hpp - Implementation of dot product kernels --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels for batched dot products of strided vectors.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "kernels/linalg_functions/gemm.hpp"
+#include "pybind11/pybind11.h"
+#include "utils/offset_utils.hpp"
+#include "utils/sycl_utils.hpp"
+#include "utils/type_dispatch.hpp"
+#include "utils/type_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace linalg
+{
+
+namespace py = pybind11;
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+template <typename lhsT,
+          typename rhsT,
+          typename resT,
+          typename BatchIndexerT>
+struct SequentialDotProduct
+{
+private:
+    const lhsT *lhs = nullptr;
+    const rhsT *rhs = nullptr;
+    resT *res = nullptr;
+    BatchIndexerT batch_indexer;
+    size_t reduction_nelems = 0;
+    py::ssize_t lhs_reduction_stride = 0;
+    py::ssize_t rhs_reduction_stride = 0;
+
+public:
+    SequentialDotProduct(const lhsT *lhs_tp,
+                         const rhsT *rhs_tp,
+                         resT *res_tp,
+                         BatchIndexerT batch_indexer_,
+                         size_t reduction_size,
+                         py::ssize_t lhs_reduction_stride_,
+                         py::ssize_t rhs_reduction_stride_)
+        : lhs(lhs_tp), rhs(rhs_tp), res(res_tp), batch_indexer(batch_indexer_),
+          reduction_nelems(reduction_size),
+          lhs_reduction_stride(lhs_reduction_stride_),
+          rhs_reduction_stride(rhs_reduction_stride_)
+    {
+    }
+
+    void operator()(sycl::id<1> id) const
+    {
+        const auto &batch_offsets = batch_indexer(id[0]);
+        const py::ssize_t lhs_offset = batch_offsets.get_first_offset();
+        const py::ssize_t rhs_offset = batch_offsets.get_second_offset();
+        const py::ssize_t res_offset = batch_offsets.get_third_offset();
+
+        using dpctl::tensor::type_utils::convert_impl;
+
+        resT red_val(0);
+        for (size_t m = 0; m < reduction_nelems; ++m) {
+            const py::ssize_t pos = static_cast<py::ssize_t>(m);
+            red_val = fma_impl<resT>(
+                red_val,
+                convert_impl<resT, lhsT>(
+                    lhs[lhs_offset + pos * lhs_reduction_stride]),
+                convert_impl<resT, rhsT>(
+                    rhs[rhs_offset + pos * rhs_reduction_stride]));
+        }
+
+        res[res_offset] = red_val;
+    }
+};
+
+/*
+  Each work-group computes one dot product. Work-items accumulate partial
+  products of elements spaced by work-group size, and partial results are
+  combined by a tree reduction in local memory. The order of accumulation
+  does not depend on scheduling, so results are reproducible.
+*/
+template <typename lhsT,
+          typename rhsT,
+          typename resT,
+          typename LocAccT,
+          typename BatchIndexerT>
+struct DotProductOverGroupFunctor
+{
+private:
+    const lhsT *lhs = nullptr;
+    const rhsT *rhs = nullptr;
+    resT *res = nullptr;
+    LocAccT local_red;
+    BatchIndexerT batch_indexer;
+    size_t reduction_nelems = 0;
+    py::ssize_t lhs_reduction_stride = 0;
+    py::ssize_t rhs_reduction_stride = 0;
+
+public:
+    DotProductOverGroupFunctor(const lhsT *lhs_tp,
+                               const rhsT *rhs_tp,
+                               resT *res_tp,
+                               LocAccT local_red_,
+                               BatchIndexerT batch_indexer_,
+                               size_t reduction_size,
+                               py::ssize_t lhs_reduction_stride_,
+                               py::ssize_t rhs_reduction_stride_)
+        : lhs(lhs_tp), rhs(rhs_tp), res(res_tp), local_red(local_red_),
+          batch_indexer(batch_indexer_), reduction_nelems(reduction_size),
+          lhs_reduction_stride(lhs_reduction_stride_),
+          rhs_reduction_stride(rhs_reduction_stride_)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const size_t batch_id = it.get_group(0);
+        const size_t lid = it.get_local_id(0);
+        const size_t wg = it.get_local_range(0);
+
+        const auto &batch_offsets = batch_indexer(batch_id);
+        const py::ssize_t lhs_offset = batch_offsets.get_first_offset();
+        const py::ssize_t rhs_offset = batch_offsets.get_second_offset();
+        const py::ssize_t res_offset = batch_offsets.get_third_offset();
+
+        using dpctl::tensor::type_utils::convert_impl;
+
+        resT local_val(0);
+        for (size_t m = lid; m < reduction_nelems; m += wg) {
+            const py::ssize_t pos = static_cast<py::ssize_t>(m);
+            local_val = fma_impl<resT>(
+                local_val,
+                convert_impl<resT, lhsT>(
+                    lhs[lhs_offset + pos * lhs_reduction_stride]),
+                convert_impl<resT, rhsT>(
+                    rhs[rhs_offset + pos * rhs_reduction_stride]));
+        }
+        local_red[lid] = local_val;
+
+        // wg is a power of two
+        for (size_t s = wg / 2; s > 0; s >>= 1) {
+            it.barrier(sycl::access::fence_space::local_space);
+            if (lid < s) {
+                if constexpr (std::is_same_v<resT, bool>) {
+                    local_red[lid] = local_red[lid] || local_red[lid + s];
+                }
+                else {
+                    local_red[lid] =
+                        static_cast<resT>(local_red[lid] + local_red[lid + s]);
+                }
+            }
+        }
+
+        if (lid == 0) {
+            res[res_offset] = local_red[0];
+        }
+    }
+};
+
+template <typename T1, typename T2, typename T3, typename T4>
+class dot_product_seq_krn;
+
+template <typename T1, typename T2, typename T3, typename T4>
+class dot_product_over_group_krn;
+
+typedef sycl::event (*dot_product_impl_fn_ptr_t)(
+    sycl::queue,
+    size_t,
+    size_t,
+    const char *,
+    const char *,
+    char *,
+    int,
+    const py::ssize_t *,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    const std::vector<sycl::event> &);
+
+/*!
+ * @brief Computes res[b] = sum(lhs[b, l] * rhs[b, l], 0 <= l < k) for each
+ * batch 0 <= b < batch_nelems.
+ *
+ * Batch dimensions are described by packed shape and strides of lhs, rhs and
+ * res, as expected by ThreeOffsets_StridedIndexer.
+ */
+template <typename lhsTy, typename rhsTy, typename resTy>
+sycl::event dot_product_impl(sycl::queue exec_q,
+                             size_t batch_nelems,
+                             size_t reduction_nelems,
+                             const char *lhs_cp,
+                             const char *rhs_cp,
+                             char *res_cp,
+                             int batch_nd,
+                             const py::ssize_t *batch_shape_strides,
+                             py::ssize_t lhs_batch_offset,
+                             py::ssize_t rhs_batch_offset,
+                             py::ssize_t res_batch_offset,
+                             py::ssize_t lhs_reduction_stride,
+                             py::ssize_t rhs_reduction_stride,
+                             const std::vector<sycl::event> &depends)
+{
+    const lhsTy *lhs_tp = reinterpret_cast<const lhsTy *>(lhs_cp);
+    const rhsTy *rhs_tp = reinterpret_cast<const rhsTy *>(rhs_cp);
+    resTy *res_tp = reinterpret_cast<resTy *>(res_cp);
+
+    using BatchIndexerT =
+        dpctl::tensor::offset_utils::ThreeOffsets_StridedIndexer;
+
+    const sycl::device &d = exec_q.get_device();
+    const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
+    using dpctl::tensor::sycl_utils::choose_workgroup_size;
+    size_t wg = choose_workgroup_size<4>(reduction_nelems, sg_sizes);
+
+    if (reduction_nelems < wg || batch_nelems >= 4 * wg) {
+        // short vectors, or enough independent dot products to occupy
+        // the device
+        sycl::event dot_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+
+            BatchIndexerT batch_indexer{batch_nd, lhs_batch_offset,
+                                        rhs_batch_offset, res_batch_offset,
+                                        batch_shape_strides};
+
+            using KernelName =
+                class dot_product_seq_krn<lhsTy, rhsTy, resTy, BatchIndexerT>;
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(batch_nelems),
+                SequentialDotProduct<lhsTy, rhsTy, resTy, BatchIndexerT>(
+                    lhs_tp, rhs_tp, res_tp, batch_indexer, reduction_nelems,
+                    lhs_reduction_stride, rhs_reduction_stride));
+        });
+
+        return dot_ev;
+    }
+
+    // round work-group size down to power of two for tree reduction
+    const size_t max_wg =
+        d.get_info<sycl::info::device::max_work_group_size>();
+    size_t wg_pow2 = 1;
+    while (2 * wg_pow2 <= max_wg && 2 * wg_pow2 <= reduction_nelems) {
+        wg_pow2 *= 2;
+    }
+    wg = std::min<size_t>(wg_pow2, (d.is_cpu()) ? 64 : 256);
+
+    sycl::event dot_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        BatchIndexerT batch_indexer{batch_nd, lhs_batch_offset,
+                                    rhs_batch_offset, res_batch_offset,
+                                    batch_shape_strides};
+
+        using LocAccT = sycl::local_accessor<resTy, 1>;
+        LocAccT local_red(wg, cgh);
+
+        using KernelName = class dot_product_over_group_krn<lhsTy, rhsTy,
+                                                            resTy,
+                                                            BatchIndexerT>;
+        cgh.parallel_for<KernelName>(
+            sycl::nd_range<1>(sycl::range<1>(batch_nelems * wg),
+                              sycl::range<1>(wg)),
+            DotProductOverGroupFunctor<lhsTy, rhsTy, resTy, LocAccT,
+                                       BatchIndexerT>(
+                lhs_tp, rhs_tp, res_tp, local_red, batch_indexer,
+                reduction_nelems, lhs_reduction_stride, rhs_reduction_stride));
+    });
+
+    return dot_ev;
+}
+
+template <typename fnT, typename T1, typename T2> struct DotProductFactory
+{
+    fnT get()
+    {
+        using resT = typename DotProductOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = dot_product_impl<T1, T2, resT>;
+            return fn;
+        }
+    }
+};
+
+} // namespace linalg
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
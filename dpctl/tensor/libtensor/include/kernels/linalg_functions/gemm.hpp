@@ -0,0 +1,516 @@
+//=== gemm.hpp - Implementation of matrix multiplication kernels -*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels for batched matrix multiplication of stacks of
+/// strided matrices.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "pybind11/pybind11.h"
+#include "utils/offset_utils.hpp"
+#include "utils/type_dispatch.hpp"
+#include "utils/type_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace linalg
+{
+
+namespace py = pybind11;
+namespace td_ns = dpctl::tensor::type_dispatch;
+namespace tu_ns = dpctl::tensor::type_utils;
+
+/*! @brief Multiply-accumulate used by linear algebra kernels.
+
+  For boolean types the product is logical and, and the accumulation is
+  logical or, which follows from conversion of integral sum back to bool.
+ */
+template <typename resT> resT fma_impl(resT acc, resT a, resT b)
+{
+    if constexpr (std::is_same_v<resT, bool>) {
+        return acc || (a && b);
+    }
+    else {
+        return static_cast<resT>(acc + a * b);
+    }
+}
+
+/*
+  Each work-group computes a (wg_rows * wi_m, wg_cols * wi_n) tile of the
+  result matrix of one batch. Tiles of the left-hand side and of the
+  right-hand side matrices of width k_tile along the contracted dimension
+  are staged in local memory, converted to the result type. Each work-item
+  accumulates its (wi_m, wi_n) block of results in private memory. Rows and
+  columns of the block are interleaved with stride wg_rows and wg_cols
+  respectively, so that adjacent work-items write adjacent elements of the
+  result.
+*/
+template <typename lhsT,
+          typename rhsT,
+          typename resT,
+          typename LocAccT,
+          typename BatchIndexerT,
+          size_t wi_m,
+          size_t wi_n>
+struct GemmBatchTiledFunctor
+{
+private:
+    const lhsT *lhs = nullptr;
+    const rhsT *rhs = nullptr;
+    resT *res = nullptr;
+    LocAccT local_lhs_block;
+    LocAccT local_rhs_block;
+    size_t n = 0;
+    size_t k = 0;
+    size_t m = 0;
+    size_t k_tile = 1;
+    BatchIndexerT batch_indexer;
+    py::ssize_t lhs_row_stride = 0;
+    py::ssize_t lhs_inner_stride = 0;
+    py::ssize_t rhs_inner_stride = 0;
+    py::ssize_t rhs_col_stride = 0;
+    py::ssize_t res_row_stride = 0;
+    py::ssize_t res_col_stride = 0;
+
+public:
+    GemmBatchTiledFunctor(const lhsT *lhs_tp,
+                          const rhsT *rhs_tp,
+                          resT *res_tp,
+                          LocAccT local_lhs_block_,
+                          LocAccT local_rhs_block_,
+                          size_t n_,
+                          size_t k_,
+                          size_t m_,
+                          size_t k_tile_,
+                          BatchIndexerT batch_indexer_,
+                          py::ssize_t lhs_row_stride_,
+                          py::ssize_t lhs_inner_stride_,
+                          py::ssize_t rhs_inner_stride_,
+                          py::ssize_t rhs_col_stride_,
+                          py::ssize_t res_row_stride_,
+                          py::ssize_t res_col_stride_)
+        : lhs(lhs_tp), rhs(rhs_tp), res(res_tp),
+          local_lhs_block(local_lhs_block_), local_rhs_block(local_rhs_block_),
+          n(n_), k(k_), m(m_), k_tile(k_tile_), batch_indexer(batch_indexer_),
+          lhs_row_stride(lhs_row_stride_), lhs_inner_stride(lhs_inner_stride_),
+          rhs_inner_stride(rhs_inner_stride_), rhs_col_stride(rhs_col_stride_),
+          res_row_stride(res_row_stride_), res_col_stride(res_col_stride_)
+    {
+    }
+
+    void operator()(sycl::nd_item<3> it) const
+    {
+        const size_t batch_id = it.get_group(0);
+
+        const size_t wg_rows = it.get_local_range(1);
+        const size_t wg_cols = it.get_local_range(2);
+        const size_t lr = it.get_local_id(1);
+        const size_t lc = it.get_local_id(2);
+        const size_t lid = lr * wg_cols + lc;
+        const size_t wg_size = wg_rows * wg_cols;
+
+        const size_t tile_rows = wg_rows * wi_m;
+        const size_t tile_cols = wg_cols * wi_n;
+        const size_t row0 = it.get_group(1) * tile_rows;
+        const size_t col0 = it.get_group(2) * tile_cols;
+
+        const auto &batch_offsets = batch_indexer(batch_id);
+        const py::ssize_t lhs_batch_offset = batch_offsets.get_first_offset();
+        const py::ssize_t rhs_batch_offset = batch_offsets.get_second_offset();
+        const py::ssize_t res_batch_offset = batch_offsets.get_third_offset();
+
+        using tu_ns::convert_impl;
+        constexpr resT zero(0);
+
+        resT private_res[wi_m][wi_n];
+#pragma unroll
+        for (size_t i = 0; i < wi_m; ++i) {
+#pragma unroll
+            for (size_t j = 0; j < wi_n; ++j) {
+                private_res[i][j] = zero;
+            }
+        }
+
+        for (size_t k0 = 0; k0 < k; k0 += k_tile) {
+            // stage (tile_rows, k_tile) block of lhs, consecutive work-items
+            // read consecutive elements along the contracted dimension
+            for (size_t idx = lid; idx < tile_rows * k_tile; idx += wg_size) {
+                const size_t r = idx / k_tile;
+                const size_t kk = idx - r * k_tile;
+                const size_t gr = row0 + r;
+                const size_t gk = k0 + kk;
+                local_lhs_block[idx] =
+                    (gr < n && gk < k)
+                        ? convert_impl<resT, lhsT>(
+                              lhs[lhs_batch_offset +
+                                  static_cast<py::ssize_t>(gr) *
+                                      lhs_row_stride +
+                                  static_cast<py::ssize_t>(gk) *
+                                      lhs_inner_stride])
+                        : zero;
+            }
+            // stage (k_tile, tile_cols) block of rhs, consecutive work-items
+            // read consecutive columns
+            for (size_t idx = lid; idx < k_tile * tile_cols; idx += wg_size) {
+                const size_t kk = idx / tile_cols;
+                const size_t c = idx - kk * tile_cols;
+                const size_t gk = k0 + kk;
+                const size_t gc = col0 + c;
+                local_rhs_block[idx] =
+                    (gk < k && gc < m)
+                        ? convert_impl<resT, rhsT>(
+                              rhs[rhs_batch_offset +
+                                  static_cast<py::ssize_t>(gk) *
+                                      rhs_inner_stride +
+                                  static_cast<py::ssize_t>(gc) *
+                                      rhs_col_stride])
+                        : zero;
+            }
+
+            it.barrier(sycl::access::fence_space::local_space);
+
+            for (size_t kk = 0; kk < k_tile; ++kk) {
+                resT lhs_vals[wi_m];
+                resT rhs_vals[wi_n];
+#pragma unroll
+                for (size_t i = 0; i < wi_m; ++i) {
+                    lhs_vals[i] =
+                        local_lhs_block[(lr + i * wg_rows) * k_tile + kk];
+                }
+#pragma unroll
+                for (size_t j = 0; j < wi_n; ++j) {
+                    rhs_vals[j] =
+                        local_rhs_block[kk * tile_cols + lc + j * wg_cols];
+                }
+#pragma unroll
+                for (size_t i = 0; i < wi_m; ++i) {
+#pragma unroll
+                    for (size_t j = 0; j < wi_n; ++j) {
+                        private_res[i][j] = fma_impl<resT>(
+                            private_res[i][j], lhs_vals[i], rhs_vals[j]);
+                    }
+                }
+            }
+
+            it.barrier(sycl::access::fence_space::local_space);
+        }
+
+#pragma unroll
+        for (size_t i = 0; i < wi_m; ++i) {
+            const size_t gr = row0 + lr + i * wg_rows;
+            if (gr < n) {
+#pragma unroll
+                for (size_t j = 0; j < wi_n; ++j) {
+                    const size_t gc = col0 + lc + j * wg_cols;
+                    if (gc < m) {
+                        res[res_batch_offset +
+                            static_cast<py::ssize_t>(gr) * res_row_stride +
+                            static_cast<py::ssize_t>(gc) * res_col_stride] =
+                            private_res[i][j];
+                    }
+                }
+            }
+        }
+    }
+};
+
+/*! @brief Number of result rows and columns computed by one work-item */
+template <typename T> struct GemmWorkItemBlock
+{
+    // complex types need twice as many registers per accumulator
+    static constexpr size_t rows = (tu_ns::is_complex<T>::value) ? 2 : 4;
+    static constexpr size_t cols = (tu_ns::is_complex<T>::value) ? 2 : 4;
+};
+
+/*! @brief Choose work-group shape and depth of the local memory tile.
+
+  On CPU devices work-groups are mapped onto a single hardware thread, and
+  local memory is ordinary cached memory. Small work-groups with a deep
+  contracted-dimension tile keep the staged blocks resident in L1 and give
+  each hardware thread a long run of independent multiply-adds. On GPU
+  devices larger work-groups are needed to hide memory latency.
+ */
+template <typename resT, size_t wi_m, size_t wi_n>
+void choose_gemm_tiling(const sycl::device &d,
+                        size_t n,
+                        size_t k,
+                        size_t m,
+                        size_t &wg_rows,
+                        size_t &wg_cols,
+                        size_t &k_tile)
+{
+    const bool is_cpu = d.is_cpu();
+    const size_t max_wg =
+        d.get_info<sycl::info::device::max_work_group_size>();
+    const size_t local_mem_size =
+        d.get_info<sycl::info::device::local_mem_size>();
+
+    const size_t target_wg = std::min<size_t>((is_cpu) ? 64 : 256, max_wg);
+    const size_t max_wg_cols = (is_cpu) ? 8 : 16;
+
+    const size_t cols_needed = (m + wi_n - 1) / wi_n;
+    wg_cols = 1;
+    while (2 * wg_cols <= target_wg && 2 * wg_cols <= max_wg_cols &&
+           wg_cols < cols_needed)
+    {
+        wg_cols *= 2;
+    }
+
+    const size_t rows_needed = (n + wi_m - 1) / wi_m;
+    wg_rows = 1;
+    while (2 * wg_rows * wg_cols <= target_wg && wg_rows < rows_needed) {
+        wg_rows *= 2;
+    }
+
+    k_tile = (is_cpu) ? 32 : 16;
+    while (k_tile > 1 && k_tile / 2 >= k) {
+        k_tile /= 2;
+    }
+
+    // both staged blocks must fit into local memory
+    auto slm_bytes = [&](size_t kt) {
+        return (wg_rows * wi_m + wg_cols * wi_n) * kt * sizeof(resT);
+    };
+    while (k_tile > 1 && slm_bytes(k_tile) > local_mem_size) {
+        k_tile /= 2;
+    }
+}
+
+template <typename T1,
+          typename T2,
+          typename T3,
+          typename T4,
+          size_t wi_m,
+          size_t wi_n>
+class gemm_batch_tiled_krn;
+
+typedef sycl::event (*gemm_batch_impl_fn_ptr_t)(
+    sycl::queue,
+    const char *,
+    const char *,
+    char *,
+    size_t,
+    size_t,
+    size_t,
+    size_t,
+    int,
+    const py::ssize_t *,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    const std::vector<sycl::event> &);
+
+/*!
+ * @brief Computes res[b, i, j] = sum(lhs[b, i, l] * rhs[b, l, j], 0 <= l < k)
+ * for each batch 0 <= b < batch_nelems.
+ *
+ * Batch dimensions are described by packed shape and strides of lhs, rhs and
+ * res, as expected by ThreeOffsets_StridedIndexer. Broadcast batch
+ * dimensions have zero strides. Matrix dimensions may have arbitrary strides.
+ */
+template <typename lhsTy, typename rhsTy, typename resTy>
+sycl::event gemm_batch_impl(sycl::queue exec_q,
+                            const char *lhs_cp,
+                            const char *rhs_cp,
+                            char *res_cp,
+                            size_t batch_nelems,
+                            size_t n,
+                            size_t k,
+                            size_t m,
+                            int batch_nd,
+                            const py::ssize_t *batch_shape_strides,
+                            py::ssize_t lhs_batch_offset,
+                            py::ssize_t rhs_batch_offset,
+                            py::ssize_t res_batch_offset,
+                            py::ssize_t lhs_row_stride,
+                            py::ssize_t lhs_inner_stride,
+                            py::ssize_t rhs_inner_stride,
+                            py::ssize_t rhs_col_stride,
+                            py::ssize_t res_row_stride,
+                            py::ssize_t res_col_stride,
+                            const std::vector<sycl::event> &depends)
+{
+    const lhsTy *lhs_tp = reinterpret_cast<const lhsTy *>(lhs_cp);
+    const rhsTy *rhs_tp = reinterpret_cast<const rhsTy *>(rhs_cp);
+    resTy *res_tp = reinterpret_cast<resTy *>(res_cp);
+
+    constexpr size_t wi_m = GemmWorkItemBlock<resTy>::rows;
+    constexpr size_t wi_n = GemmWorkItemBlock<resTy>::cols;
+
+    size_t wg_rows(1);
+    size_t wg_cols(1);
+    size_t k_tile(1);
+    choose_gemm_tiling<resTy, wi_m, wi_n>(exec_q.get_device(), n, k, m,
+                                          wg_rows, wg_cols, k_tile);
+
+    const size_t tile_rows = wg_rows * wi_m;
+    const size_t tile_cols = wg_cols * wi_n;
+    const size_t n_row_groups = (n + tile_rows - 1) / tile_rows;
+    const size_t n_col_groups = (m + tile_cols - 1) / tile_cols;
+
+    sycl::event gemm_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        using BatchIndexerT =
+            dpctl::tensor::offset_utils::ThreeOffsets_StridedIndexer;
+        BatchIndexerT batch_indexer{batch_nd, lhs_batch_offset,
+                                    rhs_batch_offset, res_batch_offset,
+                                    batch_shape_strides};
+
+        using LocAccT = sycl::local_accessor<resTy, 1>;
+        LocAccT local_lhs_block(tile_rows * k_tile, cgh);
+        LocAccT local_rhs_block(k_tile * tile_cols, cgh);
+
+        auto gwsRange = sycl::range<3>(batch_nelems, n_row_groups * wg_rows,
+                                       n_col_groups * wg_cols);
+        auto lwsRange = sycl::range<3>(1, wg_rows, wg_cols);
+
+        using KernelName =
+            class gemm_batch_tiled_krn<lhsTy, rhsTy, resTy, BatchIndexerT,
+                                       wi_m, wi_n>;
+        cgh.parallel_for<KernelName>(
+            sycl::nd_range<3>(gwsRange, lwsRange),
+            GemmBatchTiledFunctor<lhsTy, rhsTy, resTy, LocAccT, BatchIndexerT,
+                                  wi_m, wi_n>(
+                lhs_tp, rhs_tp, res_tp, local_lhs_block, local_rhs_block, n,
+                k, m, k_tile, batch_indexer, lhs_row_stride, lhs_inner_stride,
+                rhs_inner_stride, rhs_col_stride, res_row_stride,
+                res_col_stride));
+    });
+
+    return gemm_ev;
+}
+
+/*! @brief Output type of linear algebra functions for pair of input types */
+template <typename T1, typename T2> struct DotProductOutputType
+{
+    using value_type = typename std::disjunction< // disjunction is C++17
+                                                  // feature, supported by DPC++
+        td_ns::BinaryTypeMapResultEntry<T1, bool, T2, bool, bool>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        std::uint8_t,
+                                        T2,
+                                        std::uint8_t,
+                                        std::uint8_t>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        std::int8_t,
+                                        T2,
+                                        std::int8_t,
+                                        std::int8_t>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        std::uint16_t,
+                                        T2,
+                                        std::uint16_t,
+                                        std::uint16_t>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        std::int16_t,
+                                        T2,
+                                        std::int16_t,
+                                        std::int16_t>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        std::uint32_t,
+                                        T2,
+                                        std::uint32_t,
+                                        std::uint32_t>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        std::int32_t,
+                                        T2,
+                                        std::int32_t,
+                                        std::int32_t>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        std::uint64_t,
+                                        T2,
+                                        std::uint64_t,
+                                        std::uint64_t>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        std::int64_t,
+                                        T2,
+                                        std::int64_t,
+                                        std::int64_t>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        sycl::half,
+                                        T2,
+                                        sycl::half,
+                                        sycl::half>,
+        td_ns::BinaryTypeMapResultEntry<T1, float, T2, float, float>,
+        td_ns::BinaryTypeMapResultEntry<T1, double, T2, double, double>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        std::complex<float>,
+                                        T2,
+                                        std::complex<float>,
+                                        std::complex<float>>,
+        td_ns::BinaryTypeMapResultEntry<T1,
+                                        std::complex<double>,
+                                        T2,
+                                        std::complex<double>,
+                                        std::complex<double>>,
+        td_ns::DefaultResultEntry<void>>::result_type;
+};
+
+template <typename fnT, typename T1, typename T2>
+struct DotProductTypeMapFactory
+{
+    /*! @brief get typeid for output type of dot(T1 x, T2 y) */
+    std::enable_if_t<std::is_same<fnT, int>::value, int> get()
+    {
+        using rT = typename DotProductOutputType<T1, T2>::value_type;
+        return td_ns::GetTypeid<rT>{}.get();
+    }
+};
+
+template <typename fnT, typename T1, typename T2> struct GemmBatchFactory
+{
+    fnT get()
+    {
+        using resT = typename DotProductOutputType<T1, T2>::value_type;
+        if constexpr (std::is_same_v<resT, void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = gemm_batch_impl<T1, T2, resT>;
+            return fn;
+        }
+    }
+};
+
+} // namespace linalg
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
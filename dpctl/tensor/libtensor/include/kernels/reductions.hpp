@@ -24,6 +24,7 @@
 
 #pragma once
 #include <CL/sycl.hpp>
+#include <algorithm>
 #include <complex>
 #include <cstddef>
 #include <cstdint>
@@ -31,7 +32,9 @@
 #include <vector>
 
 #include "pybind11/pybind11.h"
+#include "utils/launch_params.hpp"
 #include "utils/offset_utils.hpp"
+#include "utils/scratch_allocator.hpp"
 #include "utils/sycl_utils.hpp"
 #include "utils/type_dispatch.hpp"
 #include "utils/type_utils.hpp"
@@ -256,7 +259,12 @@ sycl::event sum_reduction_over_group_with_atomics_strided_impl(
 
     const sycl::device &d = exec_q.get_device();
     const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
-    size_t wg = choose_workgroup_size<4>(reduction_nelems, sg_sizes);
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const lp_ns::launch_params_t lp = lp_ns::get_launch_params(
+        exec_q, lp_ns::kernel_family::reduction_strided, sizeof(resTy));
+    size_t wg = choose_workgroup_size(reduction_nelems, sg_sizes,
+                                      lp_ns::sub_group_multiple(sg_sizes, lp));
+    const size_t preferrered_reductions_per_wi = lp.items_per_wi;
 
     if (reduction_nelems < wg) {
         sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
@@ -318,7 +326,6 @@ sycl::event sum_reduction_over_group_with_atomics_strided_impl(
             ReductionIndexerT reduction_indexer{red_nd, reduction_arg_offset,
                                                 reduction_shape_stride};
 
-            constexpr size_t preferrered_reductions_per_wi = 4;
             size_t reductions_per_wi =
                 (reduction_nelems < preferrered_reductions_per_wi * wg)
                     ? std::max<size_t>(1, (reduction_nelems + wg - 1) / wg)
@@ -377,10 +384,12 @@ typedef sycl::event (*sum_reduction_contig_impl_fn_ptr)(
     py::ssize_t,
     const std::vector<sycl::event> &);
 
-/* @brief Reduce rows in a matrix */
+/* @brief Reduce rows in a matrix, with launch parameters `lp` given
+   explicitly, e.g. by the tuner, rather than looked up */
 template <typename argTy, typename resTy>
-sycl::event sum_reduction_over_group_with_atomics_contig_impl(
+sycl::event sum_reduction_over_group_with_atomics_contig_with_params(
     sycl::queue exec_q,
+    const dpctl::tensor::launch_params::launch_params_t &lp,
     size_t iter_nelems, // number of reductions    (num. of rows in a matrix
                         // when reducing over rows)
     size_t reduction_nelems, // size of each reduction  (length of rows, i.e.
@@ -401,7 +410,10 @@ sycl::event sum_reduction_over_group_with_atomics_contig_impl(
 
     const sycl::device &d = exec_q.get_device();
     const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
-    size_t wg = choose_workgroup_size<2>(reduction_nelems, sg_sizes);
+    namespace lp_ns = dpctl::tensor::launch_params;
+    size_t wg = choose_workgroup_size(reduction_nelems, sg_sizes,
+                                      lp_ns::sub_group_multiple(sg_sizes, lp));
+    const size_t preferrered_reductions_per_wi = lp.items_per_wi;
 
     if (reduction_nelems < wg) {
         sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
@@ -455,7 +467,6 @@ sycl::event sum_reduction_over_group_with_atomics_contig_impl(
                                                         result_indexer};
             ReductionIndexerT reduction_indexer{};
 
-            constexpr size_t preferrered_reductions_per_wi = 8;
             size_t reductions_per_wi =
                 (reduction_nelems < preferrered_reductions_per_wi * wg)
                     ? std::max<size_t>(1, (reduction_nelems + wg - 1) / wg)
@@ -501,6 +512,30 @@ sycl::event sum_reduction_over_group_with_atomics_contig_impl(
     }
 }
 
+/* @brief Reduce rows in a matrix */
+template <typename argTy, typename resTy>
+sycl::event sum_reduction_over_group_with_atomics_contig_impl(
+    sycl::queue exec_q,
+    size_t iter_nelems, // number of reductions    (num. of rows in a matrix
+                        // when reducing over rows)
+    size_t reduction_nelems, // size of each reduction  (length of rows, i.e.
+                             // number of columns)
+    const char *arg_cp,
+    char *res_cp,
+    py::ssize_t iter_arg_offset,
+    py::ssize_t iter_res_offset,
+    py::ssize_t reduction_arg_offset,
+    const std::vector<sycl::event> &depends)
+{
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const lp_ns::launch_params_t lp = lp_ns::get_launch_params(
+        exec_q, lp_ns::kernel_family::reduction_contig, sizeof(resTy));
+    return sum_reduction_over_group_with_atomics_contig_with_params<argTy,
+                                                                    resTy>(
+        exec_q, lp, iter_nelems, reduction_nelems, arg_cp, res_cp,
+        iter_arg_offset, iter_res_offset, reduction_arg_offset, depends);
+}
+
 /* = Reduction, using sycl::reduce_over_group, but not using atomic_ref = */
 
 template <typename argT,
@@ -589,9 +624,12 @@ public:
 template <typename T1, typename T2, typename T3, typename T4, typename T5>
 class sum_reduction_over_group_temps_krn;
 
+/* @brief Reduce using temporaries, with launch parameters `lp` given
+   explicitly, e.g. by the tuner, rather than looked up */
 template <typename argTy, typename resTy>
-sycl::event sum_reduction_over_group_temps_strided_impl(
+sycl::event sum_reduction_over_group_temps_strided_with_params(
     sycl::queue exec_q,
+    const dpctl::tensor::launch_params::launch_params_t &lp,
     size_t iter_nelems, // number of reductions    (num. of rows in a matrix
                         // when reducing over rows)
     size_t reduction_nelems, // size of each reduction  (length of rows, i.e.
@@ -615,9 +653,11 @@ sycl::event sum_reduction_over_group_temps_strided_impl(
 
     const sycl::device &d = exec_q.get_device();
     const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
-    size_t wg = choose_workgroup_size<4>(reduction_nelems, sg_sizes);
+    namespace lp_ns = dpctl::tensor::launch_params;
+    size_t wg = choose_workgroup_size(reduction_nelems, sg_sizes,
+                                      lp_ns::sub_group_multiple(sg_sizes, lp));
 
-    constexpr size_t preferrered_reductions_per_wi = 4;
+    const size_t preferrered_reductions_per_wi = lp.items_per_wi;
     size_t max_wg = d.get_info<sycl::info::device::max_work_group_size>();
 
     size_t reductions_per_wi(preferrered_reductions_per_wi);
@@ -676,18 +716,13 @@ sycl::event sum_reduction_over_group_temps_strided_impl(
             (reduction_groups + preferrered_reductions_per_wi * wg - 1) /
             (preferrered_reductions_per_wi * wg);
 
-        resTy *partially_reduced_tmp = sycl::malloc_device<resTy>(
-            iter_nelems * (reduction_groups + second_iter_reduction_groups_),
-            exec_q);
-        resTy *partially_reduced_tmp2 = nullptr;
-
-        if (partially_reduced_tmp == nullptr) {
-            throw std::runtime_error("Unabled to allocate device_memory");
-        }
-        else {
-            partially_reduced_tmp2 =
-                partially_reduced_tmp + reduction_groups * iter_nelems;
-        }
+        using dpctl::tensor::alloc_utils::scratch_allocation;
+        scratch_allocation<resTy> tmp_alloc(
+            exec_q,
+            iter_nelems * (reduction_groups + second_iter_reduction_groups_));
+        resTy *partially_reduced_tmp = tmp_alloc.get();
+        resTy *partially_reduced_tmp2 =
+            partially_reduced_tmp + reduction_groups * iter_nelems;
 
         sycl::event first_reduction_ev = exec_q.submit([&](sycl::handler &cgh) {
             cgh.depends_on(depends);
@@ -841,14 +876,7 @@ sycl::event sum_reduction_over_group_temps_strided_impl(
         });
 
         sycl::event cleanup_host_task_event =
-            exec_q.submit([&](sycl::handler &cgh) {
-                cgh.depends_on(final_reduction_ev);
-                sycl::context ctx = exec_q.get_context();
-
-                cgh.host_task([ctx, partially_reduced_tmp] {
-                    sycl::free(partially_reduced_tmp, ctx);
-                });
-            });
+            tmp_alloc.release_after(exec_q, final_reduction_ev);
 
         // FIXME: do not return host-task event
         //   Instead collect all host-tasks to a list
@@ -857,6 +885,715 @@ sycl::event sum_reduction_over_group_temps_strided_impl(
     }
 }
 
+template <typename argTy, typename resTy>
+sycl::event sum_reduction_over_group_temps_strided_impl(
+    sycl::queue exec_q,
+    size_t iter_nelems, // number of reductions    (num. of rows in a matrix
+                        // when reducing over rows)
+    size_t reduction_nelems, // size of each reduction  (length of rows, i.e.
+                             // number of columns)
+    const char *arg_cp,
+    char *res_cp,
+    int iter_nd,
+    const py::ssize_t *iter_shape_and_strides,
+    py::ssize_t iter_arg_offset,
+    py::ssize_t iter_res_offset,
+    int red_nd,
+    const py::ssize_t *reduction_shape_stride,
+    py::ssize_t reduction_arg_offset,
+    const std::vector<sycl::event> &depends)
+{
+    namespace lp_ns = dpctl::tensor::launch_params;
+    const lp_ns::launch_params_t lp = lp_ns::get_launch_params(
+        exec_q, lp_ns::kernel_family::reduction_strided, sizeof(resTy));
+    return sum_reduction_over_group_temps_strided_with_params<argTy, resTy>(
+        exec_q, lp, iter_nelems, reduction_nelems, arg_cp, res_cp, iter_nd,
+        iter_shape_and_strides, iter_arg_offset, iter_res_offset, red_nd,
+        reduction_shape_stride, reduction_arg_offset, depends);
+}
+
+/* = Deterministic compensated summation, using local memory tree = */
+
+/*
+  Every addition is performed by the error-free transformation `two_sum`,
+  yielding the rounded sum and its exact rounding error. Each work-item
+  accumulates its elements into a (sum, error) pair, pairs of work-items are
+  combined by a pairwise tree in local memory, and pairs of work-groups are
+  written to temporaries as separate planes of sums and errors, which are
+  combined in the same way by subsequent passes. Errors are only folded into
+  the sum when the final result is written.
+
+  This is the Sum2 algorithm of Ogita, Rump and Oishi, applied in the order of
+  the reduction tree. For `n` summands x_i and unit roundoff `eps`, the error
+  of the result is bounded by
+
+      eps * |sum x_i| + gamma(n)^2 * sum |x_i|,  gamma(n) = n*eps/(1 - n*eps),
+
+  i.e. the result is as accurate as if it were computed in twice the working
+  precision and then rounded.
+
+  Elements of the batch of a work-group are split into contiguous blocks of
+  its sub-groups, and lane `l` of a sub-group of size `sgSize` processes
+  elements `l + k * sgSize` of its block. This is the layout of sub-group
+  block loads, used when the reduced elements are contiguous. No atomics are
+  used, and the order of operations only depends on the work-group size,
+  the sub-group size and the number of elements per work-item, so for a
+  fixed device and memory layout the result is reproducible bit for bit.
+*/
+
+/*! @brief Error-free transformation of the sum of `a` and `b`, such that
+    `a + b == s + err` exactly, unless the sum overflows. */
+template <typename T> inline void two_sum(const T &a, const T &b, T &s, T &err)
+{
+    s = a + b;
+    const T b_virtual = s - a;
+    err = (a - (s - b_virtual)) + (b - b_virtual);
+}
+
+template <typename argT,
+          typename outT,
+          typename InputOutputIterIndexerT,
+          typename InputRedIndexerT,
+          unsigned int vec_sz = 4>
+struct CompensatedSumOverGroupFunctor
+{
+private:
+    using LocAccT = sycl::local_accessor<outT, 1>;
+
+    // sub-group block loads require contiguous reduced elements, and types
+    // supported by sycl::vec
+    static constexpr bool use_sg_loads =
+        std::is_same_v<InputRedIndexerT,
+                       dpctl::tensor::offset_utils::NoOpIndexer> &&
+        !dpctl::tensor::type_utils::is_complex<argT>::value &&
+        !std::is_same_v<argT, bool>;
+
+    const argT *inp_ = nullptr;
+    const outT *inp_err_ = nullptr;
+    outT *out_ = nullptr;
+    outT *out_err_ = nullptr;
+    InputOutputIterIndexerT inp_out_iter_indexer_;
+    InputRedIndexerT inp_reduced_dims_indexer_;
+    LocAccT local_sum_;
+    LocAccT local_err_;
+    size_t reduction_max_gid_ = 0;
+    size_t reductions_per_wi = 16;
+
+    static void accumulate(outT &sum, outT &err, const outT &val)
+    {
+        outT s, e;
+        two_sum(sum, val, s, e);
+        sum = s;
+        err += e;
+    }
+
+public:
+    /*! @brief If `inp_err` is not null, the input holds sums with errors
+        given by `inp_err`. If `out_err` is not null, errors of the results
+        are written to it, otherwise they are added to the results. */
+    CompensatedSumOverGroupFunctor(const argT *data,
+                                   const outT *inp_err,
+                                   outT *res,
+                                   outT *out_err,
+                                   InputOutputIterIndexerT arg_res_iter_indexer,
+                                   InputRedIndexerT arg_reduced_dims_indexer,
+                                   LocAccT local_sum,
+                                   LocAccT local_err,
+                                   size_t reduction_size,
+                                   size_t reduction_size_per_wi)
+        : inp_(data), inp_err_(inp_err), out_(res), out_err_(out_err),
+          inp_out_iter_indexer_(arg_res_iter_indexer),
+          inp_reduced_dims_indexer_(arg_reduced_dims_indexer),
+          local_sum_(local_sum), local_err_(local_err),
+          reduction_max_gid_(reduction_size),
+          reductions_per_wi(reduction_size_per_wi)
+    {
+    }
+
+    void operator()(sycl::nd_item<2> it) const
+    {
+        const size_t iter_gid = it.get_global_id(0);
+        const size_t reduction_batch_id = it.get_group(1);
+        const size_t reduction_lid = it.get_local_id(1);
+        const size_t wg = it.get_local_range(1);
+
+        auto inp_out_iter_offsets_ = inp_out_iter_indexer_(iter_gid);
+        const auto &inp_iter_offset = inp_out_iter_offsets_.get_first_offset();
+        const auto &out_iter_offset = inp_out_iter_offsets_.get_second_offset();
+
+        auto sg = it.get_sub_group();
+        const size_t sgSize = sg.get_local_range()[0];
+        const size_t maxsgSize = sg.get_max_local_range()[0];
+        const size_t lane = sg.get_local_id()[0];
+
+        // only the last sub-group of a work-group may be smaller than others
+        const size_t block_start =
+            (reduction_batch_id * wg + sg.get_group_id()[0] * maxsgSize) *
+            reductions_per_wi;
+
+        outT sum(0);
+        outT err(0);
+
+        size_t m = 0;
+        if constexpr (use_sg_loads) {
+            if (sgSize == maxsgSize) {
+                using in_ptrT =
+                    sycl::multi_ptr<const argT,
+                                    sycl::access::address_space::global_space>;
+                using err_ptrT =
+                    sycl::multi_ptr<const outT,
+                                    sycl::access::address_space::global_space>;
+                using dpctl::tensor::type_utils::convert_impl;
+
+                for (; (m + vec_sz <= reductions_per_wi) &&
+                       (block_start + (m + vec_sz) * sgSize <=
+                        reduction_max_gid_);
+                     m += vec_sz)
+                {
+                    const size_t offset =
+                        inp_iter_offset + block_start + m * sgSize;
+                    const sycl::vec<argT, vec_sz> arg_vec =
+                        sg.load<vec_sz>(in_ptrT(&inp_[offset]));
+#pragma unroll
+                    for (unsigned int k = 0; k < vec_sz; ++k) {
+                        accumulate(sum, err,
+                                   convert_impl<outT, argT>(arg_vec[k]));
+                    }
+                    if (inp_err_ != nullptr) {
+                        const sycl::vec<outT, vec_sz> err_vec =
+                            sg.load<vec_sz>(err_ptrT(&inp_err_[offset]));
+#pragma unroll
+                        for (unsigned int k = 0; k < vec_sz; ++k) {
+                            err += err_vec[k];
+                        }
+                    }
+                }
+            }
+        }
+        for (; m < reductions_per_wi; ++m) {
+            const size_t arg_reduce_gid = block_start + m * sgSize + lane;
+
+            if (arg_reduce_gid < reduction_max_gid_) {
+                auto inp_reduction_offset =
+                    inp_reduced_dims_indexer_(arg_reduce_gid);
+                auto inp_offset = inp_iter_offset + inp_reduction_offset;
+
+                using dpctl::tensor::type_utils::convert_impl;
+                accumulate(sum, err,
+                           convert_impl<outT, argT>(inp_[inp_offset]));
+                if (inp_err_ != nullptr) {
+                    err += inp_err_[inp_offset];
+                }
+            }
+        }
+
+        // pairwise tree over (sum, error) pairs of work-items
+        local_sum_[reduction_lid] = sum;
+        local_err_[reduction_lid] = err;
+        auto work_group = it.get_group();
+        for (size_t n_active = wg; n_active > 1;) {
+            const size_t half = (n_active + 1) / 2;
+            sycl::group_barrier(work_group);
+            if (reduction_lid + half < n_active) {
+                outT s, e;
+                two_sum(local_sum_[reduction_lid],
+                        local_sum_[reduction_lid + half], s, e);
+                local_sum_[reduction_lid] = s;
+                local_err_[reduction_lid] +=
+                    local_err_[reduction_lid + half] + e;
+            }
+            n_active = half;
+        }
+        sycl::group_barrier(work_group);
+
+        if (work_group.leader()) {
+            const size_t out_id =
+                out_iter_offset * it.get_group_range(1) + reduction_batch_id;
+            if (out_err_ != nullptr) {
+                out_[out_id] = local_sum_[0];
+                out_err_[out_id] = local_err_[0];
+            }
+            else {
+                out_[out_id] = local_sum_[0] + local_err_[0];
+            }
+        }
+    }
+};
+
+template <typename T1, typename T2, typename T3, typename T4>
+class sum_reduction_compensated_krn;
+
+template <typename T1, typename T2, typename T3>
+class sum_reduction_compensated_empty_krn;
+
+template <typename argTy,
+          typename resTy,
+          typename InputOutputIterIndexerT,
+          typename ReductionIndexerT>
+sycl::event
+submit_compensated_sum_over_group(sycl::queue &exec_q,
+                                  const argTy *arg_tp,
+                                  const resTy *arg_err_tp,
+                                  resTy *res_tp,
+                                  resTy *res_err_tp,
+                                  size_t iter_nelems,
+                                  size_t reduction_nelems,
+                                  size_t reduction_groups,
+                                  size_t wg,
+                                  size_t reductions_per_wi,
+                                  InputOutputIterIndexerT in_out_iter_indexer,
+                                  ReductionIndexerT reduction_indexer,
+                                  const std::vector<sycl::event> &depends)
+{
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        auto globalRange = sycl::range<2>{iter_nelems, reduction_groups * wg};
+        auto localRange = sycl::range<2>{1, wg};
+
+        using LocAccT = sycl::local_accessor<resTy, 1>;
+        LocAccT local_sum(wg, cgh);
+        LocAccT local_err(wg, cgh);
+
+        using KernelName =
+            class sum_reduction_compensated_krn<argTy, resTy,
+                                                InputOutputIterIndexerT,
+                                                ReductionIndexerT>;
+        cgh.parallel_for<KernelName>(
+            sycl::nd_range<2>(globalRange, localRange),
+            CompensatedSumOverGroupFunctor<argTy, resTy,
+                                           InputOutputIterIndexerT,
+                                           ReductionIndexerT>(
+                arg_tp, arg_err_tp, res_tp, res_err_tp, in_out_iter_indexer,
+                reduction_indexer, local_sum, local_err, reduction_nelems,
+                reductions_per_wi));
+    });
+    return comp_ev;
+}
+
+/* @brief Compensated sum of `iter_nelems` reductions of `reduction_nelems`
+   elements each, with offsets of reductions in the input and in the result
+   given by `inp_iter_indexer` and `res_iter_indexer`, and offsets of reduced
+   elements given by `reduction_indexer`.
+
+   Launch parameters are not taken from the autotuned registry, since they
+   determine the order of summation, and hence the result.
+ */
+template <typename argTy,
+          typename resTy,
+          typename InputIterIndexerT,
+          typename ResIterIndexerT,
+          typename ReductionIndexerT>
+sycl::event
+compensated_sum_reduction_impl(sycl::queue &exec_q,
+                               const argTy *arg_tp,
+                               resTy *res_tp,
+                               size_t iter_nelems,
+                               size_t reduction_nelems,
+                               const InputIterIndexerT &inp_iter_indexer,
+                               const ResIterIndexerT &res_iter_indexer,
+                               const ReductionIndexerT &reduction_indexer,
+                               const std::vector<sycl::event> &depends)
+{
+    if (reduction_nelems == 0) {
+        // sums over empty axis are equal to the identity
+        sycl::event res_init_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+
+            using KernelName =
+                class sum_reduction_compensated_empty_krn<argTy, resTy,
+                                                          ResIterIndexerT>;
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(iter_nelems), [=](sycl::id<1> id) {
+                    res_tp[res_iter_indexer(id[0])] = resTy(0);
+                });
+        });
+
+        return res_init_ev;
+    }
+
+    const sycl::device &d = exec_q.get_device();
+    const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
+    const size_t wg = choose_workgroup_size<4>(reduction_nelems, sg_sizes);
+    constexpr size_t reductions_per_wi = 16;
+
+    using NoOpIndexerT = dpctl::tensor::offset_utils::NoOpIndexer;
+    using Strided1DIndexerT = dpctl::tensor::offset_utils::Strided1DIndexer;
+
+    size_t reduction_groups = (reduction_nelems + reductions_per_wi * wg - 1) /
+                              (reductions_per_wi * wg);
+
+    if (reduction_groups == 1) {
+        using InputOutputIterIndexerT =
+            dpctl::tensor::offset_utils::TwoOffsets_CombinedIndexer<
+                InputIterIndexerT, ResIterIndexerT>;
+        InputOutputIterIndexerT in_out_iter_indexer{inp_iter_indexer,
+                                                    res_iter_indexer};
+
+        return submit_compensated_sum_over_group<argTy, resTy>(
+            exec_q, arg_tp, nullptr, res_tp, nullptr, iter_nelems,
+            reduction_nelems, reduction_groups, wg, reductions_per_wi,
+            in_out_iter_indexer, reduction_indexer, depends);
+    }
+
+    // partial sums of work-groups and their errors are stored as pairs of
+    // (iter_nelems, groups) C-contiguous matrices, and reduced by
+    // subsequent passes
+    size_t second_iter_reduction_groups_ =
+        (reduction_groups + reductions_per_wi * wg - 1) /
+        (reductions_per_wi * wg);
+
+    const size_t tmp_nelems = iter_nelems * reduction_groups;
+    const size_t tmp2_nelems = iter_nelems * second_iter_reduction_groups_;
+
+    using dpctl::tensor::alloc_utils::scratch_allocation;
+    scratch_allocation<resTy> tmp_alloc(exec_q,
+                                        2 * (tmp_nelems + tmp2_nelems));
+    resTy *partially_reduced_tmp = tmp_alloc.get();
+    resTy *partially_reduced_tmp_err = partially_reduced_tmp + tmp_nelems;
+    resTy *partially_reduced_tmp2 = partially_reduced_tmp_err + tmp_nelems;
+    resTy *partially_reduced_tmp2_err = partially_reduced_tmp2 + tmp2_nelems;
+
+    sycl::event dependent_ev;
+    {
+        using InputOutputIterIndexerT =
+            dpctl::tensor::offset_utils::TwoOffsets_CombinedIndexer<
+                InputIterIndexerT, NoOpIndexerT>;
+        InputOutputIterIndexerT in_out_iter_indexer{inp_iter_indexer,
+                                                    NoOpIndexerT{}};
+
+        dependent_ev = submit_compensated_sum_over_group<argTy, resTy>(
+            exec_q, arg_tp, nullptr, partially_reduced_tmp,
+            partially_reduced_tmp_err, iter_nelems, reduction_nelems,
+            reduction_groups, wg, reductions_per_wi, in_out_iter_indexer,
+            reduction_indexer, depends);
+    }
+
+    size_t remaining_reduction_nelems = reduction_groups;
+    resTy *temp_arg = partially_reduced_tmp;
+    resTy *temp_arg_err = partially_reduced_tmp_err;
+    resTy *temp2_arg = partially_reduced_tmp2;
+    resTy *temp2_arg_err = partially_reduced_tmp2_err;
+
+    using TempsIterIndexerT =
+        dpctl::tensor::offset_utils::TwoOffsets_CombinedIndexer<
+            Strided1DIndexerT, NoOpIndexerT>;
+    while (remaining_reduction_nelems > reductions_per_wi * wg) {
+        size_t reduction_groups_ =
+            (remaining_reduction_nelems + reductions_per_wi * wg - 1) /
+            (reductions_per_wi * wg);
+
+        TempsIterIndexerT in_out_iter_indexer{
+            Strided1DIndexerT{
+                0, static_cast<py::ssize_t>(iter_nelems),
+                static_cast<py::ssize_t>(remaining_reduction_nelems)},
+            NoOpIndexerT{}};
+
+        dependent_ev = submit_compensated_sum_over_group<resTy, resTy>(
+            exec_q, temp_arg, temp_arg_err, temp2_arg, temp2_arg_err,
+            iter_nelems, remaining_reduction_nelems, reduction_groups_, wg,
+            reductions_per_wi, in_out_iter_indexer, NoOpIndexerT{},
+            {dependent_ev});
+
+        remaining_reduction_nelems = reduction_groups_;
+        std::swap(temp_arg, temp2_arg);
+        std::swap(temp_arg_err, temp2_arg_err);
+    }
+
+    // final reduction to res, errors are added to sums
+    using FinalIterIndexerT =
+        dpctl::tensor::offset_utils::TwoOffsets_CombinedIndexer<
+            Strided1DIndexerT, ResIterIndexerT>;
+    FinalIterIndexerT final_in_out_iter_indexer{
+        Strided1DIndexerT{0, static_cast<py::ssize_t>(iter_nelems),
+                          static_cast<py::ssize_t>(remaining_reduction_nelems)},
+        res_iter_indexer};
+
+    sycl::event final_reduction_ev =
+        submit_compensated_sum_over_group<resTy, resTy>(
+            exec_q, temp_arg, temp_arg_err, res_tp, nullptr, iter_nelems,
+            remaining_reduction_nelems, 1, wg, reductions_per_wi,
+            final_in_out_iter_indexer, NoOpIndexerT{}, {dependent_ev});
+
+    sycl::event cleanup_host_task_event =
+        tmp_alloc.release_after(exec_q, final_reduction_ev);
+
+    return cleanup_host_task_event;
+}
+
+/* @brief Deterministic sum with compensated accumulation. */
+template <typename argTy, typename resTy>
+sycl::event sum_reduction_compensated_strided_impl(
+    sycl::queue exec_q,
+    size_t iter_nelems,
+    size_t reduction_nelems,
+    const char *arg_cp,
+    char *res_cp,
+    int iter_nd,
+    const py::ssize_t *iter_shape_and_strides,
+    py::ssize_t iter_arg_offset,
+    py::ssize_t iter_res_offset,
+    int red_nd,
+    const py::ssize_t *reduction_shape_stride,
+    py::ssize_t reduction_arg_offset,
+    const std::vector<sycl::event> &depends)
+{
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_cp);
+    resTy *res_tp = reinterpret_cast<resTy *>(res_cp);
+
+    using StridedIndexerT = dpctl::tensor::offset_utils::StridedIndexer;
+    using ResIndexerT = dpctl::tensor::offset_utils::UnpackedStridedIndexer;
+
+    // only shape and source strides of iterated dimensions are accessed
+    const StridedIndexerT inp_iter_indexer{iter_nd, iter_arg_offset,
+                                           iter_shape_and_strides};
+    const ResIndexerT res_iter_indexer{iter_nd, iter_res_offset,
+                                       /* shape */ iter_shape_and_strides,
+                                       /* strides */ iter_shape_and_strides +
+                                           2 * iter_nd};
+    const StridedIndexerT reduction_indexer{red_nd, reduction_arg_offset,
+                                            reduction_shape_stride};
+
+    return compensated_sum_reduction_impl<argTy, resTy>(
+        exec_q, arg_tp, res_tp, iter_nelems, reduction_nelems,
+        inp_iter_indexer, res_iter_indexer, reduction_indexer, depends);
+}
+
+/* @brief Deterministic sum with compensated accumulation of rows of a
+   C-contiguous matrix, or of a contiguous vector. Reduced elements are
+   read with sub-group block loads. */
+template <typename argTy, typename resTy>
+sycl::event sum_reduction_compensated_contig_impl(
+    sycl::queue exec_q,
+    size_t iter_nelems,
+    size_t reduction_nelems,
+    const char *arg_cp,
+    char *res_cp,
+    py::ssize_t iter_arg_offset,
+    py::ssize_t iter_res_offset,
+    py::ssize_t reduction_arg_offset,
+    const std::vector<sycl::event> &depends)
+{
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_cp) +
+                          iter_arg_offset + reduction_arg_offset;
+    resTy *res_tp = reinterpret_cast<resTy *>(res_cp) + iter_res_offset;
+
+    using NoOpIndexerT = dpctl::tensor::offset_utils::NoOpIndexer;
+    using Strided1DIndexerT = dpctl::tensor::offset_utils::Strided1DIndexer;
+
+    const Strided1DIndexerT inp_iter_indexer{
+        0, static_cast<py::ssize_t>(iter_nelems),
+        static_cast<py::ssize_t>(reduction_nelems)};
+
+    return compensated_sum_reduction_impl<argTy, resTy>(
+        exec_q, arg_tp, res_tp, iter_nelems, reduction_nelems,
+        inp_iter_indexer, NoOpIndexerT{}, NoOpIndexerT{}, depends);
+}
+
+/* = Reduction over a strided axis, with contiguous iteration dimension = */
+
+/*
+  Each work-item reduces `reductions_per_wi` consecutive elements of the
+  reduced axis for a single iteration index. Neighboring work-items of a
+  work-group process neighboring iteration indexes, which are contiguous in
+  memory, so that loads are coalesced for any stride of the reduced axis.
+
+  Work-items in the first dimension of nd-range process different chunks of
+  the reduced axis, and write partial results to consecutive rows of the
+  (chunks, iter_nelems) C-contiguous output.
+*/
+template <typename argT, typename outT, typename ReductionOp>
+struct ReductionAlongStridedAxisFunctor
+{
+private:
+    const argT *inp_ = nullptr;
+    outT *out_ = nullptr;
+    ReductionOp reduction_op_;
+    outT identity_;
+    size_t iter_nelems_ = 0;
+    size_t reduction_nelems_ = 0;
+    py::ssize_t reduction_stride_ = 0;
+    size_t reductions_per_wi_ = 0;
+
+public:
+    ReductionAlongStridedAxisFunctor(const argT *data,
+                                     outT *res,
+                                     ReductionOp reduction_op,
+                                     const outT &identity_val,
+                                     size_t iter_nelems,
+                                     size_t reduction_size,
+                                     py::ssize_t reduction_stride,
+                                     size_t reduction_size_per_wi)
+        : inp_(data), out_(res), reduction_op_(reduction_op),
+          identity_(identity_val), iter_nelems_(iter_nelems),
+          reduction_nelems_(reduction_size),
+          reduction_stride_(reduction_stride),
+          reductions_per_wi_(reduction_size_per_wi)
+    {
+    }
+
+    void operator()(sycl::nd_item<2> it) const
+    {
+        const size_t iter_gid = it.get_global_id(1);
+        if (iter_gid >= iter_nelems_) {
+            return;
+        }
+
+        const size_t chunk_id = it.get_global_id(0);
+        const size_t red_start = chunk_id * reductions_per_wi_;
+        const size_t red_end =
+            std::min(reduction_nelems_, red_start + reductions_per_wi_);
+
+        py::ssize_t inp_offset = static_cast<py::ssize_t>(iter_gid) +
+                                 static_cast<py::ssize_t>(red_start) *
+                                     reduction_stride_;
+        outT red_val(identity_);
+        for (size_t m = red_start; m < red_end; ++m) {
+            red_val = reduction_op_(red_val, inp_[inp_offset]);
+            inp_offset += reduction_stride_;
+        }
+
+        out_[chunk_id * iter_nelems_ + iter_gid] = red_val;
+    }
+};
+
+typedef sycl::event (*sum_reduction_over_strided_axis_impl_fn_ptr)(
+    sycl::queue,
+    size_t,
+    size_t,
+    const char *,
+    char *,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    py::ssize_t,
+    const std::vector<sycl::event> &);
+
+template <typename T1, typename T2, typename T3>
+class sum_reduction_over_strided_axis_krn;
+
+/* @brief Reduce columns of a matrix, i.e. reduce over an axis with arbitrary
+ * stride, when iteration indexes are contiguous in both the input and the
+ * result */
+template <typename argTy, typename resTy>
+sycl::event sum_reduction_over_strided_axis_impl(
+    sycl::queue exec_q,
+    size_t iter_nelems,      // number of reductions (num. of columns in a
+                             // matrix when reducing over columns)
+    size_t reduction_nelems, // size of each reduction (length of columns,
+                             // i.e. number of rows)
+    const char *arg_cp,
+    char *res_cp,
+    py::ssize_t iter_arg_offset,
+    py::ssize_t iter_res_offset,
+    py::ssize_t reduction_arg_offset,
+    py::ssize_t reduction_arg_stride,
+    const std::vector<sycl::event> &depends)
+{
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_cp) +
+                          iter_arg_offset + reduction_arg_offset;
+    resTy *res_tp = reinterpret_cast<resTy *>(res_cp) + iter_res_offset;
+
+    using ReductionOpT = sycl::plus<resTy>;
+    constexpr resTy identity_val = resTy{0};
+
+    if (reduction_nelems == 0) {
+        // sums over empty axis are equal to the identity
+        sycl::event res_init_ev = exec_q.fill<resTy>(
+            res_tp, resTy(identity_val), iter_nelems, depends);
+
+        return res_init_ev;
+    }
+
+    const sycl::device &d = exec_q.get_device();
+    const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
+    const size_t wg = choose_workgroup_size<4>(iter_nelems, sg_sizes);
+    const size_t iter_groups = (iter_nelems + wg - 1) / wg;
+
+    // split the reduced axis into chunks when work-items along iteration
+    // dimension alone are too few to occupy the device
+    constexpr size_t preferred_work_items_per_cu = 256;
+    constexpr size_t min_reductions_per_wi = 16;
+    const size_t target_work_items =
+        d.get_info<sycl::info::device::max_compute_units>() *
+        preferred_work_items_per_cu;
+    const size_t max_chunks = std::max<size_t>(
+        1, (reduction_nelems + min_reductions_per_wi - 1) /
+               min_reductions_per_wi);
+    size_t n_chunks = std::clamp<size_t>(
+        (target_work_items + iter_groups * wg - 1) / (iter_groups * wg), 1,
+        max_chunks);
+    const size_t reductions_per_wi =
+        (reduction_nelems + n_chunks - 1) / n_chunks;
+    n_chunks = (reduction_nelems + reductions_per_wi - 1) / reductions_per_wi;
+
+    if (n_chunks == 1) {
+        sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+
+            auto globalRange = sycl::range<2>{1, iter_groups * wg};
+            auto localRange = sycl::range<2>{1, wg};
+
+            using KernelName =
+                class sum_reduction_over_strided_axis_krn<argTy, resTy,
+                                                          ReductionOpT>;
+            cgh.parallel_for<KernelName>(
+                sycl::nd_range<2>(globalRange, localRange),
+                ReductionAlongStridedAxisFunctor<argTy, resTy, ReductionOpT>(
+                    arg_tp, res_tp, ReductionOpT(), identity_val, iter_nelems,
+                    reduction_nelems, reduction_arg_stride, reduction_nelems));
+        });
+
+        return comp_ev;
+    }
+    else {
+        // partial results of chunks, as (n_chunks, iter_nelems) C-contiguous
+        // matrix, reduced over columns by the second kernel
+        using dpctl::tensor::alloc_utils::scratch_allocation;
+        scratch_allocation<resTy> tmp_alloc(exec_q, n_chunks * iter_nelems);
+        resTy *partially_reduced_tmp = tmp_alloc.get();
+
+        sycl::event first_reduction_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+
+            auto globalRange = sycl::range<2>{n_chunks, iter_groups * wg};
+            auto localRange = sycl::range<2>{1, wg};
+
+            using KernelName =
+                class sum_reduction_over_strided_axis_krn<argTy, resTy,
+                                                          ReductionOpT>;
+            cgh.parallel_for<KernelName>(
+                sycl::nd_range<2>(globalRange, localRange),
+                ReductionAlongStridedAxisFunctor<argTy, resTy, ReductionOpT>(
+                    arg_tp, partially_reduced_tmp, ReductionOpT(),
+                    identity_val, iter_nelems, reduction_nelems,
+                    reduction_arg_stride, reductions_per_wi));
+        });
+
+        sycl::event final_reduction_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(first_reduction_ev);
+
+            auto globalRange = sycl::range<2>{1, iter_groups * wg};
+            auto localRange = sycl::range<2>{1, wg};
+
+            using KernelName =
+                class sum_reduction_over_strided_axis_krn<resTy, resTy,
+                                                          ReductionOpT>;
+            cgh.parallel_for<KernelName>(
+                sycl::nd_range<2>(globalRange, localRange),
+                ReductionAlongStridedAxisFunctor<resTy, resTy, ReductionOpT>(
+                    partially_reduced_tmp, res_tp, ReductionOpT(),
+                    identity_val, iter_nelems, n_chunks,
+                    static_cast<py::ssize_t>(iter_nelems), n_chunks));
+        });
+
+        sycl::event cleanup_host_task_event =
+            tmp_alloc.release_after(exec_q, final_reduction_ev);
+
+        return cleanup_host_task_event;
+    }
+}
+
 /* @brief Types supported by plus-reduction code based on atomic_ref */
 template <typename argTy, typename outTy>
 struct TypePairSupportDataForSumReductionAtomic
@@ -1023,6 +1760,86 @@ struct TypePairSupportDataForSumReductionTemps
         td_ns::NotDefinedEntry>::is_defined;
 };
 
+template <typename argTy, typename outTy>
+struct TypePairSupportDataForCompensatedSumReduction
+{
+
+    // compensation only matters for inexact result types, sums with integral
+    // result types are exact and thus already reproducible
+    static constexpr bool is_defined = std::disjunction<
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, double>,
+
+        // input int8_t
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, double>,
+
+        // input uint8_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, double>,
+
+        // input int16_t
+        td_ns::TypePairDefinedEntry<argTy, std::int16_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int16_t, outTy, double>,
+
+        // input uint16_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, double>,
+
+        // input int32_t
+        td_ns::TypePairDefinedEntry<argTy, std::int32_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int32_t, outTy, double>,
+
+        // input uint32_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint32_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint32_t, outTy, double>,
+
+        // input int64_t
+        td_ns::TypePairDefinedEntry<argTy, std::int64_t, outTy, double>,
+
+        // input uint64_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint64_t, outTy, double>,
+
+        // input half
+        td_ns::TypePairDefinedEntry<argTy, sycl::half, outTy, sycl::half>,
+        td_ns::TypePairDefinedEntry<argTy, sycl::half, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, sycl::half, outTy, double>,
+        td_ns::
+            TypePairDefinedEntry<argTy, sycl::half, outTy, std::complex<float>>,
+        td_ns::TypePairDefinedEntry<argTy,
+                                    sycl::half,
+                                    outTy,
+                                    std::complex<double>>,
+
+        // input float
+        td_ns::TypePairDefinedEntry<argTy, float, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, float, outTy, double>,
+        td_ns::TypePairDefinedEntry<argTy, float, outTy, std::complex<float>>,
+        td_ns::TypePairDefinedEntry<argTy, float, outTy, std::complex<double>>,
+
+        // input double
+        td_ns::TypePairDefinedEntry<argTy, double, outTy, double>,
+        td_ns::TypePairDefinedEntry<argTy, double, outTy, std::complex<double>>,
+
+        // input std::complex
+        td_ns::TypePairDefinedEntry<argTy,
+                                    std::complex<float>,
+                                    outTy,
+                                    std::complex<float>>,
+        td_ns::TypePairDefinedEntry<argTy,
+                                    std::complex<float>,
+                                    outTy,
+                                    std::complex<double>>,
+
+        td_ns::TypePairDefinedEntry<argTy,
+                                    std::complex<double>,
+                                    outTy,
+                                    std::complex<double>>,
+
+        // fall-through
+        td_ns::NotDefinedEntry>::is_defined;
+};
+
 template <typename fnT, typename srcTy, typename dstTy>
 struct SumOverAxisAtomicStridedFactory
 {
@@ -1057,6 +1874,25 @@ struct SumOverAxisTempsStridedFactory
     }
 };
 
+template <typename fnT, typename srcTy, typename dstTy>
+struct SumOverStridedAxisFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportDataForSumReductionAtomic<
+                          srcTy, dstTy>::is_defined ||
+                      TypePairSupportDataForSumReductionTemps<
+                          srcTy, dstTy>::is_defined)
+        {
+            return dpctl::tensor::kernels::
+                sum_reduction_over_strided_axis_impl<srcTy, dstTy>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
 template <typename fnT, typename srcTy, typename dstTy>
 struct SumOverAxisAtomicContigFactory
 {
@@ -1074,6 +1910,40 @@ struct SumOverAxisAtomicContigFactory
     }
 };
 
+template <typename fnT, typename srcTy, typename dstTy>
+struct SumOverAxisCompensatedFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportDataForCompensatedSumReduction<
+                          srcTy, dstTy>::is_defined)
+        {
+            return dpctl::tensor::kernels::
+                sum_reduction_compensated_strided_impl<srcTy, dstTy>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct SumOverAxisCompensatedContigFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportDataForCompensatedSumReduction<
+                          srcTy, dstTy>::is_defined)
+        {
+            return dpctl::tensor::kernels::
+                sum_reduction_compensated_contig_impl<srcTy, dstTy>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
 } // namespace kernels
 } // namespace tensor
 } // namespace dpctl
@@ -0,0 +1,602 @@
+//=== launch_params.hpp - Tuned kernel launch parameters   ------- *-C++-*/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines the registry of kernel launch parameters (work-group
+/// sizes and amount of work per work-item) keyed by device, kernel family and
+/// size of data type. Entries are either defaults, or found by autotuning and
+/// persisted in a cache file.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace launch_params
+{
+
+/*! @brief Families of kernels sharing launch parameters */
+enum class kernel_family : int
+{
+    unary_contig = 0,
+    binary_contig = 1,
+    reduction_contig = 2,
+    reduction_strided = 3
+};
+
+inline const char *kernel_family_name(kernel_family f)
+{
+    switch (f) {
+    case kernel_family::unary_contig:
+        return "unary_contig";
+    case kernel_family::binary_contig:
+        return "binary_contig";
+    case kernel_family::reduction_contig:
+        return "reduction_contig";
+    case kernel_family::reduction_strided:
+        return "reduction_strided";
+    }
+    return "unknown";
+}
+
+/*! @brief Launch parameters of a kernel.
+
+    For elementwise kernels `wg_size` is the work-group size, and
+    `items_per_wi` is not used, since the number of elements processed by a
+    work-item is fixed at compile time by `vec_sz` and `n_vecs`.
+
+    For reductions `wg_size` is the largest work-group size used when
+    the reduction does not fit into a single work-group, and `items_per_wi`
+    is the preferred number of elements reduced by each work-item.
+ */
+struct launch_params_t
+{
+    size_t wg_size;
+    size_t items_per_wi;
+};
+
+inline size_t max_sub_group_size(const sycl::device &d)
+{
+    const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
+    return (sg_sizes.empty())
+               ? size_t(1)
+               : *std::max_element(std::begin(sg_sizes), std::end(sg_sizes));
+}
+
+/*! @brief Number of multiples of the largest sub-group size making up the
+    work-group size bound of reduction parameters `p` */
+inline size_t sub_group_multiple(const std::vector<size_t> &sg_sizes,
+                                 const launch_params_t &p)
+{
+    const size_t max_sg =
+        (sg_sizes.empty())
+            ? size_t(1)
+            : *std::max_element(std::begin(sg_sizes), std::end(sg_sizes));
+    return std::max<size_t>(1, p.wg_size / max_sg);
+}
+
+/*! @brief Parameters used in absence of tuned values */
+inline launch_params_t default_launch_params(const sycl::device &d,
+                                             kernel_family f)
+{
+    switch (f) {
+    case kernel_family::reduction_contig:
+        return launch_params_t{2 * max_sub_group_size(d), 8};
+    case kernel_family::reduction_strided:
+        return launch_params_t{4 * max_sub_group_size(d), 4};
+    default:
+        return launch_params_t{64, 1};
+    }
+}
+
+/*! @brief String identifying device model and driver, used as cache key */
+inline std::string device_key(const sycl::device &d)
+{
+    std::ostringstream os;
+    os << d.get_info<sycl::info::device::name>() << "|"
+       << d.get_info<sycl::info::device::vendor>() << "|"
+       << d.get_info<sycl::info::device::driver_version>() << "|"
+       << static_cast<int>(d.get_backend());
+    std::string key = os.str();
+    // keys are stored in tab-separated cache file
+    std::replace(std::begin(key), std::end(key), '\t', ' ');
+    std::replace(std::begin(key), std::end(key), '\n', ' ');
+    return key;
+}
+
+/*! @brief Location of the cache file.
+
+    Given by environment variable DPCTL_TENSOR_LAUNCH_PARAMS_CACHE, with
+    the default of $XDG_CACHE_HOME/dpctl/tensor_launch_params.txt, or
+    $HOME/.cache/dpctl/tensor_launch_params.txt if XDG_CACHE_HOME is not set.
+ */
+inline std::string cache_file_path()
+{
+    if (const char *p = std::getenv("DPCTL_TENSOR_LAUNCH_PARAMS_CACHE")) {
+        return std::string(p);
+    }
+    std::filesystem::path dir;
+    if (const char *xdg = std::getenv("XDG_CACHE_HOME")) {
+        dir = std::filesystem::path(xdg);
+    }
+    else if (const char *home = std::getenv("HOME")) {
+        dir = std::filesystem::path(home) / ".cache";
+    }
+    else if (const char *local_app = std::getenv("LOCALAPPDATA")) {
+        dir = std::filesystem::path(local_app);
+    }
+    else {
+        return std::string{};
+    }
+    return (dir / "dpctl" / "tensor_launch_params.txt").string();
+}
+
+/*! @brief Returns true if launch parameters are to be tuned on first use of
+    a device, requested by setting DPCTL_TENSOR_AUTOTUNE=1 */
+inline bool autotune_on_first_use()
+{
+    const char *v = std::getenv("DPCTL_TENSOR_AUTOTUNE");
+    return (v != nullptr) && (std::string(v) == "1");
+}
+
+/*! @brief Work-group sizes of elementwise kernels are multiples of this
+    value, unless the device does not support work-groups as large, in which
+    case they are powers of two, so that they are multiples of the vector
+    size of kernels. */
+static constexpr size_t elementwise_lws_granularity = 32;
+
+/*! @brief Number of kernel families */
+static constexpr int n_kernel_families = 4;
+
+/*! @brief Number of sizes of data types with resolved launch parameters */
+static constexpr int n_type_sizes = 5;
+
+/*! @brief Position of data type size `type_size` in tables of resolved
+    launch parameters, or `n_type_sizes` for sizes not stored there */
+inline int type_size_index(size_t type_size)
+{
+    switch (type_size) {
+    case 1:
+        return 0;
+    case 2:
+        return 1;
+    case 4:
+        return 2;
+    case 8:
+        return 3;
+    case 16:
+        return 4;
+    default:
+        return n_type_sizes;
+    }
+}
+
+/*! @brief Packs launch parameters into a single word, so that they can be
+    updated atomically */
+inline std::uint64_t pack_launch_params(const launch_params_t &p)
+{
+    return (static_cast<std::uint64_t>(p.wg_size) << 32) |
+           static_cast<std::uint64_t>(p.items_per_wi & 0xffffffffu);
+}
+
+inline launch_params_t unpack_launch_params(std::uint64_t v)
+{
+    return launch_params_t{static_cast<size_t>(v >> 32),
+                           static_cast<size_t>(v & 0xffffffffu)};
+}
+
+/*! @brief Launch parameters of all kernel families and sizes of data types
+    resolved for a device, with work-group sizes clamped by the maximal
+    work-group size of the device, since a cached value may have been
+    found on a device with a larger limit. Entries are packed by
+    `pack_launch_params` and updated in place when parameters of the device
+    change.
+ */
+struct device_launch_params_t
+{
+    explicit device_launch_params_t(const sycl::device &d) : device(d) {}
+
+    sycl::device device;
+    std::atomic<std::uint64_t> params[n_kernel_families][n_type_sizes];
+};
+
+/*! @brief Process-wide registry of launch parameters.
+
+    The registry is populated from the cache file when first used. Values
+    absent from the registry are replaced with defaults. A tuner function
+    can be registered to be called for devices seen for the first time,
+    if autotuning on first use is enabled.
+
+    Parameters are resolved once per device into a table, which is
+    published in a fixed-size array of atomic pointers, so that look-ups
+    done on every kernel submission neither lock nor query the device. Each
+    device has a single table, whose entries are updated in place when
+    parameters of the device change.
+ */
+class LaunchParamsRegistry
+{
+public:
+    using key_t = std::tuple<std::string, int, size_t>;
+    using tuner_fn_t = std::function<void(sycl::queue &)>;
+
+    static LaunchParamsRegistry &get()
+    {
+        static LaunchParamsRegistry registry;
+        return registry;
+    }
+
+    LaunchParamsRegistry(const LaunchParamsRegistry &) = delete;
+    LaunchParamsRegistry &operator=(const LaunchParamsRegistry &) = delete;
+
+    /*! @brief Launch parameters for kernel family `f` operating on data
+        type of size `type_size` bytes on the device of queue `q`. */
+    launch_params_t
+    lookup(const sycl::queue &q, kernel_family f, size_t type_size)
+    {
+        const sycl::device &d = q.get_device();
+        const int ts_id = type_size_index(type_size);
+
+        const device_launch_params_t *table = find_table(d);
+        if (table == nullptr) {
+            table = resolve(q, d);
+        }
+        if (ts_id < n_type_sizes) {
+            return unpack_launch_params(
+                table->params[static_cast<int>(f)][ts_id].load(
+                    std::memory_order_relaxed));
+        }
+
+        // sizes of data types not stored in tables, not used by dpctl.tensor
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = params_.find(
+            key_t{cached_device_key(d), static_cast<int>(f), type_size});
+        return clamped(d, f,
+                       (it != params_.end()) ? it->second
+                                             : default_launch_params(d, f));
+    }
+
+    void set(const sycl::device &d,
+             kernel_family f,
+             size_t type_size,
+             const launch_params_t &p)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        load_if_needed();
+        const std::string &dev_key = cached_device_key(d);
+        params_[key_t{dev_key, static_cast<int>(f), type_size}] = p;
+        // explicitly set parameters must not be replaced by the tuner
+        visited_devices_.insert(dev_key);
+        publish(d);
+    }
+
+    /*! @brief Removes entries for the device, so defaults are used. */
+    void reset(const sycl::device &d)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        load_if_needed();
+        const std::string &dev_key = cached_device_key(d);
+        for (auto it = params_.begin(); it != params_.end();) {
+            if (std::get<0>(it->first) == dev_key) {
+                it = params_.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        publish(d);
+    }
+
+    /*! @brief Entries of the device as (family, type size, params) tuples */
+    std::vector<std::tuple<kernel_family, size_t, launch_params_t>>
+    entries(const sycl::device &d)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        load_if_needed();
+        const std::string &dev_key = cached_device_key(d);
+        std::vector<std::tuple<kernel_family, size_t, launch_params_t>> res;
+        for (const auto &kv : params_) {
+            if (std::get<0>(kv.first) == dev_key) {
+                res.emplace_back(static_cast<kernel_family>(
+                                     std::get<1>(kv.first)),
+                                 std::get<2>(kv.first), kv.second);
+            }
+        }
+        return res;
+    }
+
+    void set_tuner(tuner_fn_t fn)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        tuner_ = std::move(fn);
+    }
+
+    /*! @brief Writes all entries to the cache file, returns false if the
+        file could not be written. */
+    bool save()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        load_if_needed();
+        const std::string fname = cache_file_path();
+        if (fname.empty()) {
+            return false;
+        }
+        std::error_code ec;
+        const std::filesystem::path parent =
+            std::filesystem::path(fname).parent_path();
+        if (!parent.empty()) {
+            std::filesystem::create_directories(parent, ec);
+        }
+        std::ofstream ofs(fname, std::ios::trunc);
+        if (!ofs) {
+            return false;
+        }
+        ofs << "# dpctl.tensor kernel launch parameters" << std::endl;
+        ofs << "# device\tfamily\ttype_size\twg_size\titems_per_wi"
+            << std::endl;
+        for (const auto &kv : params_) {
+            ofs << std::get<0>(kv.first) << "\t" << std::get<1>(kv.first)
+                << "\t" << std::get<2>(kv.first) << "\t" << kv.second.wg_size
+                << "\t" << kv.second.items_per_wi << std::endl;
+        }
+        return static_cast<bool>(ofs);
+    }
+
+private:
+    // Number of devices with tables published for lock-free look-up,
+    // look-ups for further devices lock the mutex
+    static constexpr size_t max_published_devices = 64;
+
+    LaunchParamsRegistry()
+    {
+        for (auto &slot : published_) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    const device_launch_params_t *find_table(const sycl::device &d) const
+    {
+        for (const auto &slot : published_) {
+            const device_launch_params_t *t =
+                slot.load(std::memory_order_acquire);
+            if (t == nullptr) {
+                break;
+            }
+            if (t->device == d) {
+                return t;
+            }
+        }
+        return nullptr;
+    }
+
+    /*! @brief Publishes the table of the device on first look-up, and runs
+        the tuner if requested before returning it, so that the first kernel
+        submitted to the device waits for tuning to complete. Kernels
+        submitted from other threads meanwhile use defaults or cached
+        values. */
+    const device_launch_params_t *resolve(const sycl::queue &q,
+                                          const sycl::device &d)
+    {
+        tuner_fn_t tuner_fn;
+        const device_launch_params_t *table = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            load_if_needed();
+            table = find_table(d);
+            if (table == nullptr) {
+                table = publish(d);
+            }
+            const std::string &dev_key = cached_device_key(d);
+            if (tuner_ && autotune_on_first_use() &&
+                visited_devices_.count(dev_key) == 0)
+            {
+                tuner_fn = tuner_;
+            }
+            visited_devices_.insert(dev_key);
+        }
+
+        if (tuner_fn) {
+            // the tuner synchronizes with its own queue, so that work
+            // submitted to the queue of the caller is not waited upon
+            try {
+                sycl::queue tuning_q(q.get_context(), d);
+                tuner_fn(tuning_q);
+            } catch (const std::exception &) {
+                // defaults remain in use
+            }
+        }
+
+        return table;
+    }
+
+    // must be called with the mutex held
+    launch_params_t
+    clamped(const sycl::device &d, kernel_family f, launch_params_t p)
+    {
+        auto it = max_wg_sizes_.find(d);
+        if (it == max_wg_sizes_.end()) {
+            it = max_wg_sizes_
+                     .emplace(d, d.get_info<
+                                     sycl::info::device::max_work_group_size>())
+                     .first;
+        }
+        p.wg_size = std::max<size_t>(1, std::min(p.wg_size, it->second));
+        p.items_per_wi = std::max<size_t>(1, p.items_per_wi);
+
+        // elementwise kernels need multiples of their vector size, and
+        // reductions multiples of the sub-group size
+        const size_t granularity = (f == kernel_family::unary_contig ||
+                                    f == kernel_family::binary_contig)
+                                       ? elementwise_lws_granularity
+                                       : max_sub_group_size(d);
+        if (p.wg_size >= granularity) {
+            p.wg_size -= p.wg_size % granularity;
+        }
+        else {
+            size_t pow2 = 1;
+            while (2 * pow2 <= p.wg_size) {
+                pow2 *= 2;
+            }
+            p.wg_size = pow2;
+        }
+        return p;
+    }
+
+    // must be called with the mutex held, stores recorded entries into the
+    // table of the device, publishing it on first use of the device
+    const device_launch_params_t *publish(const sycl::device &d)
+    {
+        device_launch_params_t *table = nullptr;
+        for (const auto &owned : owned_tables_) {
+            if (owned->device == d) {
+                table = owned.get();
+                break;
+            }
+        }
+        const bool is_new = (table == nullptr);
+        if (is_new) {
+            owned_tables_.push_back(
+                std::make_unique<device_launch_params_t>(d));
+            table = owned_tables_.back().get();
+        }
+
+        const std::string &dev_key = cached_device_key(d);
+        constexpr size_t type_sizes[n_type_sizes] = {1, 2, 4, 8, 16};
+        for (int f = 0; f < n_kernel_families; ++f) {
+            for (int ts_id = 0; ts_id < n_type_sizes; ++ts_id) {
+                auto it = params_.find(key_t{dev_key, f, type_sizes[ts_id]});
+                const kernel_family family = static_cast<kernel_family>(f);
+                const launch_params_t p = clamped(
+                    d, family,
+                    (it != params_.end()) ? it->second
+                                          : default_launch_params(d, family));
+                table->params[f][ts_id].store(pack_launch_params(p),
+                                              std::memory_order_relaxed);
+            }
+        }
+
+        if (is_new) {
+            for (auto &slot : published_) {
+                if (slot.load(std::memory_order_relaxed) == nullptr) {
+                    slot.store(table, std::memory_order_release);
+                    break;
+                }
+            }
+        }
+        return table;
+    }
+
+    // must be called with the mutex held, avoids repeated queries of
+    // device descriptors on every kernel submission
+    const std::string &cached_device_key(const sycl::device &d)
+    {
+        auto it = device_keys_.find(d);
+        if (it == device_keys_.end()) {
+            it = device_keys_.emplace(d, device_key(d)).first;
+        }
+        return it->second;
+    }
+
+    // must be called with the mutex held
+    void load_if_needed()
+    {
+        if (loaded_) {
+            return;
+        }
+        loaded_ = true;
+
+        const std::string fname = cache_file_path();
+        if (fname.empty()) {
+            return;
+        }
+        std::ifstream ifs(fname);
+        std::string line;
+        while (std::getline(ifs, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream ls(line);
+            std::string dev_key;
+            int f;
+            size_t type_size;
+            launch_params_t p;
+            if (std::getline(ls, dev_key, '\t') &&
+                (ls >> f >> type_size >> p.wg_size >> p.items_per_wi) &&
+                p.wg_size > 0 && p.items_per_wi > 0)
+            {
+                // entries set in this process take precedence
+                params_.emplace(key_t{dev_key, f, type_size}, p);
+            }
+        }
+    }
+
+    std::mutex mu_;
+    bool loaded_ = false;
+    std::map<key_t, launch_params_t> params_;
+    std::set<std::string> visited_devices_;
+    std::unordered_map<sycl::device, std::string> device_keys_;
+    std::unordered_map<sycl::device, size_t> max_wg_sizes_;
+    std::vector<std::unique_ptr<device_launch_params_t>> owned_tables_;
+    std::array<std::atomic<const device_launch_params_t *>,
+               max_published_devices>
+        published_;
+    tuner_fn_t tuner_;
+};
+
+/*! @brief Launch parameters for kernel family `f` operating on data type of
+    size `type_size` on the device of queue `q` */
+inline launch_params_t
+get_launch_params(const sycl::queue &q, kernel_family f, size_t type_size)
+{
+    return LaunchParamsRegistry::get().lookup(q, f, type_size);
+}
+
+/*! @brief Work-group size for elementwise kernels, clamped by the maximal
+    work-group size of the device, and a multiple of
+    `elementwise_lws_granularity` if the device allows it. */
+inline size_t
+elementwise_lws(const sycl::queue &q, kernel_family f, size_t type_size)
+{
+    return get_launch_params(q, f, type_size).wg_size;
+}
+
+} // namespace launch_params
+} // namespace tensor
+} // namespace dpctl
@@ -28,8 +28,12 @@
 
 #include <CL/sycl.hpp>
 #include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
 #include <pybind11/pybind11.h>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "utils/strided_iters.hpp"
@@ -125,6 +129,139 @@ device_allocate_and_pack(sycl::queue q,
     return std::make_tuple(shape_strides, sz, copy_ev);
 }
 
+/*! @brief Computes `multiplier` and `shift` such that for non-negative `n`
+    below 2^63 the quotient `n / divisor` equals
+    `mul_hi(n, multiplier) >> shift`, see T. Granlund, P. L. Montgomery,
+    "Division by invariant integers using multiplication". Zero multiplier
+    is used for divisor equal to one. */
+inline void compute_fast_divisor(py::ssize_t divisor,
+                                 std::uint64_t &multiplier,
+                                 int &shift)
+{
+    const std::uint64_t d = static_cast<std::uint64_t>(divisor);
+    if (d <= 1) {
+        multiplier = 0;
+        shift = 0;
+        return;
+    }
+    // l = ceil(log2(d)), so that 2^(l-1) < d <= 2^l
+    int l = 0;
+    while ((std::uint64_t(1) << l) < d) {
+        ++l;
+    }
+    // multiplier = floor(2^(63 + l) / d) + 1, which is below 2^64,
+    // computed by long division to avoid 128-bit arithmetic
+    std::uint64_t q = 0;
+    std::uint64_t r = 1;
+    for (int i = 0; i < 63 + l; ++i) {
+        r <<= 1;
+        q <<= 1;
+        if (r >= d) {
+            r -= d;
+            q |= 1;
+        }
+    }
+    multiplier = q + 1;
+    shift = l - 1;
+}
+
+/*! @brief Returns multipliers followed by shifts for fast division by
+    elements of `shape`, which fixed-rank and fast-division indexers
+    expect to be packed after shape and strides:
+
+    \code{.cpp}
+    device_allocate_and_pack<py::ssize_t>(
+        q, host_task_events, shape, src_strides, dst_strides,
+        fast_divisors(shape));
+    \endcode
+ */
+template <typename ShapeT>
+std::vector<py::ssize_t> fast_divisors(const ShapeT &shape)
+{
+    const size_t nd = shape.size();
+    std::vector<py::ssize_t> packed(2 * nd);
+    for (size_t i = 0; i < nd; ++i) {
+        std::uint64_t multiplier = 0;
+        int shift = 0;
+        compute_fast_divisor(shape[i], multiplier, shift);
+        packed[i] = static_cast<py::ssize_t>(multiplier);
+        packed[nd + i] = static_cast<py::ssize_t>(shift);
+    }
+    return packed;
+}
+
+/*! @brief Quotient of non-negative `n` by the divisor represented by
+    `multiplier` and `shift` computed by `compute_fast_divisor` */
+inline py::ssize_t
+fast_divide(py::ssize_t n, py::ssize_t multiplier, py::ssize_t shift)
+{
+    if (multiplier == 0) {
+        return n;
+    }
+    const std::uint64_t hi =
+        sycl::mul_hi(static_cast<std::uint64_t>(n),
+                     static_cast<std::uint64_t>(multiplier));
+    return static_cast<py::ssize_t>(hi >> shift);
+}
+
+/*! @brief Quotient of non-negative `n` by the divisor represented by
+    `multiplier` and `shift` computed by `compute_fast_divisor`, using
+    32-bit arithmetic. The divisor must not exceed the maximal value of
+    std::int32_t. */
+inline std::int32_t
+fast_divide(std::int32_t n, py::ssize_t multiplier, py::ssize_t shift)
+{
+    if (multiplier == 0) {
+        return n;
+    }
+    // floor(2^(31 + l) / d) + 1, the multiplier for 31-bit dividends, is
+    // obtained from floor(2^(63 + l) / d) + 1 by dropping 32 low bits
+    const std::uint32_t multiplier32 =
+        static_cast<std::uint32_t>(
+            (static_cast<std::uint64_t>(multiplier) - 1) >> 32) +
+        1;
+    const std::uint32_t hi =
+        sycl::mul_hi(static_cast<std::uint32_t>(n), multiplier32);
+    return static_cast<std::int32_t>(hi >> shift);
+}
+
+/*! @brief Returns true if flat indices of `nelems` elements, and offsets of
+    elements of arrays of the given `shape` with strides and starting offsets
+    given by `strides_and_offsets`, fit in std::int32_t. */
+template <typename ShapeT>
+bool offsets_fit_int32(
+    size_t nelems,
+    const ShapeT &shape,
+    std::initializer_list<std::pair<const ShapeT *, py::ssize_t>>
+        strides_and_offsets)
+{
+    constexpr py::ssize_t max_v = std::numeric_limits<std::int32_t>::max();
+    constexpr py::ssize_t min_v = std::numeric_limits<std::int32_t>::min();
+
+    if (nelems > static_cast<size_t>(max_v)) {
+        return false;
+    }
+    const size_t nd = shape.size();
+    for (const auto &strides_and_offset : strides_and_offsets) {
+        const ShapeT &strides = *strides_and_offset.first;
+        py::ssize_t min_offset = strides_and_offset.second;
+        py::ssize_t max_offset = strides_and_offset.second;
+        for (size_t i = 0; i < nd; ++i) {
+            const py::ssize_t span = (shape[i] - 1) * strides[i];
+            if (span < 0) {
+                min_offset += span;
+            }
+            else {
+                max_offset += span;
+            }
+        }
+        if (min_offset < min_v || max_offset > max_v) {
+            return false;
+        }
+    }
+    return true;
+}
+
 struct NoOpIndexer
 {
     size_t operator()(size_t gid) const
@@ -326,6 +463,111 @@ private:
     }
 };
 
+/* @brief Indexer of two arrays of rank `nd` known at compile time, with
+   shape and strides packed as for TwoOffsets_StridedIndexer, followed by
+   `fast_divisors(shape)`. Index arithmetic is performed in type `indT`,
+   std::int32_t may be used if `offsets_fit_int32` holds. */
+template <int nd, typename indT = py::ssize_t>
+struct TwoOffsets_FixedRankStridedIndexer
+{
+    static_assert(nd > 0, "Positive rank is required");
+
+    TwoOffsets_FixedRankStridedIndexer(py::ssize_t first_offset_,
+                                       py::ssize_t second_offset_,
+                                       py::ssize_t const *_packed_shape_strides)
+        : starting_first_offset(static_cast<indT>(first_offset_)),
+          starting_second_offset(static_cast<indT>(second_offset_)),
+          shape_strides(_packed_shape_strides)
+    {
+    }
+
+    TwoOffsets<py::ssize_t> operator()(py::ssize_t gid) const
+    {
+        return compute_offsets(static_cast<indT>(gid));
+    }
+
+    TwoOffsets<py::ssize_t> operator()(size_t gid) const
+    {
+        return compute_offsets(static_cast<indT>(gid));
+    }
+
+private:
+    indT starting_first_offset;
+    indT starting_second_offset;
+    py::ssize_t const *shape_strides;
+
+    TwoOffsets<py::ssize_t> compute_offsets(indT gid) const
+    {
+        indT i_ = gid;
+        // partial sums stay within the range of offsets of array elements
+        indT d1 = starting_first_offset, d2 = starting_second_offset;
+#pragma unroll
+        for (int dim = nd - 1; dim > 0; --dim) {
+            const indT si = static_cast<indT>(shape_strides[dim]);
+            const indT q = fast_divide(i_, shape_strides[3 * nd + dim],
+                                       shape_strides[4 * nd + dim]);
+            const indT r = (i_ - q * si);
+            i_ = q;
+            d1 += r * static_cast<indT>(shape_strides[nd + dim]);
+            d2 += r * static_cast<indT>(shape_strides[2 * nd + dim]);
+        }
+        d1 += i_ * static_cast<indT>(shape_strides[nd]);
+        d2 += i_ * static_cast<indT>(shape_strides[2 * nd]);
+        return TwoOffsets<py::ssize_t>(static_cast<py::ssize_t>(d1),
+                                       static_cast<py::ssize_t>(d2));
+    }
+};
+
+/* @brief Indexer of two arrays of rank `nd` with shape and strides packed
+   as for TwoOffsets_StridedIndexer, followed by `fast_divisors(shape)` */
+struct TwoOffsets_FastDivStridedIndexer
+{
+    TwoOffsets_FastDivStridedIndexer(int common_nd,
+                                     py::ssize_t first_offset_,
+                                     py::ssize_t second_offset_,
+                                     py::ssize_t const *_packed_shape_strides)
+        : nd(common_nd), starting_first_offset(first_offset_),
+          starting_second_offset(second_offset_),
+          shape_strides(_packed_shape_strides)
+    {
+    }
+
+    TwoOffsets<py::ssize_t> operator()(py::ssize_t gid) const
+    {
+        return compute_offsets(gid);
+    }
+
+    TwoOffsets<py::ssize_t> operator()(size_t gid) const
+    {
+        return compute_offsets(static_cast<py::ssize_t>(gid));
+    }
+
+private:
+    int nd;
+    py::ssize_t starting_first_offset;
+    py::ssize_t starting_second_offset;
+    py::ssize_t const *shape_strides;
+
+    TwoOffsets<py::ssize_t> compute_offsets(py::ssize_t gid) const
+    {
+        py::ssize_t i_ = gid;
+        py::ssize_t d1 = 0, d2 = 0;
+        for (int dim = nd - 1; dim > 0; --dim) {
+            const py::ssize_t si = shape_strides[dim];
+            const py::ssize_t q = fast_divide(i_, shape_strides[3 * nd + dim],
+                                              shape_strides[4 * nd + dim]);
+            const py::ssize_t r = (i_ - q * si);
+            i_ = q;
+            d1 += r * shape_strides[nd + dim];
+            d2 += r * shape_strides[2 * nd + dim];
+        }
+        d1 += i_ * shape_strides[nd];
+        d2 += i_ * shape_strides[2 * nd];
+        return TwoOffsets<py::ssize_t>(starting_first_offset + d1,
+                                       starting_second_offset + d2);
+    }
+};
+
 struct TwoZeroOffsets_Indexer
 {
     TwoZeroOffsets_Indexer() {}
@@ -441,6 +683,125 @@ private:
     }
 };
 
+/* @brief Indexer of three arrays of rank `nd` known at compile time, with
+   shape and strides packed as for ThreeOffsets_StridedIndexer, followed by
+   `fast_divisors(shape)`. Index arithmetic is performed in type `indT`,
+   std::int32_t may be used if `offsets_fit_int32` holds. */
+template <int nd, typename indT = py::ssize_t>
+struct ThreeOffsets_FixedRankStridedIndexer
+{
+    static_assert(nd > 0, "Positive rank is required");
+
+    ThreeOffsets_FixedRankStridedIndexer(
+        py::ssize_t first_offset_,
+        py::ssize_t second_offset_,
+        py::ssize_t third_offset_,
+        py::ssize_t const *_packed_shape_strides)
+        : starting_first_offset(static_cast<indT>(first_offset_)),
+          starting_second_offset(static_cast<indT>(second_offset_)),
+          starting_third_offset(static_cast<indT>(third_offset_)),
+          shape_strides(_packed_shape_strides)
+    {
+    }
+
+    ThreeOffsets<py::ssize_t> operator()(py::ssize_t gid) const
+    {
+        return compute_offsets(static_cast<indT>(gid));
+    }
+
+    ThreeOffsets<py::ssize_t> operator()(size_t gid) const
+    {
+        return compute_offsets(static_cast<indT>(gid));
+    }
+
+private:
+    indT starting_first_offset;
+    indT starting_second_offset;
+    indT starting_third_offset;
+    py::ssize_t const *shape_strides;
+
+    ThreeOffsets<py::ssize_t> compute_offsets(indT gid) const
+    {
+        indT i_ = gid;
+        // partial sums stay within the range of offsets of array elements
+        indT d1 = starting_first_offset, d2 = starting_second_offset,
+             d3 = starting_third_offset;
+#pragma unroll
+        for (int dim = nd - 1; dim > 0; --dim) {
+            const indT si = static_cast<indT>(shape_strides[dim]);
+            const indT q = fast_divide(i_, shape_strides[4 * nd + dim],
+                                       shape_strides[5 * nd + dim]);
+            const indT r = (i_ - q * si);
+            i_ = q;
+            d1 += r * static_cast<indT>(shape_strides[nd + dim]);
+            d2 += r * static_cast<indT>(shape_strides[2 * nd + dim]);
+            d3 += r * static_cast<indT>(shape_strides[3 * nd + dim]);
+        }
+        d1 += i_ * static_cast<indT>(shape_strides[nd]);
+        d2 += i_ * static_cast<indT>(shape_strides[2 * nd]);
+        d3 += i_ * static_cast<indT>(shape_strides[3 * nd]);
+        return ThreeOffsets<py::ssize_t>(static_cast<py::ssize_t>(d1),
+                                         static_cast<py::ssize_t>(d2),
+                                         static_cast<py::ssize_t>(d3));
+    }
+};
+
+/* @brief Indexer of three arrays of rank `nd` with shape and strides packed
+   as for ThreeOffsets_StridedIndexer, followed by `fast_divisors(shape)` */
+struct ThreeOffsets_FastDivStridedIndexer
+{
+    ThreeOffsets_FastDivStridedIndexer(int common_nd,
+                                       py::ssize_t first_offset_,
+                                       py::ssize_t second_offset_,
+                                       py::ssize_t third_offset_,
+                                       py::ssize_t const *_packed_shape_strides)
+        : nd(common_nd), starting_first_offset(first_offset_),
+          starting_second_offset(second_offset_),
+          starting_third_offset(third_offset_),
+          shape_strides(_packed_shape_strides)
+    {
+    }
+
+    ThreeOffsets<py::ssize_t> operator()(py::ssize_t gid) const
+    {
+        return compute_offsets(gid);
+    }
+
+    ThreeOffsets<py::ssize_t> operator()(size_t gid) const
+    {
+        return compute_offsets(static_cast<py::ssize_t>(gid));
+    }
+
+private:
+    int nd;
+    py::ssize_t starting_first_offset;
+    py::ssize_t starting_second_offset;
+    py::ssize_t starting_third_offset;
+    py::ssize_t const *shape_strides;
+
+    ThreeOffsets<py::ssize_t> compute_offsets(py::ssize_t gid) const
+    {
+        py::ssize_t i_ = gid;
+        py::ssize_t d1 = 0, d2 = 0, d3 = 0;
+        for (int dim = nd - 1; dim > 0; --dim) {
+            const py::ssize_t si = shape_strides[dim];
+            const py::ssize_t q = fast_divide(i_, shape_strides[4 * nd + dim],
+                                              shape_strides[5 * nd + dim]);
+            const py::ssize_t r = (i_ - q * si);
+            i_ = q;
+            d1 += r * shape_strides[nd + dim];
+            d2 += r * shape_strides[2 * nd + dim];
+            d3 += r * shape_strides[3 * nd + dim];
+        }
+        d1 += i_ * shape_strides[nd];
+        d2 += i_ * shape_strides[2 * nd];
+        d3 += i_ * shape_strides[3 * nd];
+        return ThreeOffsets<py::ssize_t>(starting_first_offset + d1,
+                                         starting_second_offset + d2,
+                                         starting_third_offset + d3);
+    }
+};
+
 struct ThreeZeroOffsets_Indexer
 {
     ThreeZeroOffsets_Indexer() {}
@@ -664,6 +1025,60 @@ private:
     py::ssize_t starting_offset2;
 };
 
+/*! @brief Calls `fn` with an indexer constructed from `args`, of type
+    `FixedRankIndexerT<nd, indT>` if the rank `nd` is between 1 and 4, so
+    that loops over dimensions are unrolled, and of type `IndexerT`,
+    constructed from `nd` and `args`, otherwise. Index type `indT` is
+    std::int32_t if `use_int32_indexing` is true, as computed by the caller
+    with `offsets_fit_int32`, and py::ssize_t otherwise.
+
+    \code{.cpp}
+    dispatch_fixed_rank_indexer<TwoOffsets_FixedRankStridedIndexer,
+                                TwoOffsets_FastDivStridedIndexer>(
+        nd, use_int32_indexing, [&](const auto &indexer) { ... }, offset1,
+        offset2, shape_strides);
+    \endcode
+ */
+template <template <int, typename> class FixedRankIndexerT,
+          typename IndexerT,
+          typename FnT,
+          typename... Args>
+auto dispatch_fixed_rank_indexer(int nd,
+                                 bool use_int32_indexing,
+                                 FnT &&fn,
+                                 const Args &...args)
+{
+    if (use_int32_indexing) {
+        using indT = std::int32_t;
+        switch (nd) {
+        case 1:
+            return fn(FixedRankIndexerT<1, indT>(args...));
+        case 2:
+            return fn(FixedRankIndexerT<2, indT>(args...));
+        case 3:
+            return fn(FixedRankIndexerT<3, indT>(args...));
+        case 4:
+            return fn(FixedRankIndexerT<4, indT>(args...));
+        default:
+            break;
+        }
+    }
+
+    using indT = py::ssize_t;
+    switch (nd) {
+    case 1:
+        return fn(FixedRankIndexerT<1, indT>(args...));
+    case 2:
+        return fn(FixedRankIndexerT<2, indT>(args...));
+    case 3:
+        return fn(FixedRankIndexerT<3, indT>(args...));
+    case 4:
+        return fn(FixedRankIndexerT<4, indT>(args...));
+    default:
+        return fn(IndexerT(nd, args...));
+    }
+}
+
 } // namespace offset_utils
 } // namespace tensor
 } // namespace dpctl
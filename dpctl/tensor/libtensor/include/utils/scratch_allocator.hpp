@@ -0,0 +1,325 @@
+//=== scratch_allocator.hpp - Arena for kernel temporaries ------- *-C++-*/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines a bump allocator of USM-device scratch memory used by
+/// kernel implementations for temporaries living for the duration of a
+/// single call, e.g. partial results of reductions. Memory is carved out of
+/// chunks retained per SYCL context and device, and is returned to the arena
+/// by a host task depending on the last kernel using it, so that repeated
+/// calls do not allocate memory from the driver. Idle chunks are freed once
+/// too much memory is retained, or on request by `trim`.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace alloc_utils
+{
+
+/*! @brief Block of USM-device memory from which scratch allocations are
+    carved out by bumping `offset`. The block is rewound once all `live`
+    allocations made from it have been released. */
+struct scratch_chunk
+{
+    char *ptr;
+    size_t capacity;
+    size_t offset;
+    size_t live;
+};
+
+/*! @brief Counts of chunks and allocations of an arena */
+struct scratch_arena_statistics
+{
+    size_t n_chunks;
+    size_t retained_nbytes;
+    size_t live_allocations;
+};
+
+/*! @brief Arena of scratch memory for a SYCL context and device */
+class ScratchArena
+{
+public:
+    // Capacity of chunks serving small requests
+    static constexpr size_t chunk_nbytes = size_t(4) << 20;
+    // Idle chunks are freed once retained memory exceeds this amount
+    static constexpr size_t max_retained_nbytes = size_t(256) << 20;
+    static constexpr size_t alignment = 256;
+
+    ScratchArena(const sycl::context &ctx, const sycl::device &dev)
+        : ctx_(ctx), dev_(dev)
+    {
+    }
+
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena &operator=(const ScratchArena &) = delete;
+
+    /*! @brief Returns `nbytes` of memory aligned to `alignment`, and
+        the chunk it was taken from, to be passed to `release`. */
+    std::pair<char *, scratch_chunk *> allocate(size_t nbytes)
+    {
+        nbytes = std::max<size_t>(round_up(nbytes), alignment);
+
+        std::lock_guard<std::mutex> lock(mu_);
+        if (current_ == nullptr ||
+            current_->offset + nbytes > current_->capacity)
+        {
+            current_ = find_idle_chunk(nbytes);
+            if (current_ == nullptr) {
+                current_ = new_chunk(std::max(nbytes, chunk_nbytes));
+            }
+        }
+        char *ptr = current_->ptr + current_->offset;
+        current_->offset += nbytes;
+        ++current_->live;
+        return {ptr, current_};
+    }
+
+    /*! @brief Returns allocation made from `chunk` to the arena. Must only
+        be called once kernels using the allocation have completed. */
+    void release(scratch_chunk *chunk)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (--chunk->live > 0) {
+            return;
+        }
+        chunk->offset = 0;
+        if (retained_ > max_retained_nbytes && chunk != current_) {
+            auto it = std::find_if(
+                std::begin(chunks_), std::end(chunks_),
+                [chunk](const auto &c) { return c.get() == chunk; });
+            retained_ -= chunk->capacity;
+            sycl::free(chunk->ptr, ctx_);
+            chunks_.erase(it);
+        }
+    }
+
+    /*! @brief Frees all idle chunks, returns the number of bytes freed. */
+    size_t trim()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        size_t freed = 0;
+        for (auto it = chunks_.begin(); it != chunks_.end();) {
+            scratch_chunk *chunk = it->get();
+            if (chunk->live == 0) {
+                if (chunk == current_) {
+                    current_ = nullptr;
+                }
+                freed += chunk->capacity;
+                sycl::free(chunk->ptr, ctx_);
+                it = chunks_.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        retained_ -= freed;
+        return freed;
+    }
+
+    scratch_arena_statistics statistics()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        scratch_arena_statistics stats{chunks_.size(), retained_, 0};
+        for (const auto &c : chunks_) {
+            stats.live_allocations += c->live;
+        }
+        return stats;
+    }
+
+private:
+    std::mutex mu_;
+    sycl::context ctx_;
+    sycl::device dev_;
+    std::vector<std::unique_ptr<scratch_chunk>> chunks_;
+    scratch_chunk *current_ = nullptr;
+    size_t retained_ = 0;
+
+    static size_t round_up(size_t nbytes)
+    {
+        return ((nbytes + alignment - 1) / alignment) * alignment;
+    }
+
+    // smallest idle chunk able to accommodate `nbytes`
+    scratch_chunk *find_idle_chunk(size_t nbytes)
+    {
+        scratch_chunk *best = nullptr;
+        for (const auto &c : chunks_) {
+            if (c->live == 0 && c->capacity >= nbytes &&
+                (best == nullptr || c->capacity < best->capacity))
+            {
+                best = c.get();
+            }
+        }
+        return best;
+    }
+
+    scratch_chunk *new_chunk(size_t capacity)
+    {
+        char *ptr = sycl::malloc_device<char>(capacity, dev_, ctx_);
+        if (ptr == nullptr) {
+            throw std::runtime_error("Unable to allocate device memory");
+        }
+        chunks_.push_back(std::make_unique<scratch_chunk>(
+            scratch_chunk{ptr, capacity, 0, 0}));
+        retained_ += capacity;
+        return chunks_.back().get();
+    }
+};
+
+/*! @brief Arenas of all contexts and devices used by queues of libtensor */
+class ScratchArenaRegistry
+{
+public:
+    static ScratchArenaRegistry &get()
+    {
+        // Intentionally leaked: arenas must outlive host tasks releasing
+        // memory into them, and USM memory can not be freed after the SYCL
+        // runtime has been unloaded at exit
+        static ScratchArenaRegistry *registry = new ScratchArenaRegistry();
+        return *registry;
+    }
+
+    ScratchArena &arena_for(const sycl::queue &q)
+    {
+        const sycl::context &ctx = q.get_context();
+        const sycl::device &dev = q.get_device();
+
+        std::lock_guard<std::mutex> lock(mu_);
+        auto &dev_arenas = arenas_[ctx];
+        auto it = dev_arenas.find(dev);
+        if (it == dev_arenas.end()) {
+            it = dev_arenas
+                     .emplace(dev, std::make_unique<ScratchArena>(ctx, dev))
+                     .first;
+        }
+        return *(it->second);
+    }
+
+    /*! @brief Frees idle chunks of all arenas, returns the number of bytes
+        freed. */
+    size_t trim()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        size_t freed = 0;
+        for (auto &ctx_arenas : arenas_) {
+            for (auto &dev_arena : ctx_arenas.second) {
+                freed += dev_arena.second->trim();
+            }
+        }
+        return freed;
+    }
+
+private:
+    std::mutex mu_;
+    std::unordered_map<
+        sycl::context,
+        std::unordered_map<sycl::device, std::unique_ptr<ScratchArena>>>
+        arenas_;
+
+    ScratchArenaRegistry() = default;
+};
+
+/*! @brief Scratch allocation of `n` elements of type T from the arena
+    of the queue.
+
+    The allocation is returned to the arena by a host task depending on all
+    kernels accessing it, submitted by `release_after`:
+
+    \code{.cpp}
+    scratch_allocation<T> tmp(exec_q, n);
+    ...
+    sycl::event cleanup_ev = tmp.release_after(exec_q, last_ev);
+    \endcode
+
+    If an exception is thrown before `release_after` has been called, the
+    destructor waits for kernels submitted to the queue, which may access
+    the allocation, and returns the allocation to the arena.
+ */
+template <typename T> class scratch_allocation
+{
+public:
+    scratch_allocation(const sycl::queue &q, size_t n)
+        : q_(q), arena_(&ScratchArenaRegistry::get().arena_for(q))
+    {
+        auto block = arena_->allocate(std::max<size_t>(n, 1) * sizeof(T));
+        ptr_ = reinterpret_cast<T *>(block.first);
+        chunk_ = block.second;
+    }
+
+    scratch_allocation(const scratch_allocation &) = delete;
+    scratch_allocation &operator=(const scratch_allocation &) = delete;
+
+    ~scratch_allocation()
+    {
+        if (chunk_ == nullptr) {
+            return;
+        }
+        try {
+            q_.wait();
+        } catch (const std::exception &) {
+            // the allocation is released regardless
+        }
+        arena_->release(chunk_);
+    }
+
+    T *get() const
+    {
+        return ptr_;
+    }
+
+    /*! @brief Submits host task returning the allocation to the arena after
+        `dependent_event`, returns the event of the host task. */
+    sycl::event release_after(sycl::queue &q,
+                              const sycl::event &dependent_event)
+    {
+        ScratchArena *arena = arena_;
+        scratch_chunk *chunk = chunk_;
+        sycl::event release_ev = q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependent_event);
+            cgh.host_task([arena, chunk]() { arena->release(chunk); });
+        });
+        // owned by the host task from now on
+        chunk_ = nullptr;
+        return release_ev;
+    }
+
+private:
+    sycl::queue q_;
+    ScratchArena *arena_;
+    scratch_chunk *chunk_;
+    T *ptr_;
+};
+
+} // namespace alloc_utils
+} // namespace tensor
+} // namespace dpctl
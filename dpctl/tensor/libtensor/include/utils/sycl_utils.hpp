@@ -66,6 +66,37 @@ size_t choose_workgroup_size(const size_t nelems,
     return wg;
 }
 
+/*! @brief Find the smallest multiple of supported sub-group size larger than
+ * nelems, considering up to `f` multiples of each sub-group size. Same as
+ * choose_workgroup_size<f>, with `f` known at run-time. */
+inline size_t choose_workgroup_size(const size_t nelems,
+                                    const std::vector<size_t> &sg_sizes,
+                                    const size_t f)
+{
+    std::vector<size_t> wg_choices;
+    wg_choices.reserve(f * sg_sizes.size());
+
+    for (const auto &sg_size : sg_sizes) {
+        for (size_t i = 1; i <= f; ++i) {
+            wg_choices.push_back(sg_size * i);
+        }
+    }
+    std::sort(std::begin(wg_choices), std::end(wg_choices));
+
+    size_t wg = 1;
+    for (size_t i = 0; i < wg_choices.size(); ++i) {
+        if (wg_choices[i] == wg) {
+            continue;
+        }
+        wg = wg_choices[i];
+        size_t n_groups = ((nelems + wg - 1) / wg);
+        if (n_groups == 1)
+            break;
+    }
+
+    return wg;
+}
+
 } // namespace sycl_utils
 } // namespace tensor
 } // namespace dpctl
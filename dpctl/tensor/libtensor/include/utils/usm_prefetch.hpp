@@ -0,0 +1,164 @@
+//=== usm_prefetch.hpp - Migration of USM-shared operands ------- *-C++-*/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines utilities migrating memory of USM-shared operands to the
+/// device of the execution queue ahead of kernel submission, so that kernels
+/// do not take page faults on first access, and advising the driver that
+/// memory of read-only inputs is read mostly.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dpctl4pybind11.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace usm_prefetch
+{
+
+/*! @brief Settings and statistics of prefetching of USM-shared operands.
+
+    Prefetching is enabled unless DPCTL_TENSOR_USM_PREFETCH=0 is set, and
+    read-mostly advice is given unless DPCTL_TENSOR_USM_ADVISE=0 is set.
+ */
+class PrefetchState
+{
+public:
+    static PrefetchState &get()
+    {
+        // Intentionally leaked, like other process-wide state of libtensor
+        static PrefetchState *state = new PrefetchState();
+        return *state;
+    }
+
+    std::atomic<bool> prefetch_enabled;
+    std::atomic<bool> advise_enabled;
+
+    std::atomic<size_t> n_prefetches{0};
+    std::atomic<size_t> prefetched_nbytes{0};
+    std::atomic<size_t> n_advices{0};
+
+    void reset_statistics()
+    {
+        n_prefetches = 0;
+        prefetched_nbytes = 0;
+        n_advices = 0;
+    }
+
+private:
+    PrefetchState()
+        : prefetch_enabled(env_flag("DPCTL_TENSOR_USM_PREFETCH")),
+          advise_enabled(env_flag("DPCTL_TENSOR_USM_ADVISE"))
+    {
+    }
+
+    static bool env_flag(const char *name)
+    {
+        const char *v = std::getenv(name);
+        return (v == nullptr) || (std::string(v) != "0");
+    }
+};
+
+// Value of ZE_MEMORY_ADVICE_SET_READ_MOSTLY of ze_memory_advice_t, passed
+// through sycl::handler::mem_advise to the Level-Zero driver
+static constexpr int ze_memory_advice_set_read_mostly = 0;
+
+/*! @brief Returns the pointer to the first byte of memory spanned by elements
+    of the array and the number of bytes spanned. */
+inline std::pair<char *, size_t>
+memory_span(const dpctl::tensor::usm_ndarray &arr)
+{
+    if (arr.get_size() == 0) {
+        return {nullptr, 0};
+    }
+    const auto minmax = arr.get_minmax_offsets();
+    const size_t elem_size = static_cast<size_t>(arr.get_elemsize());
+    char *first = arr.get_data() + minmax.first * elem_size;
+    const size_t nbytes = (minmax.second - minmax.first + 1) * elem_size;
+    return {first, nbytes};
+}
+
+/*! @brief Submits migration of memory of USM-shared `arrays` to the device
+    of `exec_q`, and read-mostly advice for those of them which are
+    read-only, after events `depends`.
+
+    Returns `depends` extended with the events of the submitted operations,
+    to be passed to kernels accessing the arrays in place of `depends`.
+    Nothing is submitted for devices sharing memory with the host.
+ */
+inline std::vector<sycl::event> prefetch_shared_operands(
+    sycl::queue &exec_q,
+    std::initializer_list<dpctl::tensor::usm_ndarray> arrays,
+    const std::vector<sycl::event> &depends)
+{
+    std::vector<sycl::event> all_deps(depends);
+
+    auto &state = PrefetchState::get();
+    const bool prefetch = state.prefetch_enabled.load();
+    const bool advise =
+        state.advise_enabled.load() &&
+        (exec_q.get_backend() == sycl::backend::ext_oneapi_level_zero);
+    if (!(prefetch || advise) || exec_q.get_device().is_cpu()) {
+        return all_deps;
+    }
+
+    const sycl::context &ctx = exec_q.get_context();
+    for (const auto &arr : arrays) {
+        const auto span = memory_span(arr);
+        if (span.second == 0 || sycl::get_pointer_type(span.first, ctx) !=
+                                    sycl::usm::alloc::shared)
+        {
+            continue;
+        }
+        if (advise && !arr.is_writable()) {
+            all_deps.push_back(exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(depends);
+                cgh.mem_advise(span.first, span.second,
+                               ze_memory_advice_set_read_mostly);
+            }));
+            ++state.n_advices;
+        }
+        if (prefetch) {
+            all_deps.push_back(exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(depends);
+                cgh.prefetch(span.first, span.second);
+            }));
+            ++state.n_prefetches;
+            state.prefetched_nbytes += span.second;
+        }
+    }
+
+    return all_deps;
+}
+
+} // namespace usm_prefetch
+} // namespace tensor
+} // namespace dpctl
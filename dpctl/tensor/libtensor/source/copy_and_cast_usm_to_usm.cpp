@@ -39,6 +39,7 @@
 #include "utils/memory_overlap.hpp"
 #include "utils/type_dispatch.hpp"
 #include "utils/type_utils.hpp"
+#include "utils/usm_prefetch.hpp"
 
 #include "simplify_iteration_space.hpp"
 
@@ -52,6 +53,7 @@ namespace py_internal
 namespace td_ns = dpctl::tensor::type_dispatch;
 
 using dpctl::tensor::kernels::copy_and_cast::copy_and_cast_1d_fn_ptr_t;
+using dpctl::tensor::kernels::copy_and_cast::copy_and_cast_2d_fn_ptr_t;
 using dpctl::tensor::kernels::copy_and_cast::copy_and_cast_contig_fn_ptr_t;
 using dpctl::tensor::kernels::copy_and_cast::copy_and_cast_generic_fn_ptr_t;
 
@@ -59,6 +61,8 @@ static copy_and_cast_generic_fn_ptr_t
     copy_and_cast_generic_dispatch_table[td_ns::num_types][td_ns::num_types];
 static copy_and_cast_1d_fn_ptr_t
     copy_and_cast_1d_dispatch_table[td_ns::num_types][td_ns::num_types];
+static copy_and_cast_2d_fn_ptr_t
+    copy_and_cast_2d_dispatch_table[td_ns::num_types][td_ns::num_types];
 static copy_and_cast_contig_fn_ptr_t
     copy_and_cast_contig_dispatch_table[td_ns::num_types][td_ns::num_types];
 
@@ -135,6 +139,11 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
         throw py::value_error("Arrays index overlapping segments of memory");
     }
 
+    // migrate USM-shared operands to the device ahead of kernels
+    const std::vector<sycl::event> prefetch_deps =
+        dpctl::tensor::usm_prefetch::prefetch_shared_operands(
+            exec_q, {src, dst}, depends);
+
     bool is_src_c_contig = src.is_c_contiguous();
     bool is_src_f_contig = src.is_f_contiguous();
 
@@ -154,13 +163,13 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
 
             copy_ev = exec_q.memcpy(static_cast<void *>(dst_data),
                                     static_cast<const void *>(src_data),
-                                    src_nelems * src_elem_size, depends);
+                                    src_nelems * src_elem_size, prefetch_deps);
         }
         else {
             auto contig_fn =
                 copy_and_cast_contig_dispatch_table[dst_type_id][src_type_id];
-            copy_ev =
-                contig_fn(exec_q, src_nelems, src_data, dst_data, depends);
+            copy_ev = contig_fn(exec_q, src_nelems, src_data, dst_data,
+                                prefetch_deps);
         }
         // make sure src and dst are not GC-ed before copy_ev is complete
         return std::make_pair(keep_args_alive(exec_q, {src, dst}, {copy_ev}),
@@ -202,8 +211,8 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
                 auto contig_fn =
                     copy_and_cast_contig_dispatch_table[dst_type_id]
                                                        [src_type_id];
-                sycl::event copy_and_cast_1d_event =
-                    contig_fn(exec_q, src_nelems, src_data, dst_data, depends);
+                copy_and_cast_1d_event = contig_fn(
+                    exec_q, src_nelems, src_data, dst_data, prefetch_deps);
             }
             else {
                 auto fn =
@@ -211,7 +220,7 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
                 copy_and_cast_1d_event =
                     fn(exec_q, src_nelems, shape_arr, src_strides_arr,
                        dst_strides_arr, src_data, src_offset, dst_data,
-                       dst_offset, depends);
+                       dst_offset, prefetch_deps);
             }
             return std::make_pair(
                 keep_args_alive(exec_q, {src, dst}, {copy_and_cast_1d_event}),
@@ -227,13 +236,32 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
 
             sycl::event copy_and_cast_0d_event = fn(
                 exec_q, src_nelems, shape_arr, src_strides_arr, dst_strides_arr,
-                src_data, src_offset, dst_data, dst_offset, depends);
+                src_data, src_offset, dst_data, dst_offset, prefetch_deps);
 
             return std::make_pair(
                 keep_args_alive(exec_q, {src, dst}, {copy_and_cast_0d_event}),
                 copy_and_cast_0d_event);
         }
     }
+    else if (nd == 2) {
+        // kernel over 2D range computes offsets without division
+        std::array<py::ssize_t, 2> shape_arr = {simplified_shape[0],
+                                                simplified_shape[1]};
+        std::array<py::ssize_t, 2> src_strides_arr = {
+            simplified_src_strides[0], simplified_src_strides[1]};
+        std::array<py::ssize_t, 2> dst_strides_arr = {
+            simplified_dst_strides[0], simplified_dst_strides[1]};
+
+        auto fn = copy_and_cast_2d_dispatch_table[dst_type_id][src_type_id];
+
+        sycl::event copy_and_cast_2d_event =
+            fn(exec_q, src_nelems, shape_arr, src_strides_arr, dst_strides_arr,
+               src_data, src_offset, dst_data, dst_offset, prefetch_deps);
+
+        return std::make_pair(
+            keep_args_alive(exec_q, {src, dst}, {copy_and_cast_2d_event}),
+            copy_and_cast_2d_event);
+    }
 
     // Generic implementation
     auto copy_and_cast_fn =
@@ -243,18 +271,25 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
     host_task_events.reserve(2);
 
     using dpctl::tensor::offset_utils::device_allocate_and_pack;
+    using dpctl::tensor::offset_utils::fast_divisors;
     const auto &ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
         exec_q, host_task_events, simplified_shape, simplified_src_strides,
-        simplified_dst_strides);
+        simplified_dst_strides, fast_divisors(simplified_shape));
     py::ssize_t *shape_strides = std::get<0>(ptr_size_event_tuple);
     if (shape_strides == nullptr) {
         throw std::runtime_error("Unable to allocate device memory");
     }
     sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
 
+    using dpctl::tensor::offset_utils::offsets_fit_int32;
+    const bool use_int32_indexing = offsets_fit_int32(
+        src_nelems, simplified_shape,
+        {{&simplified_src_strides, src_offset},
+         {&simplified_dst_strides, dst_offset}});
+
     sycl::event copy_and_cast_generic_ev = copy_and_cast_fn(
-        exec_q, src_nelems, nd, shape_strides, src_data, src_offset, dst_data,
-        dst_offset, depends, {copy_shape_ev});
+        exec_q, src_nelems, nd, shape_strides, use_int32_indexing, src_data,
+        src_offset, dst_data, dst_offset, prefetch_deps, {copy_shape_ev});
 
     // async free of shape_strides temporary
     auto ctx = exec_q.get_context();
@@ -291,6 +326,12 @@ void init_copy_and_cast_usm_to_usm_dispatch_tables(void)
                          num_types>
         dtb_1d;
     dtb_1d.populate_dispatch_table(copy_and_cast_1d_dispatch_table);
+
+    using dpctl::tensor::kernels::copy_and_cast::CopyAndCast2DFactory;
+    DispatchTableBuilder<copy_and_cast_2d_fn_ptr_t, CopyAndCast2DFactory,
+                         num_types>
+        dtb_2d;
+    dtb_2d.populate_dispatch_table(copy_and_cast_2d_dispatch_table);
 }
 
 } // namespace py_internal
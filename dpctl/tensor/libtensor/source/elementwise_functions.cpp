@@ -25,6 +25,7 @@
 
 #include "dpctl4pybind11.hpp"
 #include <CL/sycl.hpp>
+#include <pybind11/complex.h>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -125,8 +126,10 @@ int _result_typeid(int arg_typeid, const int *fn_output_id)
 }
 
 namespace ew_cmn_ns = dpctl::tensor::kernels::elementwise_common;
+using ew_cmn_ns::binary_broadcast_impl_fn_ptr_t;
 using ew_cmn_ns::binary_contig_impl_fn_ptr_t;
 using ew_cmn_ns::binary_contig_matrix_contig_row_broadcast_impl_fn_ptr_t;
+using ew_cmn_ns::binary_contig_scalar_impl_fn_ptr_t;
 using ew_cmn_ns::binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t;
 using ew_cmn_ns::binary_strided_impl_fn_ptr_t;
 using ew_cmn_ns::unary_contig_impl_fn_ptr_t;
@@ -195,6 +198,14 @@ static int add_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     add_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// add(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    add_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// add(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    add_contig_scalar_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 // add(matrix, row)
 static binary_contig_matrix_contig_row_broadcast_impl_fn_ptr_t
     add_contig_matrix_contig_row_broadcast_dispatch_table[td_ns::num_types]
@@ -277,6 +288,23 @@ void populate_add_dispatch_tables(void)
                          AddInplaceRowMatrixBroadcastFactory, num_types>
         dtb8;
     dtb8.populate_dispatch_table(add_inplace_row_matrix_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::AddBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t, AddBroadcastFactory,
+                         num_types>
+        dtb9;
+    dtb9.populate_dispatch_table(add_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::AddOutputType, fn_ns::AddFunctor,
+        fn_ns::add_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb10;
+    dtb10.populate_dispatch_table(add_contig_scalar_dispatch_table);
 };
 
 } // namespace impl
@@ -440,6 +468,15 @@ static int true_divide_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     true_divide_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// true_divide(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    true_divide_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// true_divide(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    true_divide_contig_scalar_dispatch_table[td_ns::num_types]
+                                            [td_ns::num_types];
+
 // divide(matrix, row)
 static binary_contig_matrix_contig_row_broadcast_impl_fn_ptr_t
     true_divide_contig_matrix_contig_row_broadcast_dispatch_table
@@ -450,6 +487,16 @@ static binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t
     true_divide_contig_row_contig_matrix_broadcast_dispatch_table
         [td_ns::num_types][td_ns::num_types];
 
+static binary_inplace_contig_impl_fn_ptr_t
+    true_divide_inplace_contig_dispatch_table[td_ns::num_types]
+                                             [td_ns::num_types];
+static binary_inplace_strided_impl_fn_ptr_t
+    true_divide_inplace_strided_dispatch_table[td_ns::num_types]
+                                              [td_ns::num_types];
+static binary_inplace_row_matrix_broadcast_impl_fn_ptr_t
+    true_divide_inplace_row_matrix_dispatch_table[td_ns::num_types]
+                                                 [td_ns::num_types];
+
 void populate_true_divide_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -493,6 +540,46 @@ void populate_true_divide_dispatch_tables(void)
         dtb5;
     dtb5.populate_dispatch_table(
         true_divide_contig_row_contig_matrix_broadcast_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::TrueDivideBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         TrueDivideBroadcastFactory, num_types>
+        dtb6;
+    dtb6.populate_dispatch_table(true_divide_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::TrueDivideOutputType, fn_ns::TrueDivideFunctor,
+        fn_ns::true_divide_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb7;
+    dtb7.populate_dispatch_table(true_divide_contig_scalar_dispatch_table);
+
+    // function pointers for inplace operation on general strided arrays
+    using fn_ns::TrueDivideInplaceStridedFactory;
+    DispatchTableBuilder<binary_inplace_strided_impl_fn_ptr_t,
+                         TrueDivideInplaceStridedFactory, num_types>
+        dtb8;
+    dtb8.populate_dispatch_table(true_divide_inplace_strided_dispatch_table);
+
+    // function pointers for inplace operation on contiguous inputs and output
+    using fn_ns::TrueDivideInplaceContigFactory;
+    DispatchTableBuilder<binary_inplace_contig_impl_fn_ptr_t,
+                         TrueDivideInplaceContigFactory, num_types>
+        dtb9;
+    dtb9.populate_dispatch_table(true_divide_inplace_contig_dispatch_table);
+
+    // function pointers for inplace operation on contiguous matrix
+    // and contiguous row
+    using fn_ns::TrueDivideInplaceRowMatrixBroadcastFactory;
+    DispatchTableBuilder<binary_inplace_row_matrix_broadcast_impl_fn_ptr_t,
+                         TrueDivideInplaceRowMatrixBroadcastFactory, num_types>
+        dtb10;
+    dtb10.populate_dispatch_table(
+        true_divide_inplace_row_matrix_dispatch_table);
 };
 
 } // namespace impl
@@ -509,6 +596,14 @@ static int equal_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     equal_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// equal(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    equal_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// equal(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    equal_contig_scalar_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 void populate_equal_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -532,6 +627,23 @@ void populate_equal_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(equal_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::EqualBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t, EqualBroadcastFactory,
+                         num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(equal_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::EqualOutputType, fn_ns::EqualFunctor,
+        fn_ns::equal_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(equal_contig_scalar_dispatch_table);
 };
 } // namespace impl
 
@@ -624,6 +736,25 @@ static int floor_divide_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     floor_divide_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// floor_divide(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    floor_divide_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// floor_divide(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    floor_divide_contig_scalar_dispatch_table[td_ns::num_types]
+                                             [td_ns::num_types];
+
+static binary_inplace_contig_impl_fn_ptr_t
+    floor_divide_inplace_contig_dispatch_table[td_ns::num_types]
+                                              [td_ns::num_types];
+static binary_inplace_strided_impl_fn_ptr_t
+    floor_divide_inplace_strided_dispatch_table[td_ns::num_types]
+                                               [td_ns::num_types];
+static binary_inplace_row_matrix_broadcast_impl_fn_ptr_t
+    floor_divide_inplace_row_matrix_dispatch_table[td_ns::num_types]
+                                                  [td_ns::num_types];
+
 void populate_floor_divide_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -647,6 +778,46 @@ void populate_floor_divide_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(floor_divide_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::FloorDivideBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         FloorDivideBroadcastFactory, num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(floor_divide_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::FloorDivideOutputType, fn_ns::FloorDivideFunctor,
+        fn_ns::floor_divide_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(floor_divide_contig_scalar_dispatch_table);
+
+    // function pointers for inplace operation on general strided arrays
+    using fn_ns::FloorDivideInplaceStridedFactory;
+    DispatchTableBuilder<binary_inplace_strided_impl_fn_ptr_t,
+                         FloorDivideInplaceStridedFactory, num_types>
+        dtb6;
+    dtb6.populate_dispatch_table(floor_divide_inplace_strided_dispatch_table);
+
+    // function pointers for inplace operation on contiguous inputs and output
+    using fn_ns::FloorDivideInplaceContigFactory;
+    DispatchTableBuilder<binary_inplace_contig_impl_fn_ptr_t,
+                         FloorDivideInplaceContigFactory, num_types>
+        dtb7;
+    dtb7.populate_dispatch_table(floor_divide_inplace_contig_dispatch_table);
+
+    // function pointers for inplace operation on contiguous matrix
+    // and contiguous row
+    using fn_ns::FloorDivideInplaceRowMatrixBroadcastFactory;
+    DispatchTableBuilder<binary_inplace_row_matrix_broadcast_impl_fn_ptr_t,
+                         FloorDivideInplaceRowMatrixBroadcastFactory, num_types>
+        dtb8;
+    dtb8.populate_dispatch_table(
+        floor_divide_inplace_row_matrix_dispatch_table);
 };
 
 } // namespace impl
@@ -663,6 +834,14 @@ static int greater_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     greater_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// greater(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    greater_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// greater(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    greater_contig_scalar_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 void populate_greater_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -686,6 +865,23 @@ void populate_greater_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(greater_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::GreaterBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         GreaterBroadcastFactory, num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(greater_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::GreaterOutputType, fn_ns::GreaterFunctor,
+        fn_ns::greater_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(greater_contig_scalar_dispatch_table);
 };
 } // namespace impl
 
@@ -701,6 +897,15 @@ static int greater_equal_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     greater_equal_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// greater_equal(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    greater_equal_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// greater_equal(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    greater_equal_contig_scalar_dispatch_table[td_ns::num_types]
+                                              [td_ns::num_types];
+
 void populate_greater_equal_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -724,6 +929,23 @@ void populate_greater_equal_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(greater_equal_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::GreaterEqualBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         GreaterEqualBroadcastFactory, num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(greater_equal_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::GreaterEqualOutputType, fn_ns::GreaterEqualFunctor,
+        fn_ns::greater_equal_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(greater_equal_contig_scalar_dispatch_table);
 };
 } // namespace impl
 
@@ -878,6 +1100,14 @@ static int less_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     less_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// less(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    less_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// less(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    less_contig_scalar_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 void populate_less_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -901,6 +1131,23 @@ void populate_less_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(less_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::LessBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t, LessBroadcastFactory,
+                         num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(less_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::LessOutputType, fn_ns::LessFunctor,
+        fn_ns::less_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(less_contig_scalar_dispatch_table);
 };
 } // namespace impl
 
@@ -916,6 +1163,14 @@ static int less_equal_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     less_equal_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// less_equal(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    less_equal_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// less_equal(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    less_equal_contig_scalar_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 void populate_less_equal_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -939,6 +1194,23 @@ void populate_less_equal_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(less_equal_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::LessEqualBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         LessEqualBroadcastFactory, num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(less_equal_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::LessEqualOutputType, fn_ns::LessEqualFunctor,
+        fn_ns::less_equal_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(less_equal_contig_scalar_dispatch_table);
 };
 } // namespace impl
 
@@ -1102,6 +1374,15 @@ static int logical_and_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     logical_and_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// logical_and(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    logical_and_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// logical_and(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    logical_and_contig_scalar_dispatch_table[td_ns::num_types]
+                                            [td_ns::num_types];
+
 void populate_logical_and_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -1125,6 +1406,23 @@ void populate_logical_and_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(logical_and_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::LogicalAndBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         LogicalAndBroadcastFactory, num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(logical_and_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::LogicalAndOutputType, fn_ns::LogicalAndFunctor,
+        fn_ns::logical_and_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(logical_and_contig_scalar_dispatch_table);
 };
 } // namespace impl
 
@@ -1174,6 +1472,14 @@ static int logical_or_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     logical_or_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// logical_or(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    logical_or_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// logical_or(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    logical_or_contig_scalar_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 void populate_logical_or_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -1197,6 +1503,23 @@ void populate_logical_or_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(logical_or_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::LogicalOrBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         LogicalOrBroadcastFactory, num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(logical_or_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::LogicalOrOutputType, fn_ns::LogicalOrFunctor,
+        fn_ns::logical_or_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(logical_or_contig_scalar_dispatch_table);
 };
 } // namespace impl
 
@@ -1212,6 +1535,15 @@ static int logical_xor_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     logical_xor_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// logical_xor(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    logical_xor_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// logical_xor(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    logical_xor_contig_scalar_dispatch_table[td_ns::num_types]
+                                            [td_ns::num_types];
+
 void populate_logical_xor_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -1235,6 +1567,23 @@ void populate_logical_xor_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(logical_xor_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::LogicalXorBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         LogicalXorBroadcastFactory, num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(logical_xor_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::LogicalXorOutputType, fn_ns::LogicalXorFunctor,
+        fn_ns::logical_xor_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(logical_xor_contig_scalar_dispatch_table);
 };
 } // namespace impl
 
@@ -1251,6 +1600,14 @@ static int multiply_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     multiply_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// multiply(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    multiply_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// multiply(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    multiply_contig_scalar_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 // mul(matrix, row)
 static binary_contig_matrix_contig_row_broadcast_impl_fn_ptr_t
     multiply_contig_matrix_contig_row_broadcast_dispatch_table
@@ -1334,6 +1691,23 @@ void populate_multiply_dispatch_tables(void)
                          MultiplyInplaceRowMatrixBroadcastFactory, num_types>
         dtb8;
     dtb8.populate_dispatch_table(multiply_inplace_row_matrix_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::MultiplyBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         MultiplyBroadcastFactory, num_types>
+        dtb9;
+    dtb9.populate_dispatch_table(multiply_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::MultiplyOutputType, fn_ns::MultiplyFunctor,
+        fn_ns::multiply_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb10;
+    dtb10.populate_dispatch_table(multiply_contig_scalar_dispatch_table);
 };
 
 } // namespace impl
@@ -1386,6 +1760,14 @@ static int not_equal_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     not_equal_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// not_equal(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    not_equal_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// not_equal(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    not_equal_contig_scalar_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 void populate_not_equal_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -1409,6 +1791,23 @@ void populate_not_equal_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(not_equal_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::NotEqualBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         NotEqualBroadcastFactory, num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(not_equal_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::NotEqualOutputType, fn_ns::NotEqualFunctor,
+        fn_ns::not_equal_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(not_equal_contig_scalar_dispatch_table);
 };
 } // namespace impl
 
@@ -1461,6 +1860,21 @@ static int pow_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     pow_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// pow(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    pow_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// pow(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    pow_contig_scalar_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+static binary_inplace_contig_impl_fn_ptr_t
+    pow_inplace_contig_dispatch_table[td_ns::num_types][td_ns::num_types];
+static binary_inplace_strided_impl_fn_ptr_t
+    pow_inplace_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
+static binary_inplace_row_matrix_broadcast_impl_fn_ptr_t
+    pow_inplace_row_matrix_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 void populate_pow_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -1484,6 +1898,45 @@ void populate_pow_dispatch_tables(void)
                          num_types>
         dtb3;
     dtb3.populate_dispatch_table(pow_contig_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::PowBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t, PowBroadcastFactory,
+                         num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(pow_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::PowOutputType, fn_ns::PowFunctor,
+        fn_ns::pow_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(pow_contig_scalar_dispatch_table);
+
+    // function pointers for inplace operation on general strided arrays
+    using fn_ns::PowInplaceStridedFactory;
+    DispatchTableBuilder<binary_inplace_strided_impl_fn_ptr_t,
+                         PowInplaceStridedFactory, num_types>
+        dtb6;
+    dtb6.populate_dispatch_table(pow_inplace_strided_dispatch_table);
+
+    // function pointers for inplace operation on contiguous inputs and output
+    using fn_ns::PowInplaceContigFactory;
+    DispatchTableBuilder<binary_inplace_contig_impl_fn_ptr_t,
+                         PowInplaceContigFactory, num_types>
+        dtb7;
+    dtb7.populate_dispatch_table(pow_inplace_contig_dispatch_table);
+
+    // function pointers for inplace operation on contiguous matrix
+    // and contiguous row
+    using fn_ns::PowInplaceRowMatrixBroadcastFactory;
+    DispatchTableBuilder<binary_inplace_row_matrix_broadcast_impl_fn_ptr_t,
+                         PowInplaceRowMatrixBroadcastFactory, num_types>
+        dtb8;
+    dtb8.populate_dispatch_table(pow_inplace_row_matrix_dispatch_table);
 };
 
 } // namespace impl
@@ -1698,6 +2151,14 @@ static int subtract_output_id_table[td_ns::num_types][td_ns::num_types];
 static binary_strided_impl_fn_ptr_t
     subtract_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+// subtract(x1, x2) of 1D or 2D arrays, with broadcasting
+static binary_broadcast_impl_fn_ptr_t
+    subtract_broadcast_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+// subtract(x1, x2) of contiguous array and scalar passed by value
+static binary_contig_scalar_impl_fn_ptr_t
+    subtract_contig_scalar_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 // sub(matrix, row)
 static binary_contig_matrix_contig_row_broadcast_impl_fn_ptr_t
     subtract_contig_matrix_contig_row_broadcast_dispatch_table
@@ -1781,6 +2242,23 @@ void populate_subtract_dispatch_tables(void)
                          SubtractInplaceRowMatrixBroadcastFactory, num_types>
         dtb8;
     dtb8.populate_dispatch_table(subtract_inplace_row_matrix_dispatch_table);
+
+    // function pointers for operation on arrays with at most 2 dimensions,
+    // one or both inputs being possibly broadcast
+    using fn_ns::SubtractBroadcastFactory;
+    DispatchTableBuilder<binary_broadcast_impl_fn_ptr_t,
+                         SubtractBroadcastFactory, num_types>
+        dtb9;
+    dtb9.populate_dispatch_table(subtract_broadcast_dispatch_table);
+
+    // function pointers for operation on contiguous array and scalar
+    using ContigScalarFactory = ew_cmn_ns::BinaryContigScalarFactory<
+        fn_ns::SubtractOutputType, fn_ns::SubtractFunctor,
+        fn_ns::subtract_scalar_broadcast_krn>;
+    DispatchTableBuilder<binary_contig_scalar_impl_fn_ptr_t,
+                         ContigScalarFactory::factory, num_types>
+        dtb10;
+    dtb10.populate_dispatch_table(subtract_contig_scalar_dispatch_table);
 };
 
 } // namespace impl
@@ -1844,6 +2322,8 @@ void init_elementwise_functions(py::module_ m)
     // B01: ===== ADD   (x1, x2)
     {
         impl::populate_add_dispatch_tables();
+        using impl::add_contig_scalar_dispatch_table;
+        using impl::add_broadcast_dispatch_table;
         using impl::add_contig_dispatch_table;
         using impl::add_contig_matrix_contig_row_broadcast_dispatch_table;
         using impl::add_contig_row_contig_matrix_broadcast_dispatch_table;
@@ -1867,7 +2347,10 @@ void init_elementwise_functions(py::module_ m)
                 add_contig_matrix_contig_row_broadcast_dispatch_table,
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
-                add_contig_row_contig_matrix_broadcast_dispatch_table);
+                add_contig_row_contig_matrix_broadcast_dispatch_table,
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                add_broadcast_dispatch_table);
         };
         auto add_result_type_pyapi = [&](py::dtype dtype1, py::dtype dtype2) {
             return py_binary_ufunc_result_type(dtype1, dtype2,
@@ -1878,6 +2361,23 @@ void init_elementwise_functions(py::module_ m)
               py::arg("depends") = py::list());
         m.def("_add_result_type", add_result_type_pyapi, "");
 
+        auto add_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, add_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    add_contig_scalar_dispatch_table);
+            };
+        m.def("_add_scalar", add_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
         using impl::add_inplace_contig_dispatch_table;
         using impl::add_inplace_row_matrix_dispatch_table;
         using impl::add_inplace_strided_dispatch_table;
@@ -1990,6 +2490,8 @@ void init_elementwise_functions(py::module_ m)
     // B08: ==== DIVIDE        (x1, x2)
     {
         impl::populate_true_divide_dispatch_tables();
+        using impl::true_divide_contig_scalar_dispatch_table;
+        using impl::true_divide_broadcast_dispatch_table;
         using impl::true_divide_contig_dispatch_table;
         using impl::
             true_divide_contig_matrix_contig_row_broadcast_dispatch_table;
@@ -2016,7 +2518,10 @@ void init_elementwise_functions(py::module_ m)
                 true_divide_contig_matrix_contig_row_broadcast_dispatch_table,
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
-                true_divide_contig_row_contig_matrix_broadcast_dispatch_table);
+                true_divide_contig_row_contig_matrix_broadcast_dispatch_table,
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                true_divide_broadcast_dispatch_table);
         };
         auto divide_result_type_pyapi = [&](py::dtype dtype1,
                                             py::dtype dtype2) {
@@ -2027,11 +2532,55 @@ void init_elementwise_functions(py::module_ m)
               py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_divide_result_type", divide_result_type_pyapi, "");
+
+        auto divide_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, true_divide_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    true_divide_contig_scalar_dispatch_table);
+            };
+        m.def("_divide_scalar", divide_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
+        using impl::true_divide_inplace_contig_dispatch_table;
+        using impl::true_divide_inplace_row_matrix_dispatch_table;
+        using impl::true_divide_inplace_strided_dispatch_table;
+
+        auto true_divide_inplace_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, dpctl::tensor::usm_ndarray dst,
+                sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_inplace_ufunc(
+                    src, dst, exec_q, depends, true_divide_output_id_table,
+                    // function pointers to handle inplace operation on
+                    // contiguous arrays (pointers may be nullptr)
+                    true_divide_inplace_contig_dispatch_table,
+                    // function pointers to handle inplace operation on strided
+                    // arrays (most general case)
+                    true_divide_inplace_strided_dispatch_table,
+                    // function pointers to handle inplace operation on
+                    // c-contig matrix with c-contig row with broadcasting
+                    // (may be nullptr)
+                    true_divide_inplace_row_matrix_dispatch_table);
+            };
+        m.def("_divide_inplace", true_divide_inplace_pyapi, "", py::arg("lhs"),
+              py::arg("rhs"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // B09: ==== EQUAL         (x1, x2)
     {
         impl::populate_equal_dispatch_tables();
+        using impl::equal_contig_scalar_dispatch_table;
+        using impl::equal_broadcast_dispatch_table;
         using impl::equal_contig_dispatch_table;
         using impl::equal_output_id_table;
         using impl::equal_strided_dispatch_table;
@@ -2056,7 +2605,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                equal_broadcast_dispatch_table);
         };
         auto equal_result_type_pyapi = [&](py::dtype dtype1, py::dtype dtype2) {
             return py_binary_ufunc_result_type(dtype1, dtype2,
@@ -2066,6 +2618,23 @@ void init_elementwise_functions(py::module_ m)
               py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_equal_result_type", equal_result_type_pyapi, "");
+
+        auto equal_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, equal_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    equal_contig_scalar_dispatch_table);
+            };
+        m.def("_equal_scalar", equal_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // U13: ==== EXP           (x)
@@ -2119,6 +2688,8 @@ void init_elementwise_functions(py::module_ m)
     // B10: ==== FLOOR_DIVIDE  (x1, x2)
     {
         impl::populate_floor_divide_dispatch_tables();
+        using impl::floor_divide_contig_scalar_dispatch_table;
+        using impl::floor_divide_broadcast_dispatch_table;
         using impl::floor_divide_contig_dispatch_table;
         using impl::floor_divide_output_id_table;
         using impl::floor_divide_strided_dispatch_table;
@@ -2144,7 +2715,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                floor_divide_broadcast_dispatch_table);
         };
         auto floor_divide_result_type_pyapi = [&](py::dtype dtype1,
                                                   py::dtype dtype2) {
@@ -2155,11 +2729,55 @@ void init_elementwise_functions(py::module_ m)
               py::arg("src2"), py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_floor_divide_result_type", floor_divide_result_type_pyapi, "");
+
+        auto floor_divide_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, floor_divide_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    floor_divide_contig_scalar_dispatch_table);
+            };
+        m.def("_floor_divide_scalar", floor_divide_scalar_pyapi, "",
+              py::arg("src"), py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
+        using impl::floor_divide_inplace_contig_dispatch_table;
+        using impl::floor_divide_inplace_row_matrix_dispatch_table;
+        using impl::floor_divide_inplace_strided_dispatch_table;
+
+        auto floor_divide_inplace_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, dpctl::tensor::usm_ndarray dst,
+                sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_inplace_ufunc(
+                    src, dst, exec_q, depends, floor_divide_output_id_table,
+                    // function pointers to handle inplace operation on
+                    // contiguous arrays (pointers may be nullptr)
+                    floor_divide_inplace_contig_dispatch_table,
+                    // function pointers to handle inplace operation on strided
+                    // arrays (most general case)
+                    floor_divide_inplace_strided_dispatch_table,
+                    // function pointers to handle inplace operation on
+                    // c-contig matrix with c-contig row with broadcasting
+                    // (may be nullptr)
+                    floor_divide_inplace_row_matrix_dispatch_table);
+            };
+        m.def("_floor_divide_inplace", floor_divide_inplace_pyapi, "",
+              py::arg("lhs"), py::arg("rhs"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // B11: ==== GREATER       (x1, x2)
     {
         impl::populate_greater_dispatch_tables();
+        using impl::greater_contig_scalar_dispatch_table;
+        using impl::greater_broadcast_dispatch_table;
         using impl::greater_contig_dispatch_table;
         using impl::greater_output_id_table;
         using impl::greater_strided_dispatch_table;
@@ -2184,7 +2802,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                greater_broadcast_dispatch_table);
         };
         auto greater_result_type_pyapi = [&](py::dtype dtype1,
                                              py::dtype dtype2) {
@@ -2195,11 +2816,30 @@ void init_elementwise_functions(py::module_ m)
               py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_greater_result_type", greater_result_type_pyapi, "");
+
+        auto greater_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, greater_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    greater_contig_scalar_dispatch_table);
+            };
+        m.def("_greater_scalar", greater_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // B12: ==== GREATER_EQUAL (x1, x2)
     {
         impl::populate_greater_equal_dispatch_tables();
+        using impl::greater_equal_contig_scalar_dispatch_table;
+        using impl::greater_equal_broadcast_dispatch_table;
         using impl::greater_equal_contig_dispatch_table;
         using impl::greater_equal_output_id_table;
         using impl::greater_equal_strided_dispatch_table;
@@ -2225,7 +2865,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                greater_equal_broadcast_dispatch_table);
         };
         auto greater_equal_result_type_pyapi = [&](py::dtype dtype1,
                                                    py::dtype dtype2) {
@@ -2237,6 +2880,23 @@ void init_elementwise_functions(py::module_ m)
               py::arg("depends") = py::list());
         m.def("_greater_equal_result_type", greater_equal_result_type_pyapi,
               "");
+
+        auto greater_equal_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, greater_equal_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    greater_equal_contig_scalar_dispatch_table);
+            };
+        m.def("_greater_equal_scalar", greater_equal_scalar_pyapi, "",
+              py::arg("src"), py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // U16: ==== IMAG        (x)
@@ -2337,6 +2997,8 @@ void init_elementwise_functions(py::module_ m)
     // B13: ==== LESS        (x1, x2)
     {
         impl::populate_less_dispatch_tables();
+        using impl::less_contig_scalar_dispatch_table;
+        using impl::less_broadcast_dispatch_table;
         using impl::less_contig_dispatch_table;
         using impl::less_output_id_table;
         using impl::less_strided_dispatch_table;
@@ -2361,7 +3023,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                less_broadcast_dispatch_table);
         };
         auto less_result_type_pyapi = [&](py::dtype dtype1, py::dtype dtype2) {
             return py_binary_ufunc_result_type(dtype1, dtype2,
@@ -2371,11 +3036,30 @@ void init_elementwise_functions(py::module_ m)
               py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_less_result_type", less_result_type_pyapi, "");
+
+        auto less_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, less_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    less_contig_scalar_dispatch_table);
+            };
+        m.def("_less_scalar", less_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // B14: ==== LESS_EQUAL  (x1, x2)
     {
         impl::populate_less_equal_dispatch_tables();
+        using impl::less_equal_contig_scalar_dispatch_table;
+        using impl::less_equal_broadcast_dispatch_table;
         using impl::less_equal_contig_dispatch_table;
         using impl::less_equal_output_id_table;
         using impl::less_equal_strided_dispatch_table;
@@ -2401,7 +3085,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                less_equal_broadcast_dispatch_table);
         };
         auto less_equal_result_type_pyapi = [&](py::dtype dtype1,
                                                 py::dtype dtype2) {
@@ -2412,6 +3099,23 @@ void init_elementwise_functions(py::module_ m)
               py::arg("src2"), py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_less_equal_result_type", less_equal_result_type_pyapi, "");
+
+        auto less_equal_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, less_equal_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    less_equal_contig_scalar_dispatch_table);
+            };
+        m.def("_less_equal_scalar", less_equal_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // U20: ==== LOG         (x)
@@ -2512,6 +3216,8 @@ void init_elementwise_functions(py::module_ m)
     // B16: ==== LOGICAL_AND (x1, x2)
     {
         impl::populate_logical_and_dispatch_tables();
+        using impl::logical_and_contig_scalar_dispatch_table;
+        using impl::logical_and_broadcast_dispatch_table;
         using impl::logical_and_contig_dispatch_table;
         using impl::logical_and_output_id_table;
         using impl::logical_and_strided_dispatch_table;
@@ -2537,7 +3243,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                logical_and_broadcast_dispatch_table);
         };
         auto logical_and_result_type_pyapi = [&](py::dtype dtype1,
                                                  py::dtype dtype2) {
@@ -2548,6 +3257,23 @@ void init_elementwise_functions(py::module_ m)
               py::arg("src2"), py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_logical_and_result_type", logical_and_result_type_pyapi, "");
+
+        auto logical_and_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, logical_and_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    logical_and_contig_scalar_dispatch_table);
+            };
+        m.def("_logical_and_scalar", logical_and_scalar_pyapi, "",
+              py::arg("src"), py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // U24: ==== LOGICAL_NOT (x)
@@ -2578,6 +3304,8 @@ void init_elementwise_functions(py::module_ m)
     // B17: ==== LOGICAL_OR  (x1, x2)
     {
         impl::populate_logical_or_dispatch_tables();
+        using impl::logical_or_contig_scalar_dispatch_table;
+        using impl::logical_or_broadcast_dispatch_table;
         using impl::logical_or_contig_dispatch_table;
         using impl::logical_or_output_id_table;
         using impl::logical_or_strided_dispatch_table;
@@ -2603,7 +3331,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                logical_or_broadcast_dispatch_table);
         };
         auto logical_or_result_type_pyapi = [&](py::dtype dtype1,
                                                 py::dtype dtype2) {
@@ -2614,11 +3345,30 @@ void init_elementwise_functions(py::module_ m)
               py::arg("src2"), py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_logical_or_result_type", logical_or_result_type_pyapi, "");
+
+        auto logical_or_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, logical_or_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    logical_or_contig_scalar_dispatch_table);
+            };
+        m.def("_logical_or_scalar", logical_or_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // B18: ==== LOGICAL_XOR (x1, x2)
     {
         impl::populate_logical_xor_dispatch_tables();
+        using impl::logical_xor_contig_scalar_dispatch_table;
+        using impl::logical_xor_broadcast_dispatch_table;
         using impl::logical_xor_contig_dispatch_table;
         using impl::logical_xor_output_id_table;
         using impl::logical_xor_strided_dispatch_table;
@@ -2644,7 +3394,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                logical_xor_broadcast_dispatch_table);
         };
         auto logical_xor_result_type_pyapi = [&](py::dtype dtype1,
                                                  py::dtype dtype2) {
@@ -2655,11 +3408,30 @@ void init_elementwise_functions(py::module_ m)
               py::arg("src2"), py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_logical_xor_result_type", logical_xor_result_type_pyapi, "");
+
+        auto logical_xor_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, logical_xor_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    logical_xor_contig_scalar_dispatch_table);
+            };
+        m.def("_logical_xor_scalar", logical_xor_scalar_pyapi, "",
+              py::arg("src"), py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // B19: ==== MULTIPLY    (x1, x2)
     {
         impl::populate_multiply_dispatch_tables();
+        using impl::multiply_contig_scalar_dispatch_table;
+        using impl::multiply_broadcast_dispatch_table;
         using impl::multiply_contig_dispatch_table;
         using impl::multiply_contig_matrix_contig_row_broadcast_dispatch_table;
         using impl::multiply_contig_row_contig_matrix_broadcast_dispatch_table;
@@ -2684,7 +3456,10 @@ void init_elementwise_functions(py::module_ m)
                     multiply_contig_matrix_contig_row_broadcast_dispatch_table,
                     // function pointers to handle operation of c-contig matrix
                     // and c-contig row with broadcasting (may be nullptr)
-                    multiply_contig_row_contig_matrix_broadcast_dispatch_table);
+                    multiply_contig_row_contig_matrix_broadcast_dispatch_table,
+                    // function pointers to handle operation on arrays with at
+                    // most 2 dimensions with broadcasting (may be nullptr)
+                    multiply_broadcast_dispatch_table);
             };
         auto multiply_result_type_pyapi = [&](py::dtype dtype1,
                                               py::dtype dtype2) {
@@ -2696,6 +3471,23 @@ void init_elementwise_functions(py::module_ m)
               py::arg("depends") = py::list());
         m.def("_multiply_result_type", multiply_result_type_pyapi, "");
 
+        auto multiply_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, multiply_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    multiply_contig_scalar_dispatch_table);
+            };
+        m.def("_multiply_scalar", multiply_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
         using impl::multiply_inplace_contig_dispatch_table;
         using impl::multiply_inplace_row_matrix_dispatch_table;
         using impl::multiply_inplace_strided_dispatch_table;
@@ -2749,6 +3541,8 @@ void init_elementwise_functions(py::module_ m)
     // B20: ==== NOT_EQUAL   (x1, x2)
     {
         impl::populate_not_equal_dispatch_tables();
+        using impl::not_equal_contig_scalar_dispatch_table;
+        using impl::not_equal_broadcast_dispatch_table;
         using impl::not_equal_contig_dispatch_table;
         using impl::not_equal_output_id_table;
         using impl::not_equal_strided_dispatch_table;
@@ -2774,7 +3568,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                not_equal_broadcast_dispatch_table);
         };
         auto not_equal_result_type_pyapi = [&](py::dtype dtype1,
                                                py::dtype dtype2) {
@@ -2785,6 +3582,23 @@ void init_elementwise_functions(py::module_ m)
               py::arg("src2"), py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_not_equal_result_type", not_equal_result_type_pyapi, "");
+
+        auto not_equal_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, not_equal_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    not_equal_contig_scalar_dispatch_table);
+            };
+        m.def("_not_equal_scalar", not_equal_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // U26: ==== POSITIVE    (x)
@@ -2815,6 +3629,8 @@ void init_elementwise_functions(py::module_ m)
     {
 
         impl::populate_pow_dispatch_tables();
+        using impl::pow_contig_scalar_dispatch_table;
+        using impl::pow_broadcast_dispatch_table;
         using impl::pow_contig_dispatch_table;
         using impl::pow_output_id_table;
         using impl::pow_strided_dispatch_table;
@@ -2838,7 +3654,10 @@ void init_elementwise_functions(py::module_ m)
                 // function pointers to handle operation of c-contig matrix and
                 // c-contig row with broadcasting (may be nullptr)
                 td_ns::NullPtrTable<
-                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
+                    binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{},
+                // function pointers to handle operation on arrays with at
+                // most 2 dimensions with broadcasting (may be nullptr)
+                pow_broadcast_dispatch_table);
         };
         auto pow_result_type_pyapi = [&](py::dtype dtype1, py::dtype dtype2) {
             return py_binary_ufunc_result_type(dtype1, dtype2,
@@ -2848,6 +3667,48 @@ void init_elementwise_functions(py::module_ m)
               py::arg("dst"), py::arg("sycl_queue"),
               py::arg("depends") = py::list());
         m.def("_pow_result_type", pow_result_type_pyapi, "");
+
+        auto pow_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, pow_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    pow_contig_scalar_dispatch_table);
+            };
+        m.def("_pow_scalar", pow_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
+        using impl::pow_inplace_contig_dispatch_table;
+        using impl::pow_inplace_row_matrix_dispatch_table;
+        using impl::pow_inplace_strided_dispatch_table;
+
+        auto pow_inplace_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, dpctl::tensor::usm_ndarray dst,
+                sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_inplace_ufunc(
+                    src, dst, exec_q, depends, pow_output_id_table,
+                    // function pointers to handle inplace operation on
+                    // contiguous arrays (pointers may be nullptr)
+                    pow_inplace_contig_dispatch_table,
+                    // function pointers to handle inplace operation on strided
+                    // arrays (most general case)
+                    pow_inplace_strided_dispatch_table,
+                    // function pointers to handle inplace operation on
+                    // c-contig matrix with c-contig row with broadcasting
+                    // (may be nullptr)
+                    pow_inplace_row_matrix_dispatch_table);
+            };
+        m.def("_pow_inplace", pow_inplace_pyapi, "", py::arg("lhs"),
+              py::arg("rhs"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
     }
 
     // U??: ==== PROJ        (x)
@@ -2975,6 +3836,8 @@ void init_elementwise_functions(py::module_ m)
     // B23: ==== SUBTRACT    (x1, x2)
     {
         impl::populate_subtract_dispatch_tables();
+        using impl::subtract_contig_scalar_dispatch_table;
+        using impl::subtract_broadcast_dispatch_table;
         using impl::subtract_contig_dispatch_table;
         using impl::subtract_contig_matrix_contig_row_broadcast_dispatch_table;
         using impl::subtract_contig_row_contig_matrix_broadcast_dispatch_table;
@@ -2999,7 +3862,10 @@ void init_elementwise_functions(py::module_ m)
                     subtract_contig_matrix_contig_row_broadcast_dispatch_table,
                     // function pointers to handle operation of c-contig matrix
                     // and c-contig row with broadcasting (may be nullptr)
-                    subtract_contig_row_contig_matrix_broadcast_dispatch_table);
+                    subtract_contig_row_contig_matrix_broadcast_dispatch_table,
+                    // function pointers to handle operation on arrays with at
+                    // most 2 dimensions with broadcasting (may be nullptr)
+                    subtract_broadcast_dispatch_table);
             };
         auto subtract_result_type_pyapi = [&](py::dtype dtype1,
                                               py::dtype dtype2) {
@@ -3011,6 +3877,23 @@ void init_elementwise_functions(py::module_ m)
               py::arg("depends") = py::list());
         m.def("_subtract_result_type", subtract_result_type_pyapi, "");
 
+        auto subtract_scalar_pyapi =
+            [&](dpctl::tensor::usm_ndarray src, py::object scalar,
+                py::dtype scalar_dtype, bool scalar_is_first,
+                dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
+                const std::vector<sycl::event> &depends = {}) {
+                return py_binary_scalar_ufunc(
+                    src, scalar, scalar_dtype, scalar_is_first, dst, exec_q,
+                    depends, subtract_output_id_table,
+                    // function pointers to handle operation on contiguous
+                    // array and scalar passed by value
+                    subtract_contig_scalar_dispatch_table);
+            };
+        m.def("_subtract_scalar", subtract_scalar_pyapi, "", py::arg("src"),
+              py::arg("scalar"), py::arg("scalar_dtype"),
+              py::arg("scalar_is_first"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
         using impl::subtract_inplace_contig_dispatch_table;
         using impl::subtract_inplace_row_matrix_dispatch_table;
         using impl::subtract_inplace_strided_dispatch_table;
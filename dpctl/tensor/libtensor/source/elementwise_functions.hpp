@@ -37,6 +37,7 @@
 #include "utils/memory_overlap.hpp"
 #include "utils/offset_utils.hpp"
 #include "utils/type_dispatch.hpp"
+#include "utils/usm_prefetch.hpp"
 
 namespace dpctl
 {
@@ -134,6 +135,11 @@ py_unary_ufunc(dpctl::tensor::usm_ndarray src,
         throw py::value_error("Arrays index overlapping segments of memory");
     }
 
+    // migrate USM-shared operands to the device ahead of kernels
+    const std::vector<sycl::event> prefetch_deps =
+        dpctl::tensor::usm_prefetch::prefetch_shared_operands(
+            q, {src, dst}, depends);
+
     const char *src_data = src.get_data();
     char *dst_data = dst.get_data();
 
@@ -156,7 +162,8 @@ py_unary_ufunc(dpctl::tensor::usm_ndarray src,
                 std::to_string(src_typeid));
         }
 
-        auto comp_ev = contig_fn(q, src_nelems, src_data, dst_data, depends);
+        auto comp_ev =
+            contig_fn(q, src_nelems, src_data, dst_data, prefetch_deps);
         sycl::event ht_ev =
             dpctl::utils::keep_args_alive(q, {src, dst}, {comp_ev});
 
@@ -201,7 +208,7 @@ py_unary_ufunc(dpctl::tensor::usm_ndarray src,
         int dst_elem_size = dst.get_elemsize();
         auto comp_ev =
             contig_fn(q, src_nelems, src_data + src_elem_size * src_offset,
-                      dst_data + dst_elem_size * dst_offset, depends);
+                      dst_data + dst_elem_size * dst_offset, prefetch_deps);
 
         sycl::event ht_ev =
             dpctl::utils::keep_args_alive(q, {src, dst}, {comp_ev});
@@ -219,13 +226,14 @@ py_unary_ufunc(dpctl::tensor::usm_ndarray src,
     }
 
     using dpctl::tensor::offset_utils::device_allocate_and_pack;
+    using dpctl::tensor::offset_utils::fast_divisors;
 
     std::vector<sycl::event> host_tasks{};
     host_tasks.reserve(2);
 
     const auto &ptr_size_event_triple_ = device_allocate_and_pack<py::ssize_t>(
         q, host_tasks, simplified_shape, simplified_src_strides,
-        simplified_dst_strides);
+        simplified_dst_strides, fast_divisors(simplified_shape));
     py::ssize_t *shape_strides = std::get<0>(ptr_size_event_triple_);
     sycl::event copy_shape_ev = std::get<2>(ptr_size_event_triple_);
 
@@ -233,9 +241,16 @@ py_unary_ufunc(dpctl::tensor::usm_ndarray src,
         throw std::runtime_error("Device memory allocation failed");
     }
 
+    using dpctl::tensor::offset_utils::offsets_fit_int32;
+    const bool use_int32_indexing = offsets_fit_int32(
+        src_nelems, simplified_shape,
+        {{&simplified_src_strides, src_offset},
+         {&simplified_dst_strides, dst_offset}});
+
     sycl::event strided_fn_ev =
-        strided_fn(q, src_nelems, nd, shape_strides, src_data, src_offset,
-                   dst_data, dst_offset, depends, {copy_shape_ev});
+        strided_fn(q, src_nelems, nd, shape_strides, use_int32_indexing,
+                   src_data, src_offset, dst_data, dst_offset, prefetch_deps,
+                   {copy_shape_ev});
 
     // async free of shape_strides temporary
     auto ctx = q.get_context();
@@ -296,7 +311,8 @@ template <typename output_typesT,
           typename contig_dispatchT,
           typename strided_dispatchT,
           typename contig_matrix_row_dispatchT,
-          typename contig_row_matrix_dispatchT>
+          typename contig_row_matrix_dispatchT,
+          typename broadcast_dispatchT>
 std::pair<sycl::event, sycl::event> py_binary_ufunc(
     dpctl::tensor::usm_ndarray src1,
     dpctl::tensor::usm_ndarray src2,
@@ -310,7 +326,8 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
     const contig_matrix_row_dispatchT
         &contig_matrix_row_broadcast_dispatch_table,
     const contig_row_matrix_dispatchT
-        &contig_row_matrix_broadcast_dispatch_table)
+        &contig_row_matrix_broadcast_dispatch_table,
+    const broadcast_dispatchT &broadcast_dispatch_table)
 {
     if (!dst.is_writable()) {
         throw py::value_error("Output array is read-only.");
@@ -380,10 +397,22 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
     }
 
     // check memory overlap
+    // output identical to an input is allowed, since each element is
+    // read by the work-item which writes it
     auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
-    if (overlap(src1, dst) || overlap(src2, dst)) {
+    auto const &same_logical_tensors =
+        dpctl::tensor::overlap::SameLogicalTensors();
+    if ((overlap(src1, dst) && !same_logical_tensors(src1, dst)) ||
+        (overlap(src2, dst) && !same_logical_tensors(src2, dst)))
+    {
         throw py::value_error("Arrays index overlapping segments of memory");
     }
+
+    // migrate USM-shared operands to the device ahead of kernels
+    const std::vector<sycl::event> prefetch_deps =
+        dpctl::tensor::usm_prefetch::prefetch_shared_operands(
+            exec_q, {src1, src2, dst}, depends);
+
     // check memory overlap
     const char *src1_data = src1.get_data();
     const char *src2_data = src2.get_data();
@@ -410,7 +439,7 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
 
         if (contig_fn != nullptr) {
             auto comp_ev = contig_fn(exec_q, src_nelems, src1_data, 0,
-                                     src2_data, 0, dst_data, 0, depends);
+                                     src2_data, 0, dst_data, 0, prefetch_deps);
             sycl::event ht_ev = dpctl::utils::keep_args_alive(
                 exec_q, {src1, src2, dst}, {comp_ev});
 
@@ -457,7 +486,7 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
             if (contig_fn != nullptr) {
                 auto comp_ev = contig_fn(exec_q, src_nelems, src1_data,
                                          src1_offset, src2_data, src2_offset,
-                                         dst_data, dst_offset, depends);
+                                         dst_data, dst_offset, prefetch_deps);
                 sycl::event ht_ev = dpctl::utils::keep_args_alive(
                     exec_q, {src1, src2, dst}, {comp_ev});
 
@@ -483,7 +512,8 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
                     size_t n1 = simplified_shape[1];
                     sycl::event comp_ev = matrix_row_broadcast_fn(
                         exec_q, host_tasks, n0, n1, src1_data, src1_offset,
-                        src2_data, src2_offset, dst_data, dst_offset, depends);
+                        src2_data, src2_offset, dst_data, dst_offset,
+                        prefetch_deps);
 
                     return std::make_pair(
                         dpctl::utils::keep_args_alive(exec_q, {src1, src2, dst},
@@ -503,7 +533,8 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
                     size_t n1 = simplified_shape[0];
                     sycl::event comp_ev = row_matrix_broadcast_fn(
                         exec_q, host_tasks, n0, n1, src1_data, src1_offset,
-                        src2_data, src2_offset, dst_data, dst_offset, depends);
+                        src2_data, src2_offset, dst_data, dst_offset,
+                        prefetch_deps);
 
                     return std::make_pair(
                         dpctl::utils::keep_args_alive(exec_q, {src1, src2, dst},
@@ -512,6 +543,21 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
                 }
             }
         }
+
+        // remaining broadcasting patterns, e.g. column vectors, scalars,
+        // or outer products, use strides passed to kernels by value
+        auto broadcast_fn = broadcast_dispatch_table[src1_typeid][src2_typeid];
+        if (nd > 0 && broadcast_fn != nullptr) {
+            sycl::event comp_ev = broadcast_fn(
+                exec_q, nd, simplified_shape.data(), src1_data, src1_offset,
+                simplified_src1_strides.data(), src2_data, src2_offset,
+                simplified_src2_strides.data(), dst_data, dst_offset,
+                simplified_dst_strides.data(), prefetch_deps);
+            sycl::event ht_ev = dpctl::utils::keep_args_alive(
+                exec_q, {src1, src2, dst}, {comp_ev});
+
+            return std::make_pair(ht_ev, comp_ev);
+        }
     }
 
     // dispatch to strided code
@@ -525,9 +571,11 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
     }
 
     using dpctl::tensor::offset_utils::device_allocate_and_pack;
+    using dpctl::tensor::offset_utils::fast_divisors;
     const auto &ptr_sz_event_triple_ = device_allocate_and_pack<py::ssize_t>(
         exec_q, host_tasks, simplified_shape, simplified_src1_strides,
-        simplified_src2_strides, simplified_dst_strides);
+        simplified_src2_strides, simplified_dst_strides,
+        fast_divisors(simplified_shape));
 
     py::ssize_t *shape_strides = std::get<0>(ptr_sz_event_triple_);
     sycl::event copy_shape_ev = std::get<2>(ptr_sz_event_triple_);
@@ -536,9 +584,17 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
         throw std::runtime_error("Unabled to allocate device memory");
     }
 
+    using dpctl::tensor::offset_utils::offsets_fit_int32;
+    const bool use_int32_indexing = offsets_fit_int32(
+        src_nelems, simplified_shape,
+        {{&simplified_src1_strides, src1_offset},
+         {&simplified_src2_strides, src2_offset},
+         {&simplified_dst_strides, dst_offset}});
+
     sycl::event strided_fn_ev = strided_fn(
-        exec_q, src_nelems, nd, shape_strides, src1_data, src1_offset,
-        src2_data, src2_offset, dst_data, dst_offset, depends, {copy_shape_ev});
+        exec_q, src_nelems, nd, shape_strides, use_int32_indexing, src1_data,
+        src1_offset, src2_data, src2_offset, dst_data, dst_offset,
+        prefetch_deps, {copy_shape_ev});
 
     // async free of shape_strides temporary
     auto ctx = exec_q.get_context();
@@ -556,6 +612,114 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
         strided_fn_ev);
 }
 
+/*! @brief Evaluates binary function of contiguous array `src` and Python
+    scalar `scalar` of data type `scalar_dtype`, which is passed to the
+    kernel by value.
+
+    If `scalar_is_first` is true, computes dst = op(scalar, src), otherwise
+    computes dst = op(src, scalar). Arrays `src` and `dst` must have the same
+    shape and be either both C-contiguous or both F-contiguous.
+ */
+template <typename output_typesT, typename contig_scalar_dispatchT>
+std::pair<sycl::event, sycl::event> py_binary_scalar_ufunc(
+    dpctl::tensor::usm_ndarray src,
+    py::object scalar,
+    py::dtype scalar_dtype,
+    bool scalar_is_first,
+    dpctl::tensor::usm_ndarray dst,
+    sycl::queue exec_q,
+    const std::vector<sycl::event> depends,
+    //
+    const output_typesT &output_type_table,
+    const contig_scalar_dispatchT &contig_scalar_dispatch_table)
+{
+    if (!dst.is_writable()) {
+        throw py::value_error("Output array is read-only.");
+    }
+
+    auto array_types = td_ns::usm_ndarray_types();
+    int src_typeid = array_types.typenum_to_lookup_id(src.get_typenum());
+    int scalar_typeid = array_types.typenum_to_lookup_id(scalar_dtype.num());
+    int dst_typeid = array_types.typenum_to_lookup_id(dst.get_typenum());
+
+    int arg1_typeid = (scalar_is_first) ? scalar_typeid : src_typeid;
+    int arg2_typeid = (scalar_is_first) ? src_typeid : scalar_typeid;
+
+    int output_typeid = output_type_table[arg1_typeid][arg2_typeid];
+
+    if (output_typeid != dst_typeid) {
+        throw py::value_error(
+            "Destination array has unexpected elemental data type.");
+    }
+
+    // check that queues are compatible
+    if (!dpctl::utils::queues_are_compatible(exec_q, {src, dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    int dst_nd = dst.get_ndim();
+    if (dst_nd != src.get_ndim()) {
+        throw py::value_error("Array dimensions are not the same.");
+    }
+
+    const py::ssize_t *src_shape = src.get_shape_raw();
+    const py::ssize_t *dst_shape = dst.get_shape_raw();
+    bool shapes_equal(true);
+    size_t src_nelems(1);
+
+    for (int i = 0; i < dst_nd; ++i) {
+        src_nelems *= static_cast<size_t>(src_shape[i]);
+        shapes_equal = shapes_equal && (src_shape[i] == dst_shape[i]);
+    }
+    if (!shapes_equal) {
+        throw py::value_error("Array shapes are not the same.");
+    }
+
+    // if nelems is zero, return
+    if (src_nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    bool both_c_contig = (src.is_c_contiguous() && dst.is_c_contiguous());
+    bool both_f_contig = (src.is_f_contiguous() && dst.is_f_contiguous());
+    if (!both_c_contig && !both_f_contig) {
+        throw py::value_error("Arrays must be contiguous with the same layout");
+    }
+
+    // check memory overlap
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    auto const &same_logical_tensors =
+        dpctl::tensor::overlap::SameLogicalTensors();
+    if (overlap(src, dst) && !same_logical_tensors(src, dst)) {
+        throw py::value_error("Arrays index overlapping segments of memory");
+    }
+
+    // migrate USM-shared operands to the device ahead of kernels
+    const std::vector<sycl::event> prefetch_deps =
+        dpctl::tensor::usm_prefetch::prefetch_shared_operands(
+            exec_q, {src, dst}, depends);
+
+    auto contig_scalar_fn =
+        contig_scalar_dispatch_table[arg1_typeid][arg2_typeid];
+
+    if (contig_scalar_fn == nullptr) {
+        throw std::runtime_error(
+            "Contiguous implementation with scalar operand is missing for "
+            "arg1_typeid=" +
+            std::to_string(arg1_typeid) +
+            " and arg2_typeid=" + std::to_string(arg2_typeid));
+    }
+
+    sycl::event comp_ev = contig_scalar_fn(exec_q, src_nelems, src.get_data(),
+                                           0, scalar, scalar_is_first,
+                                           dst.get_data(), 0, prefetch_deps);
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {src, dst}, {comp_ev});
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
 template <typename output_typesT>
 py::object py_binary_ufunc_result_type(py::dtype input1_dtype,
                                        py::dtype input2_dtype,
@@ -679,9 +843,17 @@ py_binary_inplace_ufunc(dpctl::tensor::usm_ndarray lhs,
 
     // check memory overlap
     auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
-    if (overlap(rhs, lhs)) {
+    auto const &same_logical_tensors =
+        dpctl::tensor::overlap::SameLogicalTensors();
+    if (overlap(rhs, lhs) && !same_logical_tensors(rhs, lhs)) {
         throw py::value_error("Arrays index overlapping segments of memory");
     }
+
+    // migrate USM-shared operands to the device ahead of kernels
+    const std::vector<sycl::event> prefetch_deps =
+        dpctl::tensor::usm_prefetch::prefetch_shared_operands(
+            exec_q, {rhs, lhs}, depends);
+
     // check memory overlap
     const char *rhs_data = rhs.get_data();
     char *lhs_data = lhs.get_data();
@@ -702,7 +874,7 @@ py_binary_inplace_ufunc(dpctl::tensor::usm_ndarray lhs,
 
         if (contig_fn != nullptr) {
             auto comp_ev = contig_fn(exec_q, rhs_nelems, rhs_data, 0, lhs_data,
-                                     0, depends);
+                                     0, prefetch_deps);
             sycl::event ht_ev =
                 dpctl::utils::keep_args_alive(exec_q, {rhs, lhs}, {comp_ev});
 
@@ -745,7 +917,7 @@ py_binary_inplace_ufunc(dpctl::tensor::usm_ndarray lhs,
             if (contig_fn != nullptr) {
                 auto comp_ev =
                     contig_fn(exec_q, rhs_nelems, rhs_data, rhs_offset,
-                              lhs_data, lhs_offset, depends);
+                              lhs_data, lhs_offset, prefetch_deps);
                 sycl::event ht_ev = dpctl::utils::keep_args_alive(
                     exec_q, {rhs, lhs}, {comp_ev});
 
@@ -768,7 +940,7 @@ py_binary_inplace_ufunc(dpctl::tensor::usm_ndarray lhs,
                     size_t n1 = simplified_shape[0];
                     sycl::event comp_ev = row_matrix_broadcast_fn(
                         exec_q, host_tasks, n0, n1, rhs_data, rhs_offset,
-                        lhs_data, lhs_offset, depends);
+                        lhs_data, lhs_offset, prefetch_deps);
 
                     return std::make_pair(dpctl::utils::keep_args_alive(
                                               exec_q, {lhs, rhs}, host_tasks),
@@ -789,9 +961,10 @@ py_binary_inplace_ufunc(dpctl::tensor::usm_ndarray lhs,
     }
 
     using dpctl::tensor::offset_utils::device_allocate_and_pack;
+    using dpctl::tensor::offset_utils::fast_divisors;
     const auto &ptr_sz_event_triple_ = device_allocate_and_pack<py::ssize_t>(
         exec_q, host_tasks, simplified_shape, simplified_rhs_strides,
-        simplified_lhs_strides);
+        simplified_lhs_strides, fast_divisors(simplified_shape));
 
     py::ssize_t *shape_strides = std::get<0>(ptr_sz_event_triple_);
     sycl::event copy_shape_ev = std::get<2>(ptr_sz_event_triple_);
@@ -800,9 +973,16 @@ py_binary_inplace_ufunc(dpctl::tensor::usm_ndarray lhs,
         throw std::runtime_error("Unabled to allocate device memory");
     }
 
+    using dpctl::tensor::offset_utils::offsets_fit_int32;
+    const bool use_int32_indexing = offsets_fit_int32(
+        rhs_nelems, simplified_shape,
+        {{&simplified_rhs_strides, rhs_offset},
+         {&simplified_lhs_strides, lhs_offset}});
+
     sycl::event strided_fn_ev =
-        strided_fn(exec_q, rhs_nelems, nd, shape_strides, rhs_data, rhs_offset,
-                   lhs_data, lhs_offset, depends, {copy_shape_ev});
+        strided_fn(exec_q, rhs_nelems, nd, shape_strides, use_int32_indexing,
+                   rhs_data, rhs_offset, lhs_data, lhs_offset, prefetch_deps,
+                   {copy_shape_ev});
 
     // async free of shape_strides temporary
     auto ctx = exec_q.get_context();
@@ -31,10 +31,12 @@
 #include <vector>
 
 #include "kernels/constructors.hpp"
+#include "utils/offset_utils.hpp"
 #include "utils/type_dispatch.hpp"
 #include "utils/type_utils.hpp"
 
 #include "full_ctor.hpp"
+#include "simplify_iteration_space.hpp"
 
 namespace py = pybind11;
 namespace td_ns = dpctl::tensor::type_dispatch;
@@ -53,6 +55,10 @@ using dpctl::tensor::kernels::constructors::full_contig_fn_ptr_t;
 
 static full_contig_fn_ptr_t full_contig_dispatch_vector[td_ns::num_types];
 
+using dpctl::tensor::kernels::constructors::full_strided_fn_ptr_t;
+
+static full_strided_fn_ptr_t full_strided_dispatch_vector[td_ns::num_types];
+
 std::pair<sycl::event, sycl::event>
 usm_ndarray_full(py::object py_value,
                  dpctl::tensor::usm_ndarray dst,
@@ -91,10 +97,76 @@ usm_ndarray_full(py::object py_value,
             keep_args_alive(exec_q, {dst}, {full_contig_event}),
             full_contig_event);
     }
-    else {
-        throw std::runtime_error(
-            "Only population of contiguous usm_ndarray objects is supported.");
+
+    int nd = dst.get_ndim();
+    const py::ssize_t *shape_ptr = dst.get_shape_raw();
+    auto const &strides = dst.get_strides_vector();
+
+    using shT = std::vector<py::ssize_t>;
+    shT simplified_shape;
+    shT simplified_strides;
+    py::ssize_t dst_offset(0);
+
+    simplify_iteration_space_1(nd, shape_ptr, strides,
+                               // output
+                               simplified_shape, simplified_strides,
+                               dst_offset);
+
+    if (nd == 1 && simplified_strides[0] == 1) {
+        auto fn = full_contig_dispatch_vector[dst_typeid];
+
+        int dst_elemsize = dst.get_elemsize();
+        sycl::event full_contig_event =
+            fn(exec_q, static_cast<size_t>(dst_nelems), py_value,
+               dst_data + dst_offset * dst_elemsize, depends);
+
+        return std::make_pair(
+            keep_args_alive(exec_q, {dst}, {full_contig_event}),
+            full_contig_event);
+    }
+
+    auto fn = full_strided_dispatch_vector[dst_typeid];
+
+    std::vector<sycl::event> host_task_events;
+    host_task_events.reserve(2);
+
+    using dpctl::tensor::offset_utils::device_allocate_and_pack;
+    const auto &ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
+        exec_q, host_task_events, simplified_shape, simplified_strides);
+    py::ssize_t *shape_strides = std::get<0>(ptr_size_event_tuple);
+    if (shape_strides == nullptr) {
+        throw std::runtime_error("Unable to allocate device memory");
+    }
+    sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
+
+    std::vector<sycl::event> all_deps;
+    all_deps.reserve(depends.size() + 1);
+    all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+    all_deps.push_back(copy_shape_ev);
+
+    sycl::event full_strided_event;
+    try {
+        full_strided_event =
+            fn(exec_q, nd, static_cast<size_t>(dst_nelems), shape_strides,
+               dst_offset, py_value, dst_data, all_deps);
+    } catch (...) {
+        // the value could not be converted, free metadata once it is copied
+        copy_shape_ev.wait();
+        sycl::free(shape_strides, exec_q);
+        throw;
     }
+
+    // async free of shape_strides temporary
+    auto ctx = exec_q.get_context();
+    auto temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(full_strided_event);
+        cgh.host_task(
+            [ctx, shape_strides]() { sycl::free(shape_strides, ctx); });
+    });
+    host_task_events.push_back(temporaries_cleanup_ev);
+
+    return std::make_pair(keep_args_alive(exec_q, {dst}, host_task_events),
+                          full_strided_event);
 }
 
 void init_full_ctor_dispatch_vectors(void)
@@ -106,6 +178,11 @@ void init_full_ctor_dispatch_vectors(void)
         dvb;
     dvb.populate_dispatch_vector(full_contig_dispatch_vector);
 
+    using dpctl::tensor::kernels::constructors::FullStridedFactory;
+    DispatchVectorBuilder<full_strided_fn_ptr_t, FullStridedFactory, num_types>
+        dvb_strided;
+    dvb_strided.populate_dispatch_vector(full_strided_dispatch_vector);
+
     return;
 }
 
@@ -0,0 +1,363 @@
+//===-- ------------ Implementation of _tensor_impl module  ----*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===--------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_impl extensions,
+/// specifically functions for autotuning of kernel launch parameters.
+//===--------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "dpctl4pybind11.hpp"
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "kernels/elementwise_functions/add.hpp"
+#include "kernels/elementwise_functions/positive.hpp"
+#include "kernels/reductions.hpp"
+#include "launch_params_tuning.hpp"
+#include "utils/launch_params.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace lp_ns = dpctl::tensor::launch_params;
+
+namespace
+{
+
+// Number of bytes of each array processed by a tuning run, large enough to
+// saturate memory bandwidth of the device
+constexpr size_t tuning_nbytes = size_t(16) << 20;
+constexpr int tuning_reps = 3;
+
+/*! @brief Owner of USM device allocation used by tuning runs */
+class tuning_buffer
+{
+public:
+    tuning_buffer(sycl::queue &q, size_t nbytes) : q_(q)
+    {
+        ptr_ = sycl::malloc_device<char>(nbytes, q_);
+        if (ptr_ == nullptr) {
+            throw std::runtime_error("Unable to allocate device memory");
+        }
+        q_.fill<char>(ptr_, char(0), nbytes).wait();
+    }
+
+    tuning_buffer(const tuning_buffer &) = delete;
+    tuning_buffer &operator=(const tuning_buffer &) = delete;
+
+    ~tuning_buffer()
+    {
+        sycl::free(ptr_, q_);
+    }
+
+    char *get() const
+    {
+        return ptr_;
+    }
+
+private:
+    sycl::queue q_;
+    char *ptr_ = nullptr;
+};
+
+/*! @brief Smallest duration of `tuning_reps` executions of `submit_fn` after a
+ * warm-up execution, which triggers JIT compilation */
+template <typename SubmitFnT> double time_submission(SubmitFnT &&submit_fn)
+{
+    submit_fn().wait();
+
+    double best = std::numeric_limits<double>::max();
+    for (int rep = 0; rep < tuning_reps; ++rep) {
+        auto start = std::chrono::steady_clock::now();
+        submit_fn().wait();
+        auto end = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed = end - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+/*! @brief Times submission of kernels with each candidate parameters in turn,
+ * and records the fastest ones. Candidates are passed to `submit_fn`
+ * directly, so that kernels submitted meanwhile by other threads do not
+ * use them. */
+template <typename SubmitFnT>
+lp_ns::launch_params_t
+select_best(sycl::queue &q,
+            lp_ns::kernel_family f,
+            size_t type_size,
+            const std::vector<lp_ns::launch_params_t> &candidates,
+            SubmitFnT &&submit_fn)
+{
+    auto &registry = lp_ns::LaunchParamsRegistry::get();
+    const sycl::device &d = q.get_device();
+
+    lp_ns::launch_params_t best_params = lp_ns::default_launch_params(d, f);
+    double best_time = std::numeric_limits<double>::max();
+    for (const auto &p : candidates) {
+        double t = time_submission([&]() { return submit_fn(p); });
+        if (t < best_time) {
+            best_time = t;
+            best_params = p;
+        }
+    }
+    q.wait();
+    registry.set(d, f, type_size, best_params);
+    return best_params;
+}
+
+std::vector<lp_ns::launch_params_t>
+elementwise_candidates(const sycl::device &d)
+{
+    const size_t max_wg = d.get_info<sycl::info::device::max_work_group_size>();
+
+    std::vector<lp_ns::launch_params_t> candidates;
+    for (size_t lws : {32, 64, 128, 256, 512, 1024}) {
+        if (lws <= max_wg) {
+            candidates.push_back(lp_ns::launch_params_t{lws, 1});
+        }
+    }
+    return candidates;
+}
+
+std::vector<lp_ns::launch_params_t> reduction_candidates(const sycl::device &d)
+{
+    const size_t max_wg = d.get_info<sycl::info::device::max_work_group_size>();
+    const size_t max_sg = lp_ns::max_sub_group_size(d);
+
+    std::vector<lp_ns::launch_params_t> candidates;
+    for (size_t sg_multiple : {1, 2, 4, 8}) {
+        if (sg_multiple * max_sg > max_wg) {
+            break;
+        }
+        for (size_t items_per_wi : {2, 4, 8, 16}) {
+            candidates.push_back(
+                lp_ns::launch_params_t{sg_multiple * max_sg, items_per_wi});
+        }
+    }
+    return candidates;
+}
+
+template <typename A, typename R, unsigned int vs, unsigned int nv>
+class tuning_unary_contig_krn;
+
+template <typename A1,
+          typename A2,
+          typename R,
+          unsigned int vs,
+          unsigned int nv>
+class tuning_binary_contig_krn;
+
+template <typename T> void tune_elementwise(sycl::queue &q)
+{
+    const sycl::device &d = q.get_device();
+    const size_t n = tuning_nbytes / sizeof(T);
+
+    tuning_buffer x1(q, n * sizeof(T));
+    tuning_buffer x2(q, n * sizeof(T));
+    tuning_buffer res(q, n * sizeof(T));
+
+    const auto &candidates = elementwise_candidates(d);
+
+    namespace ew_cmn_ns = dpctl::tensor::kernels::elementwise_common;
+    using dpctl::tensor::kernels::positive::PositiveContigFunctor;
+    using dpctl::tensor::kernels::positive::PositiveOutputType;
+    select_best(q, lp_ns::kernel_family::unary_contig, sizeof(T), candidates,
+                [&](const lp_ns::launch_params_t &p) {
+                    return ew_cmn_ns::unary_contig_with_params<
+                        T, PositiveOutputType, PositiveContigFunctor,
+                        tuning_unary_contig_krn>(q, p, n, x1.get(), res.get(),
+                                                 {});
+                });
+
+    using dpctl::tensor::kernels::add::AddContigFunctor;
+    using dpctl::tensor::kernels::add::AddOutputType;
+    select_best(q, lp_ns::kernel_family::binary_contig, sizeof(T), candidates,
+                [&](const lp_ns::launch_params_t &p) {
+                    return ew_cmn_ns::binary_contig_with_params<
+                        T, T, AddOutputType, AddContigFunctor,
+                        tuning_binary_contig_krn>(q, p, n, x1.get(), 0,
+                                                  x2.get(), 0, res.get(), 0,
+                                                  {});
+                });
+}
+
+template <typename T> void tune_reductions(sycl::queue &q, bool use_atomics)
+{
+    const sycl::device &d = q.get_device();
+    const size_t n = tuning_nbytes / sizeof(T);
+
+    tuning_buffer x(q, n * sizeof(T));
+    tuning_buffer res(q, sizeof(T));
+
+    // reduction of a vector, packed as expected by strided implementations
+    const std::vector<py::ssize_t> packed_host = {
+        1, 0, 0, static_cast<py::ssize_t>(n), 1};
+    tuning_buffer packed(q, packed_host.size() * sizeof(py::ssize_t));
+    q.copy<py::ssize_t>(packed_host.data(),
+                        reinterpret_cast<py::ssize_t *>(packed.get()),
+                        packed_host.size())
+        .wait();
+    const py::ssize_t *iter_shape_strides =
+        reinterpret_cast<const py::ssize_t *>(packed.get());
+    const py::ssize_t *red_shape_stride = iter_shape_strides + 3;
+
+    const auto &candidates = reduction_candidates(d);
+    constexpr size_t iter_nelems = 1;
+
+    if (use_atomics) {
+        using dpctl::tensor::kernels::
+            sum_reduction_over_group_with_atomics_contig_with_params;
+        auto reduce_fn =
+            sum_reduction_over_group_with_atomics_contig_with_params<T, T>;
+        select_best(q, lp_ns::kernel_family::reduction_contig, sizeof(T),
+                    candidates, [&](const lp_ns::launch_params_t &p) {
+                        return reduce_fn(q, p, iter_nelems, n, x.get(),
+                                         res.get(), 0, 0, 0, {});
+                    });
+    }
+
+    using dpctl::tensor::kernels::
+        sum_reduction_over_group_temps_strided_with_params;
+    select_best(q, lp_ns::kernel_family::reduction_strided, sizeof(T),
+                candidates, [&](const lp_ns::launch_params_t &p) {
+                    return sum_reduction_over_group_temps_strided_with_params<
+                        T, T>(q, p, iter_nelems, n, x.get(), res.get(), 1,
+                              iter_shape_strides, 0, 0, 1, red_shape_stride, 0,
+                              {});
+                });
+}
+
+/*! @brief Finds launch parameters for all kernel families and sizes of
+ * data types supported by the device of the queue */
+void tune_device(sycl::queue &q)
+{
+    const sycl::device &d = q.get_device();
+    const bool fp64 = d.has(sycl::aspect::fp64);
+
+    tune_elementwise<std::int8_t>(q);
+    tune_elementwise<std::int16_t>(q);
+    tune_elementwise<float>(q);
+    tune_elementwise<std::int64_t>(q);
+    if (fp64) {
+        tune_elementwise<std::complex<double>>(q);
+    }
+
+    tune_reductions<float>(q, true);
+    if (fp64) {
+        tune_reductions<double>(q, d.has(sycl::aspect::atomic64));
+    }
+    else {
+        tune_reductions<std::int64_t>(q, d.has(sycl::aspect::atomic64));
+    }
+}
+
+py::list launch_params_entries(const sycl::device &d)
+{
+    py::list res;
+    for (const auto &e : lp_ns::LaunchParamsRegistry::get().entries(d)) {
+        const lp_ns::launch_params_t &p = std::get<2>(e);
+        res.append(py::make_tuple(lp_ns::kernel_family_name(std::get<0>(e)),
+                                  std::get<1>(e), p.wg_size, p.items_per_wi));
+    }
+    return res;
+}
+
+} // end of anonymous namespace
+
+py::list py_autotune_launch_params(sycl::queue q, bool persist)
+{
+    {
+        py::gil_scoped_release release;
+        // tuning waits for its kernels, use a queue of its own so that work
+        // submitted to the queue of the caller is not waited upon
+        sycl::queue tuning_q(q.get_context(), q.get_device());
+        tune_device(tuning_q);
+    }
+
+    if (persist && !lp_ns::LaunchParamsRegistry::get().save()) {
+        throw std::runtime_error("Could not write cache file " +
+                                 lp_ns::cache_file_path());
+    }
+
+    return launch_params_entries(q.get_device());
+}
+
+py::list py_get_launch_params(sycl::queue q)
+{
+    return launch_params_entries(q.get_device());
+}
+
+void py_reset_launch_params(sycl::queue q, bool persist)
+{
+    auto &registry = lp_ns::LaunchParamsRegistry::get();
+    registry.reset(q.get_device());
+    if (persist && !registry.save()) {
+        throw std::runtime_error("Could not write cache file " +
+                                 lp_ns::cache_file_path());
+    }
+}
+
+void init_launch_params_tuning(py::module_ m)
+{
+    // used when DPCTL_TENSOR_AUTOTUNE=1 for devices absent in the cache,
+    // called on first look-up of parameters of the device, with a queue
+    // created for tuning
+    lp_ns::LaunchParamsRegistry::get().set_tuner([](sycl::queue &q) {
+        tune_device(q);
+        lp_ns::LaunchParamsRegistry::get().save();
+    });
+
+    m.def("_autotune_launch_params", &py_autotune_launch_params,
+          "Benchmarks candidate launch parameters of kernels on the device "
+          "of the queue, records the fastest ones, and optionally persists "
+          "them in the cache file. Returns list of tuples "
+          "(kernel_family, type_size, wg_size, items_per_wi).",
+          py::arg("sycl_queue"), py::arg("persist") = true);
+    m.def("_get_launch_params", &py_get_launch_params,
+          "Returns list of tuples (kernel_family, type_size, wg_size, "
+          "items_per_wi) of launch parameters recorded for the device of "
+          "the queue.",
+          py::arg("sycl_queue"));
+    m.def("_reset_launch_params", &py_reset_launch_params,
+          "Discards launch parameters recorded for the device of the queue, "
+          "so that default values are used.",
+          py::arg("sycl_queue"), py::arg("persist") = true);
+    m.def("_launch_params_cache_file", &lp_ns::cache_file_path,
+          "Returns path of the cache file with tuned launch parameters");
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -0,0 +1,444 @@
+//===-- ------------ Implementation of _tensor_impl module  ----*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===--------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_impl extensions,
+/// specifically functions for linear algebra operations.
+//===--------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "dpctl4pybind11.hpp"
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "elementwise_functions.hpp"
+#include "kernels/linalg_functions/dot_product.hpp"
+#include "kernels/linalg_functions/gemm.hpp"
+#include "linalg_functions.hpp"
+#include "simplify_iteration_space.hpp"
+#include "utils/memory_overlap.hpp"
+#include "utils/offset_utils.hpp"
+#include "utils/type_dispatch.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+namespace impl
+{
+
+namespace linalg_ns = dpctl::tensor::kernels::linalg;
+
+static int dot_output_id_table[td_ns::num_types][td_ns::num_types];
+
+using linalg_ns::gemm_batch_impl_fn_ptr_t;
+static gemm_batch_impl_fn_ptr_t gemm_batch_dispatch_table[td_ns::num_types]
+                                                         [td_ns::num_types];
+
+using linalg_ns::dot_product_impl_fn_ptr_t;
+static dot_product_impl_fn_ptr_t dot_product_dispatch_table[td_ns::num_types]
+                                                           [td_ns::num_types];
+
+void populate_linalg_dispatch_tables(void)
+{
+    using namespace td_ns;
+
+    using linalg_ns::DotProductTypeMapFactory;
+    DispatchTableBuilder<int, DotProductTypeMapFactory, num_types> dtb1;
+    dtb1.populate_dispatch_table(dot_output_id_table);
+
+    using linalg_ns::GemmBatchFactory;
+    DispatchTableBuilder<gemm_batch_impl_fn_ptr_t, GemmBatchFactory, num_types>
+        dtb2;
+    dtb2.populate_dispatch_table(gemm_batch_dispatch_table);
+
+    using linalg_ns::DotProductFactory;
+    DispatchTableBuilder<dot_product_impl_fn_ptr_t, DotProductFactory,
+                         num_types>
+        dtb3;
+    dtb3.populate_dispatch_table(dot_product_dispatch_table);
+}
+
+} // namespace impl
+
+namespace
+{
+
+/*! @brief Validates data types, queues and output of a linear algebra call,
+ *  and returns type ids of inputs. */
+std::pair<int, int> validate_linalg_arrays(dpctl::tensor::usm_ndarray x1,
+                                           dpctl::tensor::usm_ndarray x2,
+                                           dpctl::tensor::usm_ndarray dst,
+                                           sycl::queue exec_q,
+                                           size_t dst_nelems)
+{
+    if (!dst.is_writable()) {
+        throw py::value_error("Output array is read-only.");
+    }
+
+    auto array_types = td_ns::usm_ndarray_types();
+    int x1_typeid = array_types.typenum_to_lookup_id(x1.get_typenum());
+    int x2_typeid = array_types.typenum_to_lookup_id(x2.get_typenum());
+    int dst_typeid = array_types.typenum_to_lookup_id(dst.get_typenum());
+
+    int output_typeid = impl::dot_output_id_table[x1_typeid][x2_typeid];
+    if (output_typeid != dst_typeid) {
+        throw py::value_error(
+            "Destination array has unexpected elemental data type.");
+    }
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {x1, x2, dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    // destination must be ample enough to accomodate all elements
+    if (dst_nelems > 0) {
+        auto dst_offsets = dst.get_minmax_offsets();
+        size_t range =
+            static_cast<size_t>(dst_offsets.second - dst_offsets.first);
+        if (range + 1 < dst_nelems) {
+            throw py::value_error(
+                "Destination array can not accomodate all the "
+                "elements of the result.");
+        }
+    }
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(x1, dst) || overlap(x2, dst)) {
+        throw py::value_error("Arrays index overlapping segments of memory");
+    }
+
+    return std::make_pair(x1_typeid, x2_typeid);
+}
+
+/*! @brief Simplifies batch dimensions of three arrays. Zero-dimensional
+ *  batch is represented as a one-dimensional batch of a single element. */
+void simplify_batch_space(int &batch_nd,
+                          const py::ssize_t *batch_shape_ptr,
+                          std::vector<py::ssize_t> const &x1_batch_strides,
+                          std::vector<py::ssize_t> const &x2_batch_strides,
+                          std::vector<py::ssize_t> const &dst_batch_strides,
+                          // output
+                          std::vector<py::ssize_t> &simplified_batch_shape,
+                          std::vector<py::ssize_t> &simplified_x1_strides,
+                          std::vector<py::ssize_t> &simplified_x2_strides,
+                          std::vector<py::ssize_t> &simplified_dst_strides,
+                          py::ssize_t &x1_offset,
+                          py::ssize_t &x2_offset,
+                          py::ssize_t &dst_offset)
+{
+    if (batch_nd == 0) {
+        batch_nd = 1;
+        simplified_batch_shape.push_back(1);
+        simplified_x1_strides.push_back(0);
+        simplified_x2_strides.push_back(0);
+        simplified_dst_strides.push_back(0);
+    }
+    else {
+        simplify_iteration_space_3(
+            batch_nd, batch_shape_ptr, x1_batch_strides, x2_batch_strides,
+            dst_batch_strides,
+            // output
+            simplified_batch_shape, simplified_x1_strides,
+            simplified_x2_strides, simplified_dst_strides, x1_offset,
+            x2_offset, dst_offset);
+    }
+}
+
+} // end of anonymous namespace
+
+/*! @brief Computes dst = x1 @ x2 for stacks of matrices.
+
+  Arrays must have the same number of dimensions nd >= 2, with shapes
+  (..., n, k), (..., k, m) and (..., n, m). Batch dimensions are expected
+  to have been broadcast by the caller.
+ */
+std::pair<sycl::event, sycl::event>
+py_matmul(dpctl::tensor::usm_ndarray x1,
+          dpctl::tensor::usm_ndarray x2,
+          dpctl::tensor::usm_ndarray dst,
+          sycl::queue exec_q,
+          const std::vector<sycl::event> &depends)
+{
+    int nd = dst.get_ndim();
+    if (nd < 2 || x1.get_ndim() != nd || x2.get_ndim() != nd) {
+        throw py::value_error("Arrays must have the same number of "
+                              "dimensions, which is at least 2.");
+    }
+
+    const py::ssize_t *x1_shape = x1.get_shape_raw();
+    const py::ssize_t *x2_shape = x2.get_shape_raw();
+    const py::ssize_t *dst_shape = dst.get_shape_raw();
+
+    int batch_nd = nd - 2;
+    bool shapes_ok = true;
+    size_t batch_nelems(1);
+    for (int i = 0; i < batch_nd; ++i) {
+        batch_nelems *= static_cast<size_t>(dst_shape[i]);
+        shapes_ok = shapes_ok && (x1_shape[i] == dst_shape[i]) &&
+                    (x2_shape[i] == dst_shape[i]);
+    }
+    size_t n = static_cast<size_t>(x1_shape[nd - 2]);
+    size_t k = static_cast<size_t>(x1_shape[nd - 1]);
+    size_t m = static_cast<size_t>(x2_shape[nd - 1]);
+    shapes_ok = shapes_ok && (static_cast<size_t>(x2_shape[nd - 2]) == k) &&
+                (static_cast<size_t>(dst_shape[nd - 2]) == n) &&
+                (static_cast<size_t>(dst_shape[nd - 1]) == m);
+    if (!shapes_ok) {
+        throw py::value_error("Array shapes are not compatible for "
+                              "matrix multiplication.");
+    }
+
+    size_t dst_nelems = batch_nelems * n * m;
+    auto typeids = validate_linalg_arrays(x1, x2, dst, exec_q, dst_nelems);
+
+    if (dst_nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    auto fn = impl::gemm_batch_dispatch_table[typeids.first][typeids.second];
+    if (fn == nullptr) {
+        throw std::runtime_error("Matrix multiplication is not implemented "
+                                 "for given data types");
+    }
+
+    auto const &x1_strides = x1.get_strides_vector();
+    auto const &x2_strides = x2.get_strides_vector();
+    auto const &dst_strides = dst.get_strides_vector();
+
+    using shT = std::vector<py::ssize_t>;
+    shT x1_batch_strides(std::begin(x1_strides),
+                         std::begin(x1_strides) + batch_nd);
+    shT x2_batch_strides(std::begin(x2_strides),
+                         std::begin(x2_strides) + batch_nd);
+    shT dst_batch_strides(std::begin(dst_strides),
+                          std::begin(dst_strides) + batch_nd);
+
+    shT simplified_batch_shape;
+    shT simplified_x1_batch_strides;
+    shT simplified_x2_batch_strides;
+    shT simplified_dst_batch_strides;
+    py::ssize_t x1_batch_offset(0);
+    py::ssize_t x2_batch_offset(0);
+    py::ssize_t dst_batch_offset(0);
+
+    simplify_batch_space(batch_nd, dst_shape, x1_batch_strides,
+                         x2_batch_strides, dst_batch_strides,
+                         // output
+                         simplified_batch_shape, simplified_x1_batch_strides,
+                         simplified_x2_batch_strides,
+                         simplified_dst_batch_strides, x1_batch_offset,
+                         x2_batch_offset, dst_batch_offset);
+
+    std::vector<sycl::event> host_task_events;
+    host_task_events.reserve(2);
+
+    using dpctl::tensor::offset_utils::device_allocate_and_pack;
+    const auto &ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
+        exec_q, host_task_events, simplified_batch_shape,
+        simplified_x1_batch_strides, simplified_x2_batch_strides,
+        simplified_dst_batch_strides);
+    py::ssize_t *packed_shape_strides = std::get<0>(ptr_size_event_tuple);
+    if (packed_shape_strides == nullptr) {
+        throw std::runtime_error("Unable to allocate memory on device");
+    }
+    sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
+
+    std::vector<sycl::event> all_deps;
+    all_deps.reserve(depends.size() + 1);
+    all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+    all_deps.push_back(copy_shape_ev);
+
+    sycl::event gemm_ev =
+        fn(exec_q, x1.get_data(), x2.get_data(), dst.get_data(), batch_nelems,
+           n, k, m, batch_nd, packed_shape_strides, x1_batch_offset,
+           x2_batch_offset, dst_batch_offset, x1_strides[nd - 2],
+           x1_strides[nd - 1], x2_strides[nd - 2], x2_strides[nd - 1],
+           dst_strides[nd - 2], dst_strides[nd - 1], all_deps);
+
+    // async free of shape_strides temporary
+    auto ctx = exec_q.get_context();
+    sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(gemm_ev);
+        cgh.host_task([ctx, packed_shape_strides]() {
+            sycl::free(packed_shape_strides, ctx);
+        });
+    });
+    host_task_events.push_back(tmp_cleanup_ev);
+
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {x1, x2, dst}, host_task_events);
+
+    return std::make_pair(ht_ev, gemm_ev);
+}
+
+/*! @brief Computes dot products of x1 and x2 along their last axis.
+
+  Arrays x1 and x2 must have the same shape (..., k), and dst must have
+  shape (...). Batch dimensions are expected to have been broadcast by the
+  caller.
+ */
+std::pair<sycl::event, sycl::event>
+py_vecdot(dpctl::tensor::usm_ndarray x1,
+          dpctl::tensor::usm_ndarray x2,
+          dpctl::tensor::usm_ndarray dst,
+          sycl::queue exec_q,
+          const std::vector<sycl::event> &depends)
+{
+    int nd = x1.get_ndim();
+    if (nd < 1 || x2.get_ndim() != nd || dst.get_ndim() + 1 != nd) {
+        throw py::value_error("Input arrays must have the same number of "
+                              "dimensions, one more than destination array.");
+    }
+
+    const py::ssize_t *x1_shape = x1.get_shape_raw();
+    const py::ssize_t *x2_shape = x2.get_shape_raw();
+    const py::ssize_t *dst_shape = dst.get_shape_raw();
+
+    int batch_nd = nd - 1;
+    bool shapes_ok = (x1_shape[batch_nd] == x2_shape[batch_nd]);
+    size_t batch_nelems(1);
+    for (int i = 0; i < batch_nd; ++i) {
+        batch_nelems *= static_cast<size_t>(dst_shape[i]);
+        shapes_ok = shapes_ok && (x1_shape[i] == dst_shape[i]) &&
+                    (x2_shape[i] == dst_shape[i]);
+    }
+    if (!shapes_ok) {
+        throw py::value_error("Array shapes are not compatible.");
+    }
+    size_t k = static_cast<size_t>(x1_shape[batch_nd]);
+
+    auto typeids = validate_linalg_arrays(x1, x2, dst, exec_q, batch_nelems);
+
+    if (batch_nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    auto fn = impl::dot_product_dispatch_table[typeids.first][typeids.second];
+    if (fn == nullptr) {
+        throw std::runtime_error("Dot product is not implemented "
+                                 "for given data types");
+    }
+
+    auto const &x1_strides = x1.get_strides_vector();
+    auto const &x2_strides = x2.get_strides_vector();
+    auto const &dst_strides = dst.get_strides_vector();
+
+    using shT = std::vector<py::ssize_t>;
+    shT x1_batch_strides(std::begin(x1_strides),
+                         std::begin(x1_strides) + batch_nd);
+    shT x2_batch_strides(std::begin(x2_strides),
+                         std::begin(x2_strides) + batch_nd);
+    shT const &dst_batch_strides = dst_strides;
+
+    shT simplified_batch_shape;
+    shT simplified_x1_batch_strides;
+    shT simplified_x2_batch_strides;
+    shT simplified_dst_batch_strides;
+    py::ssize_t x1_batch_offset(0);
+    py::ssize_t x2_batch_offset(0);
+    py::ssize_t dst_batch_offset(0);
+
+    simplify_batch_space(batch_nd, dst_shape, x1_batch_strides,
+                         x2_batch_strides, dst_batch_strides,
+                         // output
+                         simplified_batch_shape, simplified_x1_batch_strides,
+                         simplified_x2_batch_strides,
+                         simplified_dst_batch_strides, x1_batch_offset,
+                         x2_batch_offset, dst_batch_offset);
+
+    std::vector<sycl::event> host_task_events;
+    host_task_events.reserve(2);
+
+    using dpctl::tensor::offset_utils::device_allocate_and_pack;
+    const auto &ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
+        exec_q, host_task_events, simplified_batch_shape,
+        simplified_x1_batch_strides, simplified_x2_batch_strides,
+        simplified_dst_batch_strides);
+    py::ssize_t *packed_shape_strides = std::get<0>(ptr_size_event_tuple);
+    if (packed_shape_strides == nullptr) {
+        throw std::runtime_error("Unable to allocate memory on device");
+    }
+    sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
+
+    std::vector<sycl::event> all_deps;
+    all_deps.reserve(depends.size() + 1);
+    all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+    all_deps.push_back(copy_shape_ev);
+
+    sycl::event dot_ev =
+        fn(exec_q, batch_nelems, k, x1.get_data(), x2.get_data(),
+           dst.get_data(), batch_nd, packed_shape_strides, x1_batch_offset,
+           x2_batch_offset, dst_batch_offset, x1_strides[nd - 1],
+           x2_strides[nd - 1], all_deps);
+
+    // async free of shape_strides temporary
+    auto ctx = exec_q.get_context();
+    sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dot_ev);
+        cgh.host_task([ctx, packed_shape_strides]() {
+            sycl::free(packed_shape_strides, ctx);
+        });
+    });
+    host_task_events.push_back(tmp_cleanup_ev);
+
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {x1, x2, dst}, host_task_events);
+
+    return std::make_pair(ht_ev, dot_ev);
+}
+
+py::object py_dot_result_type(py::dtype dtype1, py::dtype dtype2)
+{
+    return py_binary_ufunc_result_type(dtype1, dtype2,
+                                       impl::dot_output_id_table);
+}
+
+void init_linalg_functions(py::module_ m)
+{
+    impl::populate_linalg_dispatch_tables();
+
+    m.def("_matmul", &py_matmul, "", py::arg("x1"), py::arg("x2"),
+          py::arg("dst"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
+    m.def("_vecdot", &py_vecdot, "", py::arg("x1"), py::arg("x2"),
+          py::arg("dst"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
+    m.def("_dot_result_type", &py_dot_result_type, "");
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -41,6 +41,7 @@
 #include "utils/memory_overlap.hpp"
 #include "utils/offset_utils.hpp"
 #include "utils/type_dispatch.hpp"
+#include "utils/usm_prefetch.hpp"
 
 namespace dpctl
 {
@@ -91,12 +92,29 @@ static sum_reduction_contig_impl_fn_ptr
     sum_over_axis_contig_atomic_dispatch_table[td_ns::num_types]
                                               [td_ns::num_types];
 
+using dpctl::tensor::kernels::sum_reduction_over_strided_axis_impl_fn_ptr;
+static sum_reduction_over_strided_axis_impl_fn_ptr
+    sum_over_strided_axis_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+static sum_reduction_strided_impl_fn_ptr
+    sum_over_axis_compensated_dispatch_table[td_ns::num_types]
+                                            [td_ns::num_types];
+static sum_reduction_contig_impl_fn_ptr
+    sum_over_axis_contig_compensated_dispatch_table[td_ns::num_types]
+                                                   [td_ns::num_types];
+
+/* Reduction over strided axis with contiguous iteration space is used if
+ * there are at least this many iteration elements, fewer of them would
+ * leave most work-items of a work-group idle */
+static constexpr size_t min_iter_nelems_for_strided_axis_reduction = 16;
+
 std::pair<sycl::event, sycl::event> py_sum_over_axis(
     dpctl::tensor::usm_ndarray src,
     int trailing_dims_to_reduce, // sum over this many trailing indexes
     dpctl::tensor::usm_ndarray dst,
     sycl::queue exec_q,
-    const std::vector<sycl::event> &depends)
+    const std::vector<sycl::event> &depends,
+    bool deterministic)
 {
     int src_nd = src.get_ndim();
     int iteration_nd = src_nd - trailing_dims_to_reduce;
@@ -154,6 +172,11 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
         }
     }
 
+    // migrate USM-shared operands to the device ahead of kernels
+    const std::vector<sycl::event> prefetch_deps =
+        dpctl::tensor::usm_prefetch::prefetch_shared_operands(
+            exec_q, {src, dst}, depends);
+
     int src_typenum = src.get_typenum();
     int dst_typenum = dst.get_typenum();
 
@@ -184,6 +207,12 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
     } break;
     }
 
+    // order in which atomic updates are applied is unspecified, so they
+    // can not be used when reproducible result is requested
+    if (deterministic) {
+        supports_atomics = false;
+    }
+
     // handle special case when both reduction and iteration are 1D contiguous
     // and can be done with atomics
     if (supports_atomics) {
@@ -207,7 +236,7 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
                        zero_offset, // iteration_src_offset
                        zero_offset, // iteration_dst_offset
                        zero_offset, // reduction_src_offset
-                       depends);
+                       prefetch_deps);
 
                 sycl::event keep_args_event = dpctl::utils::keep_args_alive(
                     exec_q, {src, dst}, {sum_over_axis_contig_ev});
@@ -286,7 +315,33 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
             sycl::event sum_over_axis_contig_ev =
                 fn(exec_q, iter_nelems, reduction_nelems, src.get_data(),
                    dst.get_data(), iteration_src_offset, iteration_dst_offset,
-                   reduction_src_offset, depends);
+                   reduction_src_offset, prefetch_deps);
+
+            sycl::event keep_args_event = dpctl::utils::keep_args_alive(
+                exec_q, {src, dst}, {sum_over_axis_contig_ev});
+
+            return std::make_pair(keep_args_event, sum_over_axis_contig_ev);
+        }
+    }
+
+    // deterministic sum over contiguous rows reads them with sub-group
+    // block loads
+    if (deterministic && (reduction_nd == 1) &&
+        (simplified_reduction_src_strides[0] == 1) && (iteration_nd == 1) &&
+        ((simplified_iteration_shape[0] == 1) ||
+         ((simplified_iteration_dst_strides[0] == 1) &&
+          (static_cast<size_t>(simplified_iteration_src_strides[0]) ==
+           reduction_nelems))))
+    {
+        auto fn = sum_over_axis_contig_compensated_dispatch_table[src_typeid]
+                                                                 [dst_typeid];
+        if (fn != nullptr) {
+            size_t iter_nelems = dst_nelems;
+
+            sycl::event sum_over_axis_contig_ev =
+                fn(exec_q, iter_nelems, reduction_nelems, src.get_data(),
+                   dst.get_data(), iteration_src_offset, iteration_dst_offset,
+                   reduction_src_offset, prefetch_deps);
 
             sycl::event keep_args_event = dpctl::utils::keep_args_alive(
                 exec_q, {src, dst}, {sum_over_axis_contig_ev});
@@ -295,10 +350,40 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
         }
     }
 
+    // reduction over a non-innermost axis, e.g. summing columns of
+    // a C-contiguous matrix, with work-items along contiguous dimension
+    if (!deterministic && (reduction_nd == 1) && (iteration_nd == 1) &&
+        (simplified_iteration_src_strides[0] == 1) &&
+        (simplified_iteration_dst_strides[0] == 1) &&
+        (simplified_reduction_src_strides[0] != 1) &&
+        (dst_nelems >= min_iter_nelems_for_strided_axis_reduction))
+    {
+        auto fn = sum_over_strided_axis_dispatch_table[src_typeid][dst_typeid];
+        if (fn != nullptr) {
+            size_t iter_nelems = dst_nelems;
+
+            sycl::event sum_over_axis_ev =
+                fn(exec_q, iter_nelems, reduction_nelems, src.get_data(),
+                   dst.get_data(), iteration_src_offset, iteration_dst_offset,
+                   reduction_src_offset, simplified_reduction_src_strides[0],
+                   prefetch_deps);
+
+            sycl::event keep_args_event = dpctl::utils::keep_args_alive(
+                exec_q, {src, dst}, {sum_over_axis_ev});
+
+            return std::make_pair(keep_args_event, sum_over_axis_ev);
+        }
+    }
+
     using dpctl::tensor::kernels::sum_reduction_strided_impl_fn_ptr;
     sum_reduction_strided_impl_fn_ptr fn = nullptr;
 
-    if (supports_atomics) {
+    if (deterministic) {
+        // compensated summation for inexact types, sums of other types are
+        // exact and are computed by the tree reduction using temporaries
+        fn = sum_over_axis_compensated_dispatch_table[src_typeid][dst_typeid];
+    }
+    else if (supports_atomics) {
         fn =
             sum_over_axis_strided_atomic_dispatch_table[src_typeid][dst_typeid];
     }
@@ -335,9 +420,9 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
         temp_allocation_ptr + 3 * simplified_iteration_shape.size();
 
     std::vector<sycl::event> all_deps;
-    all_deps.reserve(depends.size() + 1);
-    all_deps.resize(depends.size());
-    std::copy(depends.begin(), depends.end(), all_deps.begin());
+    all_deps.reserve(prefetch_deps.size() + 1);
+    all_deps.resize(prefetch_deps.size());
+    std::copy(prefetch_deps.begin(), prefetch_deps.end(), all_deps.begin());
     all_deps.push_back(copy_metadata_ev);
 
     auto comp_ev = fn(exec_q, dst_nelems, reduction_nelems, src.get_data(),
@@ -456,6 +541,25 @@ void populate_sum_over_axis_dispatch_table(void)
                          SumOverAxisAtomicContigFactory, num_types>
         dtb3;
     dtb3.populate_dispatch_table(sum_over_axis_contig_atomic_dispatch_table);
+
+    using dpctl::tensor::kernels::SumOverStridedAxisFactory;
+    DispatchTableBuilder<sum_reduction_over_strided_axis_impl_fn_ptr,
+                         SumOverStridedAxisFactory, num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(sum_over_strided_axis_dispatch_table);
+
+    using dpctl::tensor::kernels::SumOverAxisCompensatedFactory;
+    DispatchTableBuilder<sum_reduction_strided_impl_fn_ptr,
+                         SumOverAxisCompensatedFactory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(sum_over_axis_compensated_dispatch_table);
+
+    using dpctl::tensor::kernels::SumOverAxisCompensatedContigFactory;
+    DispatchTableBuilder<sum_reduction_contig_impl_fn_ptr,
+                         SumOverAxisCompensatedContigFactory, num_types>
+        dtb6;
+    dtb6.populate_dispatch_table(
+        sum_over_axis_contig_compensated_dispatch_table);
 }
 
 namespace py = pybind11;
@@ -466,7 +570,8 @@ void init_reduction_functions(py::module_ m)
 
     m.def("_sum_over_axis", &py_sum_over_axis, "", py::arg("src"),
           py::arg("trailing_dims_to_reduce"), py::arg("dst"),
-          py::arg("sycl_queue"), py::arg("depends") = py::list());
+          py::arg("sycl_queue"), py::arg("depends") = py::list(),
+          py::arg("deterministic") = false);
 
     m.def("_sum_over_axis_dtype_supported", &py_sum_over_axis_dtype_supported,
           "", py::arg("arg_dtype"), py::arg("out_dtype"),
@@ -43,12 +43,16 @@
 #include "eye_ctor.hpp"
 #include "full_ctor.hpp"
 #include "integer_advanced_indexing.hpp"
+#include "launch_params_tuning.hpp"
+#include "linalg_functions.hpp"
 #include "linear_sequences.hpp"
 #include "simplify_iteration_space.hpp"
 #include "sum_reductions.hpp"
 #include "triul_ctor.hpp"
 #include "utils/memory_overlap.hpp"
+#include "utils/scratch_allocator.hpp"
 #include "utils/strided_iters.hpp"
+#include "utils/usm_prefetch.hpp"
 #include "where.hpp"
 
 namespace py = pybind11;
@@ -348,6 +352,59 @@ PYBIND11_MODULE(_tensor_impl, m)
           "Determines if the memory regions indexed by each array are the same",
           py::arg("array1"), py::arg("array2"));
 
+    auto set_usm_prefetch = [](bool prefetch, bool advise) {
+        auto &state = dpctl::tensor::usm_prefetch::PrefetchState::get();
+        state.prefetch_enabled = prefetch;
+        state.advise_enabled = advise;
+    };
+    m.def("_set_usm_prefetch", set_usm_prefetch,
+          "Enables or disables migration of USM-shared operands to the "
+          "device ahead of kernel submission, and read-mostly advice for "
+          "read-only operands",
+          py::arg("prefetch"), py::arg("advise"));
+
+    auto usm_prefetch_statistics = [](bool reset) -> py::dict {
+        auto &state = dpctl::tensor::usm_prefetch::PrefetchState::get();
+        py::dict stats;
+        stats["prefetch_enabled"] = state.prefetch_enabled.load();
+        stats["advise_enabled"] = state.advise_enabled.load();
+        stats["prefetches"] = state.n_prefetches.load();
+        stats["prefetched_bytes"] = state.prefetched_nbytes.load();
+        stats["advices"] = state.n_advices.load();
+        if (reset) {
+            state.reset_statistics();
+        }
+        return stats;
+    };
+    m.def("_usm_prefetch_statistics", usm_prefetch_statistics,
+          "Returns dictionary with settings of migration of USM-shared "
+          "operands and counts of operations submitted, optionally "
+          "resetting the counts",
+          py::arg("reset") = false);
+
+    auto scratch_arena_statistics = [](sycl::queue &exec_q) {
+        using dpctl::tensor::alloc_utils::ScratchArenaRegistry;
+        const auto stats =
+            ScratchArenaRegistry::get().arena_for(exec_q).statistics();
+        py::dict res;
+        res["chunks"] = stats.n_chunks;
+        res["retained_bytes"] = stats.retained_nbytes;
+        res["live_allocations"] = stats.live_allocations;
+        return res;
+    };
+    m.def("_scratch_arena_statistics", scratch_arena_statistics,
+          "Returns dictionary with counts of chunks, retained bytes and "
+          "live allocations of the scratch arena of the queue",
+          py::arg("sycl_queue"));
+
+    auto scratch_arena_trim = []() {
+        using dpctl::tensor::alloc_utils::ScratchArenaRegistry;
+        return ScratchArenaRegistry::get().trim();
+    };
+    m.def("_scratch_arena_trim", scratch_arena_trim,
+          "Frees idle memory retained by scratch arenas of all queues, "
+          "returns the number of bytes freed");
+
     m.def("_place", &py_place, "", py::arg("dst"), py::arg("cumsum"),
           py::arg("axis_start"), py::arg("axis_end"), py::arg("rhs"),
           py::arg("sycl_queue"), py::arg("depends") = py::list());
@@ -363,4 +420,6 @@ PYBIND11_MODULE(_tensor_impl, m)
     dpctl::tensor::py_internal::init_elementwise_functions(m);
     dpctl::tensor::py_internal::init_boolean_reduction_functions(m);
     dpctl::tensor::py_internal::init_reduction_functions(m);
+    dpctl::tensor::py_internal::init_linalg_functions(m);
+    dpctl::tensor::py_internal::init_launch_params_tuning(m);
 }
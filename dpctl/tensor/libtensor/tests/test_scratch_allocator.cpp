@@ -0,0 +1,125 @@
+//===-- test_scratch_allocator.cpp - Tests of scratch arena  ----*-C++-*-===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// Tests of reuse and release of scratch allocations made from arenas of
+/// libtensor.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+#include "utils/scratch_allocator.hpp"
+
+namespace
+{
+
+using dpctl::tensor::alloc_utils::scratch_allocation;
+using dpctl::tensor::alloc_utils::ScratchArena;
+using dpctl::tensor::alloc_utils::ScratchArenaRegistry;
+
+} // end of anonymous namespace
+
+struct TestScratchArena : public ::testing::Test
+{
+    sycl::queue q;
+
+    TestScratchArena()
+    {
+        // queue with a context of its own, so that the arena is not shared
+        // with other tests
+        sycl::device dev = sycl::device(sycl::default_selector_v);
+        q = sycl::queue(sycl::context(dev), dev);
+    }
+
+    ScratchArena &arena()
+    {
+        return ScratchArenaRegistry::get().arena_for(q);
+    }
+};
+
+TEST_F(TestScratchArena, ChkReuse)
+{
+    int *first_ptr = nullptr;
+    {
+        scratch_allocation<int> tmp(q, 1024);
+        first_ptr = tmp.get();
+        ASSERT_TRUE(first_ptr != nullptr);
+        tmp.release_after(q, sycl::event{}).wait();
+    }
+    EXPECT_EQ(arena().statistics().n_chunks, size_t(1));
+
+    scratch_allocation<int> tmp(q, 1024);
+    // the chunk has been rewound, so the same memory is handed out
+    EXPECT_EQ(tmp.get(), first_ptr);
+    EXPECT_EQ(arena().statistics().n_chunks, size_t(1));
+    tmp.release_after(q, sycl::event{}).wait();
+}
+
+TEST_F(TestScratchArena, ChkRelease)
+{
+    scratch_allocation<float> tmp1(q, 16);
+    scratch_allocation<float> tmp2(q, 16);
+    EXPECT_EQ(arena().statistics().live_allocations, size_t(2));
+    EXPECT_NE(tmp1.get(), tmp2.get());
+
+    sycl::event fill_ev = q.fill<float>(tmp1.get(), 1.0f, 16);
+    tmp1.release_after(q, fill_ev).wait();
+    EXPECT_EQ(arena().statistics().live_allocations, size_t(1));
+    tmp2.release_after(q, sycl::event{}).wait();
+    EXPECT_EQ(arena().statistics().live_allocations, size_t(0));
+}
+
+TEST_F(TestScratchArena, ChkExceptionPath)
+{
+    int *ptr = nullptr;
+    try {
+        scratch_allocation<int> tmp(q, 256);
+        ptr = tmp.get();
+        q.fill<int>(ptr, 0, 256);
+        throw std::runtime_error("Submission failed");
+    } catch (const std::runtime_error &) {
+    }
+    // released by the destructor, once the fill has completed
+    EXPECT_EQ(arena().statistics().live_allocations, size_t(0));
+
+    scratch_allocation<int> tmp(q, 256);
+    EXPECT_EQ(tmp.get(), ptr);
+    tmp.release_after(q, sycl::event{}).wait();
+}
+
+TEST_F(TestScratchArena, ChkTrim)
+{
+    {
+        scratch_allocation<double> tmp(q, 1024);
+        tmp.release_after(q, sycl::event{}).wait();
+    }
+    EXPECT_GT(arena().statistics().retained_nbytes, size_t(0));
+
+    scratch_allocation<double> live_tmp(q, 8);
+    // chunk holding a live allocation is kept
+    EXPECT_EQ(arena().trim(), size_t(0));
+    live_tmp.release_after(q, sycl::event{}).wait();
+
+    EXPECT_GT(arena().trim(), size_t(0));
+    EXPECT_EQ(arena().statistics().n_chunks, size_t(0));
+    EXPECT_EQ(arena().statistics().retained_nbytes, size_t(0));
+}
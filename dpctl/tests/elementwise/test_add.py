@@ -194,6 +194,31 @@ def test_add_broadcasting_new_shape():
     assert (dpt.asnumpy(r7) == np.full((3, 6), 2, dtype="i4")).all()
 
 
+@pytest.mark.parametrize("nd", [1, 2, 3, 4, 5])
+def test_add_strided_ranks(nd):
+    q = get_queue_or_skip()
+
+    shape = (3, 4, 5, 2, 3)[:nd]
+    n = int(np.prod(shape))
+    ar1 = dpt.arange(2 * n, dtype="i4", sycl_queue=q)
+    ar1 = dpt.reshape(ar1, shape[:-1] + (2 * shape[-1],))[..., ::2]
+    ar2 = dpt.permute_dims(
+        dpt.reshape(
+            dpt.arange(n, dtype="i4", sycl_queue=q), tuple(reversed(shape))
+        ),
+        tuple(reversed(range(nd))),
+    )[..., ::-1]
+
+    r = dpt.add(ar1, ar2)
+    expected = np.add(dpt.asnumpy(ar1), dpt.asnumpy(ar2))
+    assert np.array_equal(dpt.asnumpy(r), expected)
+
+    r_inplace = dpt.zeros(shape, dtype="i4", sycl_queue=q)[..., ::-1]
+    r_inplace += ar1
+    r_inplace += ar2
+    assert np.array_equal(dpt.asnumpy(r_inplace), expected)
+
+
 def test_add_broadcasting_error():
     get_queue_or_skip()
     m = dpt.ones((10, 10), dtype="i4")
@@ -455,3 +480,24 @@ def test_add_inplace_overlap():
 
     dpt.add(ar2, ar1, out=ar2)
     assert (dpt.asnumpy(ar2) == np.full(ar2.shape, 3, dtype="i4")).all()
+
+
+def test_add_out_same_view():
+    get_queue_or_skip()
+
+    # identical view but a different object, without type conversion
+    ar1 = dpt.ones(10, dtype="f4")
+    ar2 = dpt.ones_like(ar1)
+    r = dpt.add(ar1, ar2, out=ar1[:])
+    assert (dpt.asnumpy(ar1) == np.full(ar1.shape, 2, dtype="f4")).all()
+    assert (dpt.asnumpy(r) == dpt.asnumpy(ar1)).all()
+
+    dpt.add(ar2, ar1, out=ar1[:])
+    assert (dpt.asnumpy(ar1) == np.full(ar1.shape, 3, dtype="f4")).all()
+
+    # output partially overlapping an input
+    ar1 = dpt.arange(10, dtype="i4")
+    expected = np.arange(10, dtype="i4")
+    expected[1:] = expected[:-1] + expected[1:]
+    dpt.add(ar1[:-1], ar1[1:], out=ar1[1:])
+    assert (dpt.asnumpy(ar1) == expected).all()
@@ -187,3 +187,38 @@ def test_divide_canary_mock_array():
     c = Canary()
     with pytest.raises(ValueError):
         dpt.divide(a, c)
+
+
+@pytest.mark.parametrize("dtype", ["f2", "f4", "f8", "c8", "c16"])
+def test_divide_inplace(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    x = dpt.full((100, 5), 6, dtype=dtype, sycl_queue=q)
+    x /= 2
+    assert (dpt.asnumpy(x) == np.full(x.shape, 3, dtype=dtype)).all()
+
+    v = dpt.asarray([1, 3, 1, 3, 1], dtype=dtype, sycl_queue=q)
+    x /= v
+    expected = np.broadcast_to(
+        np.asarray([3, 1, 3, 1, 3], dtype=dtype), x.shape
+    )
+    assert (dpt.asnumpy(x) == expected).all()
+
+    x[:, ::2] /= x[:, ::2]
+    assert (dpt.asnumpy(x) == np.ones(x.shape, dtype=dtype)).all()
+
+    y = dpt.full(10, 4, dtype=dtype, sycl_queue=q)
+    r = dpt.divide(y, 2, out=y)
+    assert r is y
+    assert (dpt.asnumpy(y) == np.full(y.shape, 2, dtype=dtype)).all()
+
+
+def test_divide_inplace_integer_lhs():
+    get_queue_or_skip()
+
+    # result is cast back to the type of the integral array
+    x = dpt.full(10, 7, dtype="i4")
+    x /= 2
+    assert x.dtype == dpt.int32
+    assert (dpt.asnumpy(x) == np.full(x.shape, 3, dtype="i4")).all()
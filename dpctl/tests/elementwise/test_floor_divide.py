@@ -233,3 +233,18 @@ def test_floor_divide_integer_zero(dtype):
     np.testing.assert_array_equal(
         dpt.asnumpy(res), np.zeros(x.shape, dtype=res.dtype)
     )
+
+
+@pytest.mark.parametrize("dtype", ["i4", "u8", "f4"])
+def test_floor_divide_inplace(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    x = dpt.arange(20, dtype=dtype, sycl_queue=q)
+    x //= 3
+    expected = np.arange(20, dtype=dtype) // 3
+    assert (dpt.asnumpy(x) == expected).all()
+
+    x = dpt.arange(1, 21, dtype=dtype, sycl_queue=q)
+    x[::-1] //= x[::-1]
+    assert (dpt.asnumpy(x) == np.ones(20, dtype=dtype)).all()
@@ -77,3 +77,18 @@ def test_negative_order(dtype):
             expected_Y[..., 1::2] = 0
             expected_Y = np.transpose(expected_Y, perms)
             assert np.allclose(dpt.asnumpy(Y), expected_Y)
+
+
+@pytest.mark.parametrize("nd", [1, 2, 3, 4, 5])
+def test_negative_strided_ranks(nd):
+    q = get_queue_or_skip()
+
+    shape = (3, 4, 5, 2, 3)[:nd]
+    n = int(np.prod(shape))
+    X = dpt.arange(2 * n, dtype="i4", sycl_queue=q)
+    X = dpt.reshape(X, shape[:-1] + (2 * shape[-1],))[..., ::2]
+    # iteration space of the strided view can not be simplified
+    U = dpt.permute_dims(X, tuple(reversed(range(nd))))
+    Y = dpt.negative(U)
+    expected_Y = np.negative(np.transpose(dpt.asnumpy(X)))
+    assert np.array_equal(dpt.asnumpy(Y), expected_Y)
@@ -152,3 +152,20 @@ def test_pow_python_scalar(arr_dt):
         assert isinstance(R, dpt.usm_ndarray)
         R = dpt.pow(sc, X)
         assert isinstance(R, dpt.usm_ndarray)
+
+
+@pytest.mark.parametrize("dtype", ["i4", "u8", "f4", "c8"])
+def test_pow_inplace(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    x = dpt.arange(10, dtype=dtype, sycl_queue=q)
+    x **= 2
+    expected = np.arange(10, dtype=dtype) ** 2
+    assert np.allclose(dpt.asnumpy(x), expected)
+
+    m = dpt.full((10, 3), 2, dtype=dtype, sycl_queue=q)
+    v = dpt.arange(3, dtype=dtype, sycl_queue=q)
+    dpt.pow(m, v, out=m)
+    expected = np.broadcast_to(np.asarray([1, 2, 4], dtype=dtype), m.shape)
+    assert np.allclose(dpt.asnumpy(m), expected)
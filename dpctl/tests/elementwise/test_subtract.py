@@ -151,6 +151,36 @@ def test_subtract_broadcasting():
     ).all()
 
 
+def test_subtract_broadcasting_patterns():
+    get_queue_or_skip()
+
+    m_np = np.arange(35, dtype="i4").reshape(7, 5)
+    col_np = np.arange(7, dtype="i4")[:, np.newaxis]
+    row_np = np.arange(5, dtype="i4")[np.newaxis, :]
+    m = dpt.asarray(m_np)
+    col = dpt.asarray(col_np)
+    row = dpt.asarray(row_np)
+
+    # column vector
+    assert (dpt.asnumpy(dpt.subtract(m, col)) == m_np - col_np).all()
+    assert (dpt.asnumpy(dpt.subtract(col, m)) == col_np - m_np).all()
+
+    # 0d array as either operand
+    s = dpt.asarray(3, dtype="i4")
+    assert (dpt.asnumpy(dpt.subtract(m, s)) == m_np - 3).all()
+    assert (dpt.asnumpy(dpt.subtract(s, m)) == 3 - m_np).all()
+    assert (dpt.asnumpy(dpt.subtract(m[:, ::-2], s)) == m_np[:, ::-2] - 3).all()
+
+    # outer product
+    assert (dpt.asnumpy(dpt.subtract(col, row)) == col_np - row_np).all()
+    assert (dpt.asnumpy(dpt.subtract(row, col)) == row_np - col_np).all()
+
+    # strided output
+    r = dpt.empty((5, 7), dtype="i4").mT
+    dpt.subtract(col, row, out=r)
+    assert (dpt.asnumpy(r) == col_np - row_np).all()
+
+
 @pytest.mark.parametrize("arr_dt", _all_dtypes)
 def test_subtract_python_scalar(arr_dt):
     q = get_queue_or_skip()
@@ -172,6 +202,34 @@ def test_subtract_python_scalar(arr_dt):
         assert isinstance(R, dpt.usm_ndarray)
 
 
+@pytest.mark.parametrize("arr_dt", ["i4", "i8", "f4", "c8"])
+def test_subtract_python_scalar_values(arr_dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(arr_dt, q)
+
+    Xnp = np.arange(77, dtype=arr_dt).reshape(7, 11)
+    for order in ["C", "F"]:
+        X = dpt.asarray(Xnp, order=order, sycl_queue=q)
+        for sc in (int(3), float(2)):
+            R = dpt.subtract(X, sc)
+            assert np.allclose(dpt.asnumpy(R), Xnp - Xnp.dtype.type(sc))
+            assert R.flags.c_contiguous == X.flags.c_contiguous
+            R = dpt.subtract(sc, X)
+            assert np.allclose(dpt.asnumpy(R), Xnp.dtype.type(sc) - Xnp)
+
+    # non-contiguous input and output of given layout
+    X = dpt.asarray(Xnp, sycl_queue=q)
+    R = dpt.subtract(X[:, ::2], 1)
+    assert np.allclose(dpt.asnumpy(R), Xnp[:, ::2] - 1)
+    R = dpt.subtract(1, X, order="F")
+    assert R.flags.f_contiguous
+    assert np.allclose(dpt.asnumpy(R), 1 - Xnp)
+
+    out = dpt.empty_like(X)
+    dpt.subtract(X, 1, out=out)
+    assert np.allclose(dpt.asnumpy(out), Xnp - 1)
+
+
 @pytest.mark.parametrize("dtype", _all_dtypes[1:])
 def test_subtract_inplace_python_scalar(dtype):
     q = get_queue_or_skip()
@@ -225,3 +283,32 @@ def test_subtract_inplace_broadcasting():
     assert (
         dpt.asnumpy(m) == np.arange(1, -4, step=-1, dtype="i4")[np.newaxis, :]
     ).all()
+
+
+def test_subtract_out_aliasing():
+    get_queue_or_skip()
+
+    x = dpt.arange(10, dtype="i4")
+    y = dpt.ones(10, dtype="i4")
+    r = dpt.subtract(x, y, out=x)
+    assert r is x
+    assert (dpt.asnumpy(x) == np.arange(-1, 9, dtype="i4")).all()
+
+    # output aliasing the second argument of non-commutative function
+    x = dpt.arange(10, dtype="i4")
+    y = dpt.ones(10, dtype="i4")
+    dpt.subtract(x, y, out=y)
+    assert (dpt.asnumpy(y) == np.arange(-1, 9, dtype="i4")).all()
+
+    # output is a view of the input with different strides
+    x = dpt.arange(10, dtype="i4")
+    expected = np.arange(10, dtype="i4")
+    expected[::2] = expected[::2] - expected[::-2]
+    dpt.subtract(x[::2], x[::-2], out=x[::2])
+    assert (dpt.asnumpy(x) == expected).all()
+
+    x = dpt.arange(10, dtype="i4")
+    expected = np.arange(10, dtype="i4")
+    expected[1:] = expected[:-1] - 1
+    dpt.subtract(x[:-1], 1, out=x[1:])
+    assert (dpt.asnumpy(x) == expected).all()
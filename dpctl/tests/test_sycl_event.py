@@ -98,6 +98,51 @@ def test_wait_with_list():
         pytest.fail("Failed to wait for events from the list")
 
 
+def test_wait_with_empty_list():
+    try:
+        dpctl.SyclEvent.wait_for([])
+    except ValueError:
+        pytest.fail("Failed to wait for an empty list of events")
+
+
+def test_wait_with_list_of_submitted_events():
+    try:
+        events = [produce_event() for _ in range(3)]
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("OpenCL CPU queue could not be created")
+    dpctl.SyclEvent.wait_for(events)
+    for ev in events:
+        assert ev.execution_status == esty.complete
+
+
+def test_when_all():
+    try:
+        q = dpctl.SyclQueue("opencl:cpu")
+        events = [produce_event() for _ in range(3)]
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("OpenCL CPU queue could not be created")
+    agg_ev = dpctl.SyclEvent.when_all(events, sycl_queue=q)
+    assert isinstance(agg_ev, dpctl.SyclEvent)
+    agg_ev.wait()
+    for ev in events:
+        assert ev.execution_status == esty.complete
+
+
+def test_when_all_default_queue():
+    try:
+        dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Default queue could not be created")
+    agg_ev = dpctl.SyclEvent.when_all([dpctl.SyclEvent(), dpctl.SyclEvent()])
+    assert isinstance(agg_ev, dpctl.SyclEvent)
+    agg_ev.wait()
+
+
+def test_when_all_invalid():
+    with pytest.raises(TypeError):
+        dpctl.SyclEvent.when_all([dpctl.SyclEvent(), 77])
+
+
 def test_execution_status():
     event = dpctl.SyclEvent()
     try:
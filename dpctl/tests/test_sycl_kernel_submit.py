@@ -225,3 +225,80 @@ def test_async_submit():
         Xref[2, i] = min(Xref[0, i], Xref[1, i])
 
     assert np.array_equal(Xnp, Xref)
+
+
+def test_submit_local_accessor():
+    try:
+        q = dpctl.SyclQueue("opencl")
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("OpenCL queue could not be created")
+    oclSrc = (
+        "kernel void group_sum(global int *x, global int *res, "
+        "   local int *tmp) {"
+        "   size_t lid = get_local_id(0);"
+        "   tmp[lid] = x[get_global_id(0)];"
+        "   barrier(CLK_LOCAL_MEM_FENCE);"
+        "   if (lid == 0) {"
+        "       int s = 0;"
+        "       for (size_t i = 0; i < get_local_size(0); i++) {"
+        "           s += tmp[i];"
+        "       }"
+        "       res[get_group_id(0)] = s;"
+        "   }"
+        "}"
+    )
+    prog = dpctl_prog.create_program_from_source(q, oclSrc)
+    kern = prog.get_sycl_kernel("group_sum")
+
+    n, lws = 1024, 32
+    x = dpt.arange(n, dtype="i4", sycl_queue=q)
+    res = dpt.zeros(n // lws, dtype="i4", sycl_queue=q)
+    lacc = dpctl.LocalAccessor("i4", (lws,))
+    q.submit(kern, [x.usm_data, res.usm_data, lacc], [n], [lws]).wait()
+
+    expected = np.arange(n, dtype="i4").reshape(-1, lws).sum(axis=1)
+    assert np.array_equal(dpt.asnumpy(res), expected)
+
+
+def test_local_accessor_validation():
+    lacc = dpctl.LocalAccessor("f8", (4, 8))
+    assert lacc.dtype == "f8"
+    assert lacc.shape == (4, 8)
+    assert "LocalAccessor" in repr(lacc)
+    with pytest.raises(ValueError):
+        dpctl.LocalAccessor("c8", (16,))
+    with pytest.raises(ValueError):
+        dpctl.LocalAccessor("i4", (1, 2, 3, 4))
+    with pytest.raises(ValueError):
+        dpctl.LocalAccessor("i4", tuple())
+    with pytest.raises(ValueError):
+        dpctl.LocalAccessor("i4", (0,))
+
+
+def test_submit_auto_local_range():
+    try:
+        q = dpctl.SyclQueue("opencl")
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("OpenCL queue could not be created")
+    oclSrc = (
+        "kernel void scale(global float *x, local float *tmp) {"
+        "   size_t lid = get_local_id(1);"
+        "   size_t gid = get_global_id(0) * get_global_size(1) + "
+        "       get_global_id(1);"
+        "   tmp[lid] = x[gid];"
+        "   barrier(CLK_LOCAL_MEM_FENCE);"
+        "   x[gid] = 2 * tmp[lid];"
+        "}"
+    )
+    prog = dpctl_prog.create_program_from_source(q, oclSrc)
+    kern = prog.get_sycl_kernel("scale")
+
+    n0, n1 = 6, 1000
+    x = dpt.ones((n0, n1), dtype="f4", sycl_queue=q)
+    # large enough for any work-group size the kernel supports
+    lacc = dpctl.LocalAccessor("f4", (kern.work_group_size,))
+    q.submit(kern, [x.usm_data, lacc], [n0, n1], "auto").wait()
+    assert np.all(dpt.asnumpy(x) == 2)
+
+    with pytest.raises(ValueError):
+        q.submit(kern, [x.usm_data, lacc], [n0, n1], "best")
@@ -263,3 +263,61 @@ def test_create_program_from_invalid_src_ocl():
     }"
     with pytest.raises(dpctl_prog.SyclProgramCompilationError):
         dpctl_prog.create_program_from_source(q, invalid_oclSrc)
+
+
+def test_create_program_from_source_async_ocl():
+    oclSrc = "                                                             \
+    kernel void add(global int* a, global int* b, global int* c) {         \
+        size_t index = get_global_id(0);                                   \
+        c[index] = a[index] + b[index];                                    \
+    }                                                                      \
+    kernel void axpy(global int* a, global int* b, global int* c, int d) { \
+        size_t index = get_global_id(0);                                   \
+        c[index] = a[index] + d*b[index];                                  \
+    }"
+    try:
+        q = dpctl.SyclQueue("opencl")
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("No OpenCL queue is available")
+    futures = [
+        dpctl_prog.create_program_from_source_async(q, oclSrc)
+        for _ in range(4)
+    ]
+    for f in futures:
+        _check_multi_kernel_program(f.result())
+
+    ctx_f = dpctl_prog.create_program_from_source_async(q.sycl_context, oclSrc)
+    progs = ctx_f.result()
+    assert len(progs) == q.sycl_context.device_count
+    for prog in progs:
+        _check_multi_kernel_program(prog)
+
+
+def test_create_program_from_spirv_async():
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("No default queue is available")
+    if q.sycl_device.backend not in [
+        dpctl.backend_type.opencl,
+        dpctl.backend_type.level_zero,
+    ]:
+        pytest.skip("Programs can not be built for the default device")
+    spirv_file = get_spirv_abspath("multi_kernel.spv")
+    with open(spirv_file, "rb") as fin:
+        spirv = fin.read()
+    f = dpctl_prog.create_program_from_spirv_async(q, spirv)
+    _check_multi_kernel_program(f.result())
+
+
+def test_create_program_from_invalid_src_async_ocl():
+    try:
+        q = dpctl.SyclQueue("opencl")
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("No OpenCL queue is available")
+    invalid_oclSrc = "kernel void sub(global int* a, global int* b, "
+    f = dpctl_prog.create_program_from_source_async(q, invalid_oclSrc)
+    with pytest.raises(dpctl_prog.SyclProgramCompilationError):
+        f.result()
+    with pytest.raises(TypeError):
+        dpctl_prog.create_program_from_source_async(None, invalid_oclSrc)
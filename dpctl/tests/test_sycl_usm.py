@@ -671,3 +671,40 @@ def test_memset():
     m_ho.memset(ord("7"))
     m_ho.copy_to_host(host_buf)
     assert host_buf == b"7" * n
+
+
+@pytest.mark.parametrize(
+    "placement_kind", ["first_touch", "queue", "device", "interleave"]
+)
+def test_memory_placement(memory_ctor, placement_kind):
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Default queue could not be created")
+    placement = {
+        "first_touch": "first_touch",
+        "queue": q,
+        "device": q.sycl_device,
+        "interleave": [q, q.sycl_device],
+    }[placement_kind]
+
+    n = 3 * 1024 * 1024 + 17
+    if memory_ctor is MemoryUSMDevice:
+        with pytest.raises(ValueError):
+            memory_ctor(n, queue=q, placement=placement)
+        return
+    m = memory_ctor(n, queue=q, placement=placement)
+    host_buf = m.copy_to_host()
+    assert host_buf.size == n
+    assert not host_buf.any()
+
+
+def test_memory_placement_validation():
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Default queue could not be created")
+    with pytest.raises(ValueError):
+        MemoryUSMShared(64, queue=q, placement="last_touch")
+    with pytest.raises(TypeError):
+        MemoryUSMShared(64, queue=q, placement=[1, 2])
@@ -0,0 +1,57 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+
+import dpctl.tensor as dpt
+import dpctl.tensor._tensor_impl as ti
+from dpctl.tests.helper import get_queue_or_skip
+
+
+def test_launch_params_cache_file():
+    fn = ti._launch_params_cache_file()
+    assert isinstance(fn, str)
+
+
+def test_autotune_launch_params():
+    q = get_queue_or_skip()
+    dev = q.sycl_device
+    max_wg = dev.max_work_group_size
+
+    try:
+        params = ti._autotune_launch_params(q, persist=False)
+        assert len(params) > 0
+        families = set()
+        for family, type_size, wg_size, items_per_wi in params:
+            families.add(family)
+            assert type_size in [1, 2, 4, 8, 16]
+            assert 0 < wg_size <= max_wg
+            assert items_per_wi > 0
+        assert {"unary_contig", "binary_contig", "reduction_strided"}.issubset(
+            families
+        )
+        assert ti._get_launch_params(q) == params
+
+        # results computed with tuned parameters
+        n = 10007
+        x = dpt.arange(n, dtype="i4", sycl_queue=q)
+        y = dpt.add(x, x)
+        assert np.array_equal(dpt.asnumpy(y), 2 * np.arange(n, dtype="i4"))
+        s = dpt.sum(dpt.ones(n, dtype="f4", sycl_queue=q))
+        assert dpt.asnumpy(s) == n
+    finally:
+        ti._reset_launch_params(q, persist=False)
+    assert ti._get_launch_params(q) == []
@@ -0,0 +1,64 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import dpctl.tensor as dpt
+import dpctl.tensor._tensor_impl as ti
+from dpctl.tests.helper import get_queue_or_skip
+
+
+def _add_matrix_row(q):
+    # adding a row to a C-contiguous matrix pads the row into scratch memory
+    m = dpt.ones((64, 1000), dtype="f4", sycl_queue=q)
+    v = dpt.ones(1000, dtype="f4", sycl_queue=q)
+    return dpt.add(m, v)
+
+
+def test_scratch_arena_reuse():
+    q = get_queue_or_skip()
+    ti._scratch_arena_trim()
+    r = _add_matrix_row(q)
+    assert dpt.all(r == 2)
+    stats = ti._scratch_arena_statistics(q)
+    assert stats["chunks"] >= 1
+    for _ in range(10):
+        _add_matrix_row(q)
+    assert ti._scratch_arena_statistics(q)["chunks"] == stats["chunks"]
+    assert (
+        ti._scratch_arena_statistics(q)["retained_bytes"]
+        == stats["retained_bytes"]
+    )
+
+
+def test_scratch_arena_release():
+    q = get_queue_or_skip()
+    _add_matrix_row(q)
+    q.wait()
+    assert ti._scratch_arena_statistics(q)["live_allocations"] == 0
+
+
+def test_scratch_arena_trim():
+    q = get_queue_or_skip()
+    _add_matrix_row(q)
+    q.wait()
+    retained = ti._scratch_arena_statistics(q)["retained_bytes"]
+    assert retained > 0
+    assert ti._scratch_arena_trim() >= retained
+    stats = ti._scratch_arena_statistics(q)
+    assert stats["chunks"] == 0
+    assert stats["retained_bytes"] == 0
+    # arena serves allocations after trimming
+    r = _add_matrix_row(q)
+    assert dpt.all(r == 2)
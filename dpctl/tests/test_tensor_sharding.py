@@ -0,0 +1,151 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+import pytest
+
+import dpctl
+import dpctl.tensor as dpt
+import dpctl.tensor._elementwise_common as ew_cmn
+from dpctl.tests.helper import get_queue_or_skip
+
+
+def _shard_queues_or_skip(n=3):
+    q = get_queue_or_skip()
+    # queues sharing a context, which need not target distinct sub-devices
+    return [dpctl.SyclQueue(q.sycl_context, q.sycl_device) for _ in range(n)]
+
+
+def test_sharding_validation():
+    qs = _shard_queues_or_skip()
+    with pytest.raises(TypeError):
+        with dpt.sharding([]):
+            pass
+    other_q = dpctl.SyclQueue(qs[0].sycl_device)
+    if other_q.sycl_context != qs[0].sycl_context:
+        with pytest.raises(ValueError):
+            with dpt.sharding([qs[0], other_q]):
+                pass
+
+
+def test_sharded_elementwise():
+    qs = _shard_queues_or_skip()
+    x = dpt.reshape(dpt.arange(7 * 5, dtype="f4", sycl_queue=qs[0]), (7, 5))
+    y = dpt.ones(5, dtype="f4", sycl_queue=qs[0])
+    x_np = dpt.asnumpy(x)
+    with dpt.sharding(qs, min_size=1):
+        r1 = dpt.negative(x)
+        r2 = dpt.add(x, y)
+        r3 = dpt.multiply(x, 2)
+    assert r1.sycl_queue == qs[0]
+    assert np.array_equal(dpt.asnumpy(r1), -x_np)
+    assert np.array_equal(dpt.asnumpy(r2), x_np + 1)
+    assert np.array_equal(dpt.asnumpy(r3), x_np * 2)
+
+
+def _count_shard_submissions(monkeypatch, module):
+    """Records queues which blocks of sharded operations are submitted to"""
+    submitted = []
+    submit_sharded = module._submit_sharded
+
+    def _counting_submit_sharded(queues, n, submit_fn):
+        def _counting_submit_fn(q, s):
+            submitted.append(q)
+            return submit_fn(q, s)
+
+        return submit_sharded(queues, n, _counting_submit_fn)
+
+    monkeypatch.setattr(module, "_submit_sharded", _counting_submit_sharded)
+    return submitted
+
+
+def test_sharded_elementwise_splits_work(monkeypatch):
+    qs = _shard_queues_or_skip()
+    submitted = _count_shard_submissions(monkeypatch, ew_cmn)
+    x = dpt.reshape(dpt.arange(7 * 5, dtype="f4", sycl_queue=qs[0]), (7, 5))
+    x_np = dpt.asnumpy(x)
+
+    with dpt.sharding(qs, min_size=1):
+        r = dpt.negative(x)
+    assert submitted == list(qs)
+    assert np.array_equal(dpt.asnumpy(r), -x_np)
+
+    submitted.clear()
+    out = dpt.empty_like(x)
+    with dpt.sharding(qs, min_size=1):
+        dpt.negative(x, out=out)
+        dpt.add(x, x, out=out)
+    assert submitted == list(qs) * 2
+    assert np.array_equal(dpt.asnumpy(out), x_np + x_np)
+
+    # below the minimal size, computed on the allocation queue alone
+    submitted.clear()
+    with dpt.sharding(qs):
+        dpt.negative(x)
+    assert submitted == []
+
+
+def test_sharded_copy():
+    qs = _shard_queues_or_skip()
+    x = dpt.reshape(dpt.arange(11 * 4, dtype="i4", sycl_queue=qs[0]), (11, 4))
+    with dpt.sharding(qs, min_size=1):
+        y = dpt.copy(x.mT, order="C")
+        z = dpt.astype(x, "i8")
+    assert np.array_equal(dpt.asnumpy(y), dpt.asnumpy(x).T)
+    assert np.array_equal(dpt.asnumpy(z), dpt.asnumpy(x))
+
+
+@pytest.mark.parametrize("axis", [None, 0, 1, (0, 1)])
+def test_sharded_sum(axis):
+    qs = _shard_queues_or_skip()
+    x = dpt.reshape(dpt.arange(9 * 6, dtype="i4", sycl_queue=qs[0]), (9, 6))
+    with dpt.sharding(qs, min_size=1):
+        s = dpt.sum(x, axis=axis)
+    expected = np.sum(dpt.asnumpy(x).astype("i8"), axis=axis)
+    assert np.array_equal(dpt.asnumpy(s), expected)
+
+
+def test_sharded_sum_1d():
+    qs = _shard_queues_or_skip()
+    x = dpt.arange(101, dtype="i4", sycl_queue=qs[0])
+    with dpt.sharding(qs, min_size=1):
+        s = dpt.sum(x)
+        s0 = dpt.sum(x, axis=0)
+    assert s.shape == ()
+    assert int(s) == 101 * 100 // 2
+    assert int(s0) == 101 * 100 // 2
+
+
+def test_sharded_sum_leading_axis_reduced():
+    qs = _shard_queues_or_skip()
+    x = dpt.reshape(dpt.arange(8 * 3, dtype="i4", sycl_queue=qs[0]), (8, 3))
+    x_np = dpt.asnumpy(x).astype("i8")
+    with dpt.sharding(qs, min_size=1):
+        s_all = dpt.sum(x, axis=None)
+        s_both = dpt.sum(x, axis=(0, 1))
+    assert s_all.shape == ()
+    assert s_both.shape == ()
+    assert int(s_all) == int(np.sum(x_np))
+    assert int(s_both) == int(np.sum(x_np))
+
+
+def test_sharding_min_size():
+    qs = _shard_queues_or_skip()
+    x = dpt.ones((4, 4), dtype="f4", sycl_queue=qs[0])
+    with dpt.sharding(qs):
+        # below the default minimal size, computed on the allocation queue
+        y = dpt.exp(x)
+    assert np.allclose(dpt.asnumpy(y), np.e)
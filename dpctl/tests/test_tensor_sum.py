@@ -133,3 +133,125 @@ def test_sum_arg_out_dtype_scalar(arg_dtype, out_dtype):
     assert isinstance(r, dpt.usm_ndarray)
     assert r.dtype == dpt.dtype(out_dtype)
     assert dpt.asnumpy(r) == 1
+
+
+@pytest.mark.parametrize("arg_dtype", ["i1", "i4", "u8", "f2", "f4", "c8"])
+def test_sum_over_leading_axis(arg_dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(arg_dtype, q)
+
+    n0, n1 = 1025, 67
+    m_np = (np.arange(n0 * n1) % 7).astype(arg_dtype).reshape((n0, n1))
+    m = dpt.asarray(m_np, sycl_queue=q)
+    s = dpt.sum(m, axis=0)
+
+    assert s.shape == (n1,)
+    expected = np.sum(m_np, axis=0, dtype=s.dtype)
+    assert np.allclose(dpt.asnumpy(s), expected)
+
+
+def test_sum_over_leading_axis_tall_matrix():
+    get_queue_or_skip()
+
+    # long reduced axis is split into chunks reduced by separate work-items
+    n0, n1 = 2**16 + 3, 32
+    m = dpt.ones((n0, n1), dtype="i4")
+    s = dpt.sum(m, axis=0)
+    assert (dpt.asnumpy(s) == n0).all()
+
+    s = dpt.sum(m[::-3, ::2], axis=0)
+    assert s.shape == (n1 // 2,)
+    assert (dpt.asnumpy(s) == (n0 + 2) // 3).all()
+
+
+def test_sum_over_empty_leading_axis():
+    get_queue_or_skip()
+
+    m = dpt.ones((0, 40), dtype="i4")
+    s = dpt.sum(m, axis=0)
+    assert s.shape == (40,)
+    assert (dpt.asnumpy(s) == 0).all()
+
+
+def test_sum_over_leading_axes():
+    get_queue_or_skip()
+
+    m = dpt.ones((5, 6, 7, 40), dtype="f4")
+    s = dpt.sum(m, axis=(0, 1))
+    assert s.shape == (7, 40)
+    assert (dpt.asnumpy(s) == 5 * 6).all()
+
+    s = dpt.sum(m, axis=(0, 1), keepdims=True)
+    assert s.shape == (1, 1, 7, 40)
+    assert (dpt.asnumpy(s) == 5 * 6).all()
+
+
+@pytest.mark.parametrize("arg_dtype", ["f4", "c8"])
+def test_sum_deterministic_reproducible(arg_dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(arg_dtype, q)
+
+    rng = np.random.default_rng(1234)
+    x_np = rng.standard_normal(2**20 + 17).astype(arg_dtype)
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    r1 = dpt.asnumpy(dpt.sum(x, deterministic=True))
+    for _ in range(5):
+        r2 = dpt.asnumpy(dpt.sum(x, deterministic=True))
+        assert r1.tobytes() == r2.tobytes()
+
+
+def test_sum_deterministic_accuracy():
+    get_queue_or_skip()
+
+    # alternating magnitudes make naive float32 accumulation lose digits
+    n = 2**22
+    x_np = np.where(
+        np.arange(n) % 2 == 0, np.float32(1e4), np.float32(1e-3)
+    ).astype("f4")
+    x = dpt.asarray(x_np)
+
+    expected = np.sum(x_np, dtype="f8")
+    r = dpt.asnumpy(dpt.sum(x, dtype="f4", deterministic=True))
+    assert abs(float(r) - expected) <= 4 * np.finfo("f4").eps * expected
+
+
+def test_sum_deterministic_compensated_combine():
+    get_queue_or_skip()
+
+    # each block of elements sums to 1, which is lost to cancellation unless
+    # rounding errors are carried through the combination of partial sums
+    n_blocks = 2**16
+    block = np.array([1e8, 1.0, -1e8, 0.0], dtype="f4")
+    x_np = np.tile(block, n_blocks)
+    x = dpt.asarray(x_np)
+
+    r = dpt.asnumpy(dpt.sum(x, deterministic=True))
+    assert float(r) == n_blocks
+
+    y = dpt.asarray(np.stack([x_np, np.zeros_like(x_np)], axis=1))[:, 0]
+    r_strided = dpt.asnumpy(dpt.sum(y, deterministic=True))
+    assert float(r_strided) == n_blocks
+
+
+def test_sum_deterministic_empty():
+    get_queue_or_skip()
+
+    x = dpt.empty((3, 0), dtype="f4")
+    for axis in (1, None):
+        r = dpt.sum(x, axis=axis, deterministic=True)
+        assert (dpt.asnumpy(r) == 0).all()
+
+
+@pytest.mark.parametrize("arg_dtype", ["i4", "f2", "f4", "f8", "c16"])
+def test_sum_deterministic_axis(arg_dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(arg_dtype, q)
+
+    m_np = (np.arange(37 * 1031) % 5).astype(arg_dtype).reshape((37, 1031))
+    m = dpt.asarray(m_np, sycl_queue=q)
+
+    for axis in (0, 1, None):
+        s = dpt.sum(m, axis=axis, deterministic=True)
+        expected = np.sum(m_np, axis=axis, dtype=s.dtype)
+        assert np.allclose(dpt.asnumpy(s), expected)
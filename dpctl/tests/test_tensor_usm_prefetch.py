@@ -0,0 +1,76 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+
+import dpctl.tensor as dpt
+import dpctl.tensor._tensor_impl as ti
+from dpctl.tests.helper import get_queue_or_skip
+
+
+def test_usm_prefetch_statistics():
+    get_queue_or_skip()
+    stats = ti._usm_prefetch_statistics()
+    assert set(stats.keys()) == {
+        "prefetch_enabled",
+        "advise_enabled",
+        "prefetches",
+        "prefetched_bytes",
+        "advices",
+    }
+
+
+def test_usm_prefetch_shared_operands():
+    q = get_queue_or_skip()
+    n = 1024
+    x = dpt.arange(n, dtype="f4", usm_type="shared", sycl_queue=q)
+    y = dpt.ones(n, dtype="f4", usm_type="shared", sycl_queue=q)
+    x.flags.writable = False
+
+    saved = ti._usm_prefetch_statistics(reset=True)
+    try:
+        ti._set_usm_prefetch(True, True)
+        r = dpt.add(x, y)
+        assert np.array_equal(dpt.asnumpy(r), np.arange(n) + 1)
+        stats = ti._usm_prefetch_statistics(reset=True)
+        if q.sycl_device.is_cpu:
+            assert stats["prefetches"] == 0
+        else:
+            # both inputs and the output are migrated
+            assert stats["prefetches"] == 3
+            assert stats["prefetched_bytes"] == 3 * n * x.itemsize
+            assert stats["advices"] <= 1
+
+        ti._set_usm_prefetch(False, False)
+        r = dpt.add(x, y)
+        assert np.array_equal(dpt.asnumpy(r), np.arange(n) + 1)
+        stats = ti._usm_prefetch_statistics(reset=True)
+        assert stats["prefetches"] == 0
+        assert stats["advices"] == 0
+        assert not stats["prefetch_enabled"]
+    finally:
+        ti._set_usm_prefetch(
+            saved["prefetch_enabled"], saved["advise_enabled"]
+        )
+
+
+def test_usm_prefetch_skips_device_memory():
+    q = get_queue_or_skip()
+    x = dpt.ones(64, dtype="i4", usm_type="device", sycl_queue=q)
+    ti._usm_prefetch_statistics(reset=True)
+    r = dpt.negative(x)
+    assert np.array_equal(dpt.asnumpy(r), -np.ones(64, dtype="i4"))
+    assert ti._usm_prefetch_statistics()["prefetches"] == 0
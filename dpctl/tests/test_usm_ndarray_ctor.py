@@ -1034,6 +1034,47 @@ def test_setitem_scalar(dtype, usm_type):
     )
 
 
+@pytest.mark.parametrize("dtype", _all_dtypes)
+def test_setitem_scalar_strided(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+    Xnp = np.zeros((5, 8, 6), dtype=dtype)
+    X = dpt.asarray(Xnp, sycl_queue=q)
+    for key in [
+        (slice(None, None, 2), Ellipsis),
+        (Ellipsis, slice(None, None, -3)),
+        (1, slice(1, None, 3), slice(None, 4)),
+        (slice(None), slice(None, None, 2), slice(None, None, -2)),
+    ]:
+        for val in [True, 3, 2.0, complex(1, 0)]:
+            if np.dtype(dtype).kind not in "fc" and isinstance(val, float):
+                continue
+            if np.dtype(dtype).kind != "c" and isinstance(val, complex):
+                continue
+            X[key] = val
+            Xnp[key] = val
+            assert np.array_equal(dpt.asnumpy(X), Xnp)
+
+
+def test_setitem_scalar_strided_casting():
+    q = get_queue_or_skip()
+    X = dpt.zeros((4, 4), dtype="i4", sycl_queue=q)
+    X[::2, ::-2] = 2.7
+    X[1::2, ::2] = -1
+    Xnp = np.zeros((4, 4), dtype="i4")
+    Xnp[::2, ::-2] = 2
+    Xnp[1::2, ::2] = -1
+    assert np.array_equal(dpt.asnumpy(X), Xnp)
+
+    Y = dpt.zeros(7, dtype="u1", sycl_queue=q)
+    Y[::3] = 257
+    assert np.array_equal(dpt.asnumpy(Y)[::3], np.ones(3, dtype="u1"))
+
+    Z = dpt.zeros(7, dtype="?", sycl_queue=q)
+    Z[::2] = 5
+    assert np.array_equal(dpt.asnumpy(Z), np.arange(7) % 2 == 0)
+
+
 def test_setitem_errors():
     q = get_queue_or_skip()
     X = dpt.empty((4,), dtype="u1", sycl_queue=q)
@@ -1201,6 +1242,45 @@ def test_to_device_migration():
     assert X1.usm_data._pointer == X2.usm_data._pointer
 
 
+@pytest.mark.parametrize("n", [1000, 5 * 2**20 + 7])
+def test_to_device_different_context(n):
+    q1 = get_queue_or_skip()
+    dev = q1.sycl_device
+    # queue with its own context, so that data must be copied
+    q2 = dpctl.SyclQueue(dpctl.SyclContext(dev), dev)
+    X1 = dpt.arange(n, dtype="i4", sycl_queue=q1)
+    X2 = X1[1::3].to_device(q2)
+    assert X2.sycl_queue == q2
+    assert X1.usm_data._pointer != X2.usm_data._pointer
+    assert np.array_equal(dpt.asnumpy(X2), np.arange(n, dtype="i4")[1::3])
+
+
+def test_to_device_sub_devices():
+    q = get_queue_or_skip()
+    dev = q.sycl_device
+    try:
+        sub_devs = dev.create_sub_devices(partition="next_partitionable")
+    except dpctl.SyclSubDeviceCreationError:
+        pytest.skip("Device can not be partitioned")
+    if len(sub_devs) < 2:
+        pytest.skip("Device can not be partitioned into several sub-devices")
+    # queues sharing a context, which results in a view
+    ctx = dpctl.SyclContext(sub_devs)
+    q0 = dpctl.SyclQueue(ctx, sub_devs[0])
+    q1 = dpctl.SyclQueue(ctx, sub_devs[1])
+    X0 = dpt.arange(2**20, dtype="i4", sycl_queue=q0)
+    X1 = X0.to_device(q1)
+    assert X1.sycl_queue == q1
+    assert X1.usm_data._pointer == X0.usm_data._pointer
+    # queue of a sub-device with a context of its own, so that data are
+    # copied through pinned host memory
+    q2 = dpctl.SyclQueue(dpctl.SyclContext(sub_devs[1]), sub_devs[1])
+    X2 = X0.to_device(q2)
+    assert X2.sycl_queue == q2
+    assert X2.usm_data._pointer != X0.usm_data._pointer
+    assert np.array_equal(dpt.asnumpy(X2), np.arange(2**20, dtype="i4"))
+
+
 def test_astype():
     try:
         X = dpt.empty((5, 5), dtype="i4")
@@ -1257,6 +1337,25 @@ def test_copy():
     assert np.array_equal(dpt.asnumpy(Yk), ref)
 
 
+@pytest.mark.parametrize("dt", ["i4", "f4", "c8"])
+def test_copy_2d_strided(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    X = dpt.reshape(dpt.arange(7 * 12, dtype="i4", sycl_queue=q), (7, 12))
+    X_np = dpt.asnumpy(X)
+    for U, U_np in [
+        (X.mT, X_np.T),
+        (X[::-2, 1::3], X_np[::-2, 1::3]),
+        (X[:, ::2].mT, X_np[:, ::2].T),
+    ]:
+        Y = dpt.astype(U, dt)
+        assert np.array_equal(dpt.asnumpy(Y), U_np.astype(dt))
+        Z = dpt.empty_like(Y)
+        Z[...] = U
+        assert np.array_equal(dpt.asnumpy(Z), U_np.astype(dt))
+
+
 def test_ctor_invalid():
     try:
         m = dpm.MemoryUSMShared(12)
@@ -1395,6 +1494,29 @@ def test_zeros(dtype):
     assert np.array_equal(dpt.asnumpy(X), np.zeros(10, dtype=dtype))
 
 
+@pytest.mark.parametrize("usm_type", ["shared", "host"])
+def test_zeros_placement(usm_type):
+    q = get_queue_or_skip()
+    X = dpt.zeros(
+        (4, 1000), dtype="i4", usm_type=usm_type, sycl_queue=q, placement=q
+    )
+    assert np.array_equal(dpt.asnumpy(X), np.zeros((4, 1000), dtype="i4"))
+    Y = dpt.empty(
+        (4, 1000),
+        dtype="i4",
+        usm_type=usm_type,
+        sycl_queue=q,
+        placement=[q, q.sycl_device],
+    )
+    assert np.array_equal(dpt.asnumpy(Y), np.zeros((4, 1000), dtype="i4"))
+
+
+def test_zeros_placement_device():
+    q = get_queue_or_skip()
+    with pytest.raises(ValueError):
+        dpt.zeros(10, usm_type="device", sycl_queue=q, placement=q)
+
+
 @pytest.mark.parametrize(
     "dtype",
     _all_dtypes,
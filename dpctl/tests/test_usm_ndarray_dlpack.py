@@ -21,6 +21,7 @@ from helper import skip_if_dtype_not_supported
 
 import dpctl
 import dpctl.tensor as dpt
+import dpctl.tensor._tensor_impl as ti
 
 device_oneAPI = 14  # DLDeviceType.kDLOneAPI
 
@@ -118,6 +119,111 @@ def test_dlpack_exporter_stream():
     assert type(cap1) is type(cap2)
 
 
+def test_dlpack_exporter_versioned():
+    caps_fn = ctypes.pythonapi.PyCapsule_IsValid
+    caps_fn.restype = bool
+    caps_fn.argtypes = [ctypes.py_object, ctypes.c_char_p]
+    try:
+        X = dpt.arange(64, dtype="i4")
+    except dpctl.SyclDeviceCreationError:
+        pytest.skip("No SYCL devices available")
+    caps = X.__dlpack__(max_version=(1, 0))
+    assert caps_fn(caps, b"dltensor_versioned")
+    caps = X.__dlpack__(max_version=(0, 8))
+    assert caps_fn(caps, b"dltensor")
+    caps = X.__dlpack__(max_version=(1, 0), dl_device=X.__dlpack_device__())
+    assert caps_fn(caps, b"dltensor_versioned")
+    with pytest.raises(TypeError):
+        X.__dlpack__(max_version=1)
+    with pytest.raises(TypeError):
+        X.__dlpack__(dl_device=device_oneAPI)
+
+
+def test_dlpack_versioned_read_only():
+    try:
+        X = dpt.arange(16, dtype="i4")
+    except dpctl.SyclDeviceCreationError:
+        pytest.skip("No SYCL devices available")
+    X.flags["W"] = False
+    Y = dpt._dlpack.from_dlpack_capsule(X.__dlpack__(max_version=(1, 0)))
+    assert not Y.flags.writable
+    assert X._pointer == Y._pointer
+    Z = dpt._dlpack.from_dlpack_capsule(X.__dlpack__())
+    assert Z.flags.writable
+
+
+def test_dlpack_copy():
+    try:
+        X = dpt.arange(16, dtype="i4")
+    except dpctl.SyclDeviceCreationError:
+        pytest.skip("No SYCL devices available")
+    Y = dpt._dlpack.from_dlpack_capsule(
+        X.__dlpack__(max_version=(1, 0), copy=True)
+    )
+    assert X._pointer != Y._pointer
+    assert dpt.all(X == Y)
+    Z = dpt._dlpack.from_dlpack_capsule(
+        X.__dlpack__(max_version=(1, 0), copy=False)
+    )
+    assert X._pointer == Z._pointer
+
+
+def test_dlpack_to_host_device():
+    np = pytest.importorskip("numpy")
+    try:
+        X = dpt.arange(16, dtype="i4")
+    except dpctl.SyclDeviceCreationError:
+        pytest.skip("No SYCL devices available")
+    device_CPU = 1  # DLDeviceType.kDLCPU
+    with pytest.raises(BufferError):
+        X.__dlpack__(max_version=(1, 0), dl_device=(device_CPU, 0), copy=False)
+    if not hasattr(np, "from_dlpack"):
+        pytest.skip("NumPy does not support DLPack protocol")
+
+    class HostContainer:
+        def __init__(self, ary):
+            self._ary = ary
+
+        def __dlpack__(self, stream=None, max_version=None, **kwargs):
+            return self._ary.__dlpack__(
+                max_version=max_version, dl_device=(device_CPU, 0)
+            )
+
+        def __dlpack_device__(self):
+            return (device_CPU, 0)
+
+    Xnp = np.from_dlpack(HostContainer(X))
+    assert np.array_equal(Xnp, np.arange(16, dtype="i4"))
+
+
+def test_dlpack_exporter_stream_in_order():
+    try:
+        q1 = dpctl.SyclQueue(property="in_order")
+        q2 = dpctl.SyclQueue(q1.sycl_context, q1.sycl_device)
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Could not create queues")
+    X = dpt.ones((64,), dtype="u1", sycl_queue=q1)
+    caps = X.__dlpack__(stream=q2, max_version=(1, 0))
+    Y = dpt._dlpack.from_dlpack_capsule(caps)
+    assert dpt.all(Y == 1)
+
+
+def test_dlpack_exporter_stream_pending_writer():
+    try:
+        q1 = dpctl.SyclQueue()
+        q2 = dpctl.SyclQueue(q1.sycl_context, q1.sycl_device)
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Could not create queues")
+    X = dpt.empty((2**20,), dtype="i4", sycl_queue=q1)
+    # writer submitted to out-of-order queue without waiting for it
+    ht_ev, _ = ti._full_usm_ndarray(7, X, q1)
+    caps = X.__dlpack__(stream=q2, max_version=(1, 0))
+    Y = dpt._dlpack.from_dlpack_capsule(caps)
+    Z = dpt.asarray(Y, sycl_queue=q2, copy=True)
+    ht_ev.wait()
+    assert dpt.all(Z == 7)
+
+
 @pytest.mark.parametrize("shape", [tuple(), (2,), (3, 0, 1), (2, 2, 2)])
 def test_from_dlpack(shape, typestr, usm_type):
     all_root_devices = dpctl.get_devices()
@@ -178,3 +284,36 @@ def test_from_dlpack_input_validation():
 
     with pytest.raises(TypeError):
         dpt.from_dlpack(DummyWithMethod())
+
+
+def test_from_dlpack_host_tensor():
+    np = pytest.importorskip("numpy")
+    try:
+        cpu_dev = dpctl.select_cpu_device()
+    except dpctl.SyclDeviceCreationError:
+        pytest.skip("No CPU device available")
+    Xnp = np.arange(24, dtype="i4").reshape(4, 6)
+    if not hasattr(Xnp, "__dlpack__"):
+        pytest.skip("NumPy does not support DLPack protocol")
+    Y = dpt.from_dlpack(Xnp[:, ::2])
+    assert Y.sycl_device == cpu_dev
+    assert Y.usm_type == "host"
+    assert Y.shape == (4, 3)
+    assert np.array_equal(dpt.asnumpy(Y), Xnp[:, ::2])
+    if cpu_dev.has_aspect_usm_system_allocations:
+        # zero-copy view of NumPy array
+        Xnp[0, 0] = -1
+        assert int(Y[0, 0]) == -1
+
+
+def test_from_dlpack_host_tensor_non_cpu_device():
+    np = pytest.importorskip("numpy")
+    try:
+        gpu_dev = dpctl.select_gpu_device()
+    except dpctl.SyclDeviceCreationError:
+        pytest.skip("No GPU device available")
+    Xnp = np.ones(5, dtype="i4")
+    if not hasattr(Xnp, "__dlpack__"):
+        pytest.skip("NumPy does not support DLPack protocol")
+    with pytest.raises(BufferError):
+        dpt.from_dlpack(Xnp, device=gpu_dev)
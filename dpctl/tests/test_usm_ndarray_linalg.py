@@ -0,0 +1,268 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+import pytest
+
+import dpctl.tensor as dpt
+from dpctl.tests.helper import get_queue_or_skip, skip_if_dtype_not_supported
+
+_numeric_types = [
+    "i1",
+    "u1",
+    "i2",
+    "u2",
+    "i4",
+    "u4",
+    "i8",
+    "u8",
+    "f2",
+    "f4",
+    "f8",
+    "c8",
+    "c16",
+]
+
+
+def test_matrix_transpose():
+    get_queue_or_skip()
+
+    X = dpt.reshape(dpt.arange(2 * 3, dtype="i4"), (2, 3))
+    res = dpt.matrix_transpose(X)
+    expected_res = X.mT
+
+    assert expected_res.shape == res.shape
+    assert expected_res.flags["C"] == res.flags["C"]
+    assert expected_res.flags["F"] == res.flags["F"]
+    assert dpt.all(X.mT == res)
+
+
+def test_matrix_transpose_arg_validation():
+    get_queue_or_skip()
+
+    X = dpt.empty(5, dtype="i4")
+    with pytest.raises(ValueError):
+        dpt.matrix_transpose(X)
+
+    X = dict()
+    with pytest.raises(TypeError):
+        dpt.matrix_transpose(X)
+
+
+@pytest.mark.parametrize("dtype", _numeric_types)
+def test_matmul_simple(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    n, m = 100, 17
+    m1 = dpt.ones((m, n), dtype=dtype)
+    m2 = dpt.ones((n, m), dtype=dtype)
+
+    for k in [1, 2, 3, 4, 7, 8, 9, 15, 16, 17]:
+        r = dpt.matmul(m1[:k, :], m2[:, :k])
+        assert dpt.all(r == dpt.full((k, k), n, dtype=dtype))
+
+
+def test_matmul_bool():
+    get_queue_or_skip()
+
+    m1 = dpt.asarray([[True, False], [False, False]])
+    m2 = dpt.asarray([[False, True], [True, False]])
+    r = dpt.matmul(m1, m2)
+    assert r.dtype == dpt.bool
+    assert dpt.all(r == dpt.asarray([[False, True], [False, False]]))
+
+
+@pytest.mark.parametrize("dtype", ["i4", "f4", "c8"])
+def test_matmul_strided_and_batched(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    n0, n, k, m = 3, 33, 20, 45
+    x1_np = np.arange(n0 * n * k, dtype=dtype).reshape((n0, n, k)) % 7
+    x2_np = np.arange(k * 2 * m, dtype=dtype).reshape((k, 2 * m)) % 5
+
+    x1 = dpt.asarray(x1_np, sycl_queue=q)
+    x2 = dpt.asarray(x2_np, sycl_queue=q)
+
+    # broadcast stack dimension, transposed and strided operands
+    r = dpt.matmul(x1, x2[:, ::2])
+    expected = np.matmul(x1_np, x2_np[:, ::2])
+    assert r.shape == expected.shape
+    assert np.array_equal(dpt.asnumpy(r), expected)
+
+    r = dpt.matmul(dpt.matrix_transpose(x2[:, ::-2]), dpt.matrix_transpose(x1))
+    expected = np.matmul(x2_np[:, ::-2].T, np.swapaxes(x1_np, -1, -2))
+    assert r.shape == expected.shape
+    assert np.array_equal(dpt.asnumpy(r), expected)
+
+
+def test_matmul_vector_operands():
+    q = get_queue_or_skip()
+
+    x1_np = np.arange(12, dtype="i8").reshape((3, 4))
+    v_np = np.arange(4, dtype="i8")
+    x1 = dpt.asarray(x1_np, sycl_queue=q)
+    v = dpt.asarray(v_np, sycl_queue=q)
+
+    r = dpt.matmul(x1, v)
+    assert r.shape == (3,)
+    assert np.array_equal(dpt.asnumpy(r), x1_np @ v_np)
+
+    r = dpt.matmul(v[:3], x1)
+    assert r.shape == (4,)
+    assert np.array_equal(dpt.asnumpy(r), v_np[:3] @ x1_np)
+
+    r = v @ v
+    assert r.shape == tuple()
+    assert int(r) == int(v_np @ v_np)
+
+
+def test_matmul_type_promotion():
+    q = get_queue_or_skip()
+
+    x1 = dpt.ones((3, 4), dtype="i2", sycl_queue=q)
+    x2 = dpt.ones((4, 5), dtype="i4", sycl_queue=q)
+    r = dpt.matmul(x1, x2)
+    assert r.dtype == dpt.int32
+    assert dpt.all(r == 4)
+
+
+def test_matmul_empty():
+    get_queue_or_skip()
+
+    x1 = dpt.ones((3, 0), dtype="f4")
+    x2 = dpt.ones((0, 5), dtype="f4")
+    r = dpt.matmul(x1, x2)
+    assert r.shape == (3, 5)
+    assert dpt.all(r == 0)
+
+    x1 = dpt.ones((0, 2, 4), dtype="f4")
+    x2 = dpt.ones((4, 5), dtype="f4")
+    r = dpt.matmul(x1, x2)
+    assert r.shape == (0, 2, 5)
+
+
+def test_matmul_arg_validation():
+    get_queue_or_skip()
+
+    x1 = dpt.ones((3, 4), dtype="f4")
+    with pytest.raises(TypeError):
+        dpt.matmul(x1, dict())
+    with pytest.raises(ValueError):
+        dpt.matmul(x1, dpt.ones(tuple(), dtype="f4"))
+    with pytest.raises(ValueError):
+        dpt.matmul(x1, x1)
+    with pytest.raises(ValueError):
+        dpt.matmul(
+            dpt.ones((2, 3, 4), dtype="f4"), dpt.ones((3, 4, 5), dtype="f4")
+        )
+
+
+@pytest.mark.parametrize("dtype", ["i4", "f4", "c8"])
+def test_tensordot(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    x1_np = np.arange(2 * 3 * 4 * 5, dtype=dtype).reshape((2, 3, 4, 5)) % 3
+    x2_np = np.arange(4 * 5 * 6, dtype=dtype).reshape((4, 5, 6)) % 4
+    x1 = dpt.asarray(x1_np, sycl_queue=q)
+    x2 = dpt.asarray(x2_np, sycl_queue=q)
+
+    r = dpt.tensordot(x1, x2)
+    expected = np.tensordot(x1_np, x2_np)
+    assert r.shape == expected.shape
+    assert np.array_equal(dpt.asnumpy(r), expected)
+
+    r = dpt.tensordot(x1, x2, axes=((3, 2), (1, 0)))
+    expected = np.tensordot(x1_np, x2_np, axes=((3, 2), (1, 0)))
+    assert r.shape == expected.shape
+    assert np.array_equal(dpt.asnumpy(r), expected)
+
+    r = dpt.tensordot(x1, x2, axes=0)
+    expected = np.tensordot(x1_np, x2_np, axes=0)
+    assert r.shape == expected.shape
+    assert np.array_equal(dpt.asnumpy(r), expected)
+
+
+def test_tensordot_arg_validation():
+    get_queue_or_skip()
+
+    x1 = dpt.ones((2, 3), dtype="f4")
+    x2 = dpt.ones((3, 4), dtype="f4")
+    with pytest.raises(ValueError):
+        dpt.tensordot(x1, x2, axes=2)
+    with pytest.raises(ValueError):
+        dpt.tensordot(x1, x2, axes=-1)
+    with pytest.raises(ValueError):
+        dpt.tensordot(x1, x2, axes=((1,), (0, 1)))
+    with pytest.raises(ValueError):
+        dpt.tensordot(x1, x2, axes=((0,), (0,)))
+
+
+@pytest.mark.parametrize("dtype", _numeric_types)
+def test_vecdot_1d(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    for n in [1, 7, 63, 64, 65, 1024]:
+        v1 = dpt.ones(n, dtype=dtype)
+        v2 = dpt.ones(n, dtype=dtype)
+        r = dpt.vecdot(v1, v2)
+        assert r.shape == tuple()
+        assert r.dtype == v1.dtype
+        expected = np.dot(dpt.asnumpy(v1), dpt.asnumpy(v2))
+        assert dpt.asnumpy(r) == expected
+
+
+def test_vecdot_axis_and_broadcasting():
+    q = get_queue_or_skip()
+
+    x1_np = np.arange(3 * 4 * 5, dtype="i4").reshape((3, 4, 5))
+    x2_np = np.arange(4 * 1, dtype="i4").reshape((4, 1))
+    x1 = dpt.asarray(x1_np, sycl_queue=q)
+    x2 = dpt.asarray(x2_np, sycl_queue=q)
+
+    r = dpt.vecdot(x1, x2, axis=-2)
+    expected = np.sum(x1_np * x2_np, axis=-2)
+    assert r.shape == expected.shape
+    assert np.array_equal(dpt.asnumpy(r), expected)
+
+    r = dpt.vecdot(x1, dpt.ones(5, dtype="i4"))
+    assert np.array_equal(dpt.asnumpy(r), np.sum(x1_np, axis=-1))
+
+
+def test_vecdot_complex_conj():
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported("c8", q)
+
+    v1 = dpt.asarray([1 + 1j, 2 - 1j], dtype="c8", sycl_queue=q)
+    v2 = dpt.asarray([1j, 1], dtype="c8", sycl_queue=q)
+    r = dpt.vecdot(v1, v2)
+    expected = np.vdot(dpt.asnumpy(v1), dpt.asnumpy(v2))
+    assert np.allclose(dpt.asnumpy(r), expected)
+
+
+def test_vecdot_arg_validation():
+    get_queue_or_skip()
+
+    x1 = dpt.ones((2, 3), dtype="f4")
+    with pytest.raises(ValueError):
+        dpt.vecdot(x1, dpt.ones((2, 4), dtype="f4"))
+    with pytest.raises(ValueError):
+        dpt.vecdot(x1, dpt.ones(tuple(), dtype="f4"))
+    with pytest.raises(TypeError):
+        dpt.vecdot(x1, dict())
@@ -757,4 +757,36 @@ __dpctl_keep size_t *
 DPCTLDevice_GetSubGroupSizes(__dpctl_keep const DPCTLSyclDeviceRef DRef,
                              size_t *res_len);
 
+/*!
+ * @brief Wrapper over
+ * ``device.ext_oneapi_can_access_peer(peer, peer_access::access_supported)``.
+ *
+ * Peer access requires both devices to belong to the same platform. If the
+ * SYCL implementation does not support the ``sycl_ext_oneapi_peer_access``
+ * extension, the function returns false.
+ *
+ * @param    DRef           Opaque pointer to a ``sycl::device``
+ * @param    PDRef          Opaque pointer to the peer ``sycl::device``
+ * @return   True if kernels and copies submitted to device ``DRef`` can
+ *           access USM allocations of device ``PDRef`` once peer access
+ *           is enabled.
+ * @ingroup DeviceInterface
+ */
+DPCTL_API
+bool DPCTLDevice_CanAccessPeer(__dpctl_keep const DPCTLSyclDeviceRef DRef,
+                               __dpctl_keep const DPCTLSyclDeviceRef PDRef);
+
+/*!
+ * @brief Wrapper over ``device.ext_oneapi_enable_peer_access(peer)``.
+ *
+ * @param    DRef           Opaque pointer to a ``sycl::device``
+ * @param    PDRef          Opaque pointer to the peer ``sycl::device``
+ * @return   True if peer access of device ``DRef`` to USM allocations of
+ *           device ``PDRef`` was enabled, false otherwise.
+ * @ingroup DeviceInterface
+ */
+DPCTL_API
+bool DPCTLDevice_EnablePeerAccess(__dpctl_keep const DPCTLSyclDeviceRef DRef,
+                                  __dpctl_keep const DPCTLSyclDeviceRef PDRef);
+
 DPCTL_C_EXTERN_C_END
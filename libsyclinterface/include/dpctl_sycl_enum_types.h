@@ -102,7 +102,8 @@ typedef enum
     DPCTL_FLOAT,
     DPCTL_DOUBLE,
     DPCTL_LONG_DOUBLE,
-    DPCTL_VOID_PTR
+    DPCTL_VOID_PTR,
+    DPCTL_LOCAL_ACCESSOR
 } DPCTLKernelArgType;
 
 /*!
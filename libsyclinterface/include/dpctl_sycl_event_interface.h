@@ -71,6 +71,21 @@ void DPCTLEvent_Wait(__dpctl_keep DPCTLSyclEventRef ERef);
 DPCTL_API
 void DPCTLEvent_WaitAndThrow(__dpctl_keep DPCTLSyclEventRef ERef);
 
+/*!
+ * @brief C-API wrapper for ``sycl::event::wait_and_throw`` taking a list of
+ * events.
+ *
+ * Waits for all events in the vector with a single call into the SYCL
+ * runtime. Asynchronous errors are passed to the asynchronous handlers of
+ * the queues the events were submitted to.
+ *
+ * @param    EVRef          Opaque pointer to a vector of DPCTLSyclEventRef
+ *                          objects to wait for.
+ * @ingroup EventInterface
+ */
+DPCTL_API
+void DPCTLEvent_WaitForAll(__dpctl_keep DPCTLEventVectorRef EVRef);
+
 /*!
  * @brief Deletes the DPCTLSyclEventRef after casting it to a ``sycl::event``.
  *
@@ -85,6 +85,10 @@ __dpctl_give DPCTLSyclKernelBundleRef DPCTLKernelBundle_CreateFromOCLSource(
  * @brief Returns the SyclKernel with given name from the program, if not found
  * then return NULL.
  *
+ * The native kernel is created by the first look-up of the name, and is
+ * cached by the kernel bundle until it is deleted. Subsequent look-ups
+ * return copies of the cached kernel without calling into the driver.
+ *
  * @param    KBRef          Opaque pointer to a sycl::kernel_bundle
  * @param    KernelName     Name of kernel
  * @return   A SyclKernel reference if the kernel exists, else NULL
@@ -109,7 +113,8 @@ bool DPCTLKernelBundle_HasKernel(__dpctl_keep DPCTLSyclKernelBundleRef KBRef,
                                  __dpctl_keep const char *KernelName);
 
 /*!
- * @brief Frees the DPCTLSyclKernelBundleRef pointer.
+ * @brief Frees the DPCTLSyclKernelBundleRef pointer, and releases the kernels
+ * cached for it by DPCTLKernelBundle_GetKernel and DPCTLKernelBundle_HasKernel.
  *
  * @param   KBRef           Opaque pointer to a sycl::kernel_bundle
  * @ingroup KernelBundleInterface
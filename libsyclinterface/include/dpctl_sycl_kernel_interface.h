@@ -170,4 +170,40 @@ DPCTL_API
 uint32_t
 DPCTLKernel_GetCompileSubGroupSize(__dpctl_keep const DPCTLSyclKernelRef KRef);
 
+/*!
+ * @brief Suggests a local range for submitting the kernel to the device with
+ * the given global range.
+ *
+ * The suggested work-group size is a divisor of the global range in every
+ * dimension, does not exceed the maximal work-group size of the kernel on the
+ * device and is, when possible, a multiple of the preferred work-group size
+ * multiple of the kernel. It is chosen to be as large as possible while still
+ * producing at least one work-group per compute unit of the device. When
+ * work-groups use local memory, fewer of them can reside on a compute unit
+ * simultaneously, and the work-group size is raised so that these work-groups
+ * still occupy the compute unit. The contiguous (last) dimension of the range
+ * is assigned the largest extent of the work-group.
+ *
+ * @param   KRef           DPCTLSyclKernelRef pointer to an SYCL
+ *                         interoperability kernel.
+ * @param   DRef           DPCTLSyclDeviceRef pointer to the device the
+ *                         kernel is to be submitted to.
+ * @param   gRange         Global range of the kernel submission.
+ * @param   lRange         Array receiving the suggested local range.
+ * @param   NDims          Number of dimensions of gRange and lRange,
+ *                         between one and three.
+ * @param   LocalMemBytes  Number of bytes of local memory used by each
+ *                         work-group of the kernel.
+ * @return  True if a local range was written to lRange, false if the inputs
+ *          are invalid or the local memory exceeds the capacity of the device.
+ * @ingroup KernelInterface
+ */
+DPCTL_API
+bool DPCTLKernel_SuggestNDRange(__dpctl_keep const DPCTLSyclKernelRef KRef,
+                                __dpctl_keep const DPCTLSyclDeviceRef DRef,
+                                __dpctl_keep const size_t *gRange,
+                                size_t *lRange,
+                                size_t NDims,
+                                size_t LocalMemBytes);
+
 DPCTL_C_EXTERN_C_END
@@ -41,6 +41,28 @@ DPCTL_C_EXTERN_C_BEGIN
  * @defgroup QueueInterface Queue class C wrapper
  */
 
+/*!
+ * @brief Describes a local (work-group shared) memory kernel argument.
+ *
+ * A pointer to the struct is passed as the kernel argument whose type is
+ * ``DPCTL_LOCAL_ACCESSOR``. The submit functions then create a
+ * ``sycl::local_accessor`` with ``ndim`` dimensions of the given extents and
+ * element type for the argument. Only the first ``ndim`` extents are used.
+ *
+ * @ingroup QueueInterface
+ */
+typedef struct MDLocalAccessorTy
+{
+    /*! Number of dimensions of the accessor, between 1 and 3. */
+    size_t ndim;
+    /*! Type of elements of the accessor, a scalar type between
+     * ``DPCTL_CHAR`` and ``DPCTL_DOUBLE``. */
+    DPCTLKernelArgType dpctl_type_id;
+    size_t dim0;
+    size_t dim1;
+    size_t dim2;
+} MDLocalAccessor;
+
 /*!
  * @brief A wrapper for sycl::queue contructor to construct a new queue from the
  * provided context, device, async handler and propertis bit flags.
@@ -235,7 +257,10 @@ DPCTLQueue_SubmitRange(__dpctl_keep const DPCTLSyclKernelRef KRef,
  * @param    Args           An array of void* pointers that represent the
  *                          kernel arguments for the kernel.
  * @param    ArgTypes       An array of DPCTLKernelArgType enum values that
- *                          represent the type of each kernel argument.
+ *                          represent the type of each kernel argument. Local
+ *                          memory arguments have type DPCTL_LOCAL_ACCESSOR,
+ *                          and the corresponding Args element points to an
+ *                          MDLocalAccessor describing them.
  * @param    NArgs          Size of Args.
  * @param    gRange         Defines the overall dimension of the dispatch for
  *                          the kernel. The array can have up to three
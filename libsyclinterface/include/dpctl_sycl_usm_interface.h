@@ -180,4 +180,35 @@ DPCTL_API
 DPCTLSyclDeviceRef
 DPCTLUSM_GetPointerDevice(__dpctl_keep const DPCTLSyclUSMRef MRef,
                           __dpctl_keep const DPCTLSyclContextRef CRef);
+
+/*!
+ * @brief Initializes USM memory with zeros using kernels submitted to the
+ * given queues, so that its pages are first touched by the devices of the
+ * queues.
+ *
+ * Operating systems place memory pages on the NUMA node of the thread first
+ * touching them. For CPU devices, and sub-devices created by partitioning by
+ * affinity domain, this places the pages near the device which initialized
+ * them. The memory is split into chunks of ChunkSize bytes, assigned to the
+ * queues round-robin. If ChunkSize is zero, the memory is split into one
+ * contiguous block per queue instead, so that a single queue places all of
+ * the allocation. The function waits for the operations to complete.
+ *
+ * @param  MRef      USM pointer.
+ * @param  Size      Number of bytes of the allocation to initialize.
+ * @param  QRefs     Array of queues whose contexts can access the allocation.
+ * @param  NQRefs    Size of QRefs.
+ * @param  ChunkSize Number of bytes of chunks to interleave across queues, or
+ *                   zero.
+ *
+ * @return True if the memory was initialized, false otherwise.
+ * @ingroup USMInterface
+ */
+DPCTL_API
+bool DPCTLUSM_PlaceByFirstTouch(__dpctl_keep DPCTLSyclUSMRef MRef,
+                                size_t Size,
+                                __dpctl_keep const DPCTLSyclQueueRef *QRefs,
+                                size_t NQRefs,
+                                size_t ChunkSize);
+
 DPCTL_C_EXTERN_C_END
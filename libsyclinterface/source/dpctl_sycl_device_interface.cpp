@@ -775,3 +775,52 @@ DPCTLDevice_GetSubGroupSizes(__dpctl_keep const DPCTLSyclDeviceRef DRef,
     }
     return sizes;
 }
+
+bool DPCTLDevice_CanAccessPeer(__dpctl_keep const DPCTLSyclDeviceRef DRef,
+                               __dpctl_keep const DPCTLSyclDeviceRef PDRef)
+{
+    auto D = unwrap<device>(DRef);
+    auto PD = unwrap<device>(PDRef);
+    if (!(D && PD)) {
+        error_handler("Argument DRef or PDRef is null", __FILE__, __func__,
+                      __LINE__);
+        return false;
+    }
+#ifdef SYCL_EXT_ONEAPI_PEER_ACCESS
+    try {
+        if (D->get_platform() != PD->get_platform()) {
+            return false;
+        }
+        return D->ext_oneapi_can_access_peer(
+            *PD, sycl::ext::oneapi::peer_access::access_supported);
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+        return false;
+    }
+#else
+    return false;
+#endif
+}
+
+bool DPCTLDevice_EnablePeerAccess(__dpctl_keep const DPCTLSyclDeviceRef DRef,
+                                  __dpctl_keep const DPCTLSyclDeviceRef PDRef)
+{
+    auto D = unwrap<device>(DRef);
+    auto PD = unwrap<device>(PDRef);
+    if (!(D && PD)) {
+        error_handler("Argument DRef or PDRef is null", __FILE__, __func__,
+                      __LINE__);
+        return false;
+    }
+#ifdef SYCL_EXT_ONEAPI_PEER_ACCESS
+    try {
+        D->ext_oneapi_enable_peer_access(*PD);
+        return true;
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+        return false;
+    }
+#else
+    return false;
+#endif
+}
@@ -153,6 +153,147 @@ struct DeviceCacheBuilder
     }
 };
 
+/*!
+ * @brief Immutable table of root devices, in the order of
+ * ``sycl::device::get_devices()``, with precomputed ordinals of each device.
+ *
+ * Finding the position of a device previously required enumerating all
+ * devices and comparing them to the device, for each query. The table is
+ * built once, on first use, in a thread-safe manner, and is only read
+ * afterwards, so that the commonly used queries are hash table lookups.
+ */
+class DeviceIndexTable
+{
+public:
+    struct Entry
+    {
+        int backend_ty;
+        int device_ty;
+        bool ranked;
+        // position among ranked devices, among ranked devices with the same
+        // backend, with the same device type, and with both the same
+        // backend and device type
+        int overall_ordinal;
+        int backend_ordinal;
+        int device_type_ordinal;
+        int backend_and_device_type_ordinal;
+        // as computed by DPCTL_GetRelativeDeviceId
+        int64_t relative_id;
+    };
+
+    static const DeviceIndexTable &get()
+    {
+        static DeviceIndexTable *table = new DeviceIndexTable();
+        return *table;
+    }
+
+    const Entry *find(const device &D) const
+    {
+        auto it = positions_.find(D);
+        return (it == positions_.end()) ? nullptr : &entries_[it->second];
+    }
+
+    /*!
+     * @brief Position of the device among ranked devices matching the
+     * canonical device identifier, -1 if the device does not match it.
+     */
+    int position(const device &D, int device_identifier) const
+    {
+        constexpr int not_found = -1;
+        const Entry *E = find(D);
+        if (!E || !E->ranked)
+            return not_found;
+        if (!((device_identifier & E->backend_ty) &&
+              (device_identifier & E->device_ty)))
+            return not_found;
+
+        const int be_mask = device_identifier & DPCTL_ALL_BACKENDS;
+        const int dt_mask = device_identifier & ~DPCTL_ALL_BACKENDS;
+        const bool all_be = (be_mask == DPCTL_ALL_BACKENDS);
+        const bool all_dt = (dt_mask == DPCTL_ALL);
+        const bool same_be = (be_mask == E->backend_ty);
+        const bool same_dt = (dt_mask == E->device_ty);
+
+        if (all_be && all_dt)
+            return E->overall_ordinal;
+        if (same_be && all_dt)
+            return E->backend_ordinal;
+        if (all_be && same_dt)
+            return E->device_type_ordinal;
+        if (same_be && same_dt)
+            return E->backend_and_device_type_ordinal;
+
+        // identifier combining several, but not all, backends or device
+        // types, count matching devices preceding this one
+        int index = not_found;
+        for (const auto &Other : entries_) {
+            if (!Other.ranked)
+                continue;
+            if ((device_identifier & Other.backend_ty) &&
+                (device_identifier & Other.device_ty))
+            {
+                ++index;
+                if (&Other == E)
+                    return index;
+            }
+        }
+        return not_found;
+    }
+
+private:
+    std::vector<Entry> entries_;
+    std::unordered_map<device, size_t> positions_;
+
+    DeviceIndexTable()
+    {
+        std::vector<device> Devices;
+        try {
+            Devices = device::get_devices();
+        } catch (std::exception const &e) {
+            error_handler(e, __FILE__, __func__, __LINE__);
+            return;
+        }
+
+        dpctl_default_selector mRanker;
+        int overall_count = 0;
+        std::unordered_map<int, int> backend_counts;
+        std::unordered_map<int, int> device_type_counts;
+        std::unordered_map<int, int> backend_and_device_type_counts;
+
+        entries_.reserve(Devices.size());
+        for (const auto &D : Devices) {
+            Entry E{};
+            try {
+                E.backend_ty = DPCTL_SyclBackendToDPCTLBackendType(
+                    D.get_platform().get_backend());
+                E.device_ty = DPCTL_SyclDeviceTypeToDPCTLDeviceType(
+                    D.get_info<info::device::device_type>());
+                E.ranked = (mRanker(D) >= 0);
+                E.relative_id = DPCTL_GetRelativeDeviceId(D);
+            } catch (std::exception const &e) {
+                error_handler(e, __FILE__, __func__, __LINE__);
+                continue;
+            }
+            if (E.ranked) {
+                E.overall_ordinal = overall_count++;
+                E.backend_ordinal = backend_counts[E.backend_ty]++;
+                E.device_type_ordinal = device_type_counts[E.device_ty]++;
+                E.backend_and_device_type_ordinal =
+                    backend_and_device_type_counts[E.backend_ty |
+                                                   E.device_ty]++;
+            }
+            else {
+                E.overall_ordinal = -1;
+                E.backend_ordinal = -1;
+                E.device_type_ordinal = -1;
+                E.backend_and_device_type_ordinal = -1;
+            }
+            positions_.emplace(D, entries_.size());
+            entries_.push_back(E);
+        }
+    }
+};
+
 } // namespace
 
 #undef EL
@@ -275,25 +416,9 @@ int DPCTLDeviceMgr_GetPositionInDevices(__dpctl_keep DPCTLSyclDeviceRef DRef,
     if (!device_identifier)
         return not_found;
 
-    const auto &root_devices = device::get_devices();
-    dpctl_default_selector mRanker;
-    int index = not_found;
     const auto &reference_device = *(unwrap<device>(DRef));
-
-    for (const auto &root_device : root_devices) {
-        if (mRanker(root_device) < 0)
-            continue;
-        auto Bty(DPCTL_SyclBackendToDPCTLBackendType(
-            root_device.get_platform().get_backend()));
-        auto Dty(DPCTL_SyclDeviceTypeToDPCTLDeviceType(
-            root_device.get_info<info::device::device_type>()));
-        if ((device_identifier & Bty) && (device_identifier & Dty)) {
-            ++index;
-            if (root_device == reference_device)
-                return index;
-        }
-    }
-    return not_found;
+    return DeviceIndexTable::get().position(reference_device,
+                                            device_identifier);
 }
 
 /*!
@@ -349,8 +474,13 @@ int64_t DPCTLDeviceMgr_GetRelativeId(__dpctl_keep const DPCTLSyclDeviceRef DRef)
 {
     auto Device = unwrap<device>(DRef);
 
-    if (Device)
+    if (Device) {
+        const auto *E = DeviceIndexTable::get().find(*Device);
+        if (E)
+            return E->relative_id;
+        // sub-devices are not in the table of root devices
         return DPCTL_GetRelativeDeviceId(*Device);
+    }
 
     return -1;
 }
@@ -98,6 +98,29 @@ void DPCTLEvent_WaitAndThrow(__dpctl_keep DPCTLSyclEventRef ERef)
     }
 }
 
+void DPCTLEvent_WaitForAll(__dpctl_keep DPCTLEventVectorRef EVRef)
+{
+    auto EventRefs = unwrap<std::vector<DPCTLSyclEventRef>>(EVRef);
+    if (!EventRefs) {
+        error_handler("Cannot wait for events. DPCTLEventVectorRef as input "
+                      "is a nullptr.",
+                      __FILE__, __func__, __LINE__);
+        return;
+    }
+    try {
+        std::vector<event> Events;
+        Events.reserve(EventRefs->size());
+        for (auto ERef : *EventRefs) {
+            auto SyclEvent = unwrap<event>(ERef);
+            if (SyclEvent)
+                Events.push_back(*SyclEvent);
+        }
+        event::wait_and_throw(Events);
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+    }
+}
+
 void DPCTLEvent_Delete(__dpctl_take DPCTLSyclEventRef ERef)
 {
     delete unwrap<event>(ERef);
@@ -37,7 +37,12 @@
 #else
 #include <CL/sycl/backend/opencl.hpp>
 #endif
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
 
 #ifdef DPCTL_ENABLE_L0_PROGRAM_CREATION
 // Note: include ze_api.h before level_zero.hpp. Make sure clang-format does
@@ -80,6 +85,58 @@ static const int clLibLoadFlags = 0;
 
 constexpr backend cl_be = backend::opencl;
 
+/*! @brief Kernels obtained from executable kernel bundles, keyed by the
+ * bundle and the kernel name.
+ *
+ * Creating a kernel from the native programs of a bundle is a driver call,
+ * and each created kernel holds native resources. Kernels are hence created
+ * once per bundle and name, and callers receive copies of the cached kernel.
+ * Entries of a bundle are released by DPCTLKernelBundle_Delete.
+ */
+class kernel_name_cache
+{
+public:
+    static kernel_name_cache &get()
+    {
+        // Intentionally leaked: kernels must not be released after the SYCL
+        // runtime has been unloaded at exit
+        static kernel_name_cache *cache = new kernel_name_cache();
+        return *cache;
+    }
+
+    std::unique_ptr<kernel> find(const void *kb, const std::string &name)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto kb_it = cache_.find(kb);
+        if (kb_it != cache_.end()) {
+            auto it = kb_it->second.find(name);
+            if (it != kb_it->second.end()) {
+                return std::make_unique<kernel>(it->second);
+            }
+        }
+        return nullptr;
+    }
+
+    void insert(const void *kb, const std::string &name, const kernel &k)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        cache_[kb].emplace(name, k);
+    }
+
+    void erase(const void *kb)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        cache_.erase(kb);
+    }
+
+private:
+    std::mutex mu_;
+    std::unordered_map<const void *, std::unordered_map<std::string, kernel>>
+        cache_;
+
+    kernel_name_cache() = default;
+};
+
 struct cl_loader
 {
 public:
@@ -160,6 +217,16 @@ clCreateKernelFT get_clCreateKernel()
     return st_clCreateKernelF;
 }
 
+typedef cl_int (*clReleaseKernelFT)(cl_kernel);
+const char *clReleaseKernel_Name = "clReleaseKernel";
+clReleaseKernelFT get_clReleaseKernel()
+{
+    static auto st_clReleaseKernelF =
+        cl_loader::get().getSymbol<clReleaseKernelFT>(clReleaseKernel_Name);
+
+    return st_clReleaseKernelF;
+}
+
 std::string _GetErrorCode_ocl_impl(cl_int code)
 {
     switch (code) {
@@ -267,69 +334,40 @@ _CreateKernelBundleWithIL_ocl_impl(const context &ctx,
                                                CompileOpts);
 }
 
-bool _HasKernel_ocl_impl(const kernel_bundle<bundle_state::executable> &kb,
-                         const char *kernel_name)
+/*! @brief Creates kernel from the first program of the bundle defining
+ * kernel_name, returns nullptr if no program defines it. */
+std::unique_ptr<kernel>
+_CreateKernel_ocl_impl(const kernel_bundle<bundle_state::executable> &kb,
+                       const char *kernel_name)
 {
     auto clCreateKernelF = get_clCreateKernel();
-    if (clCreateKernelF == nullptr) {
-        return false;
-    }
-
-    std::vector<cl_program> oclKB = get_native<cl_be>(kb);
-
-    bool found = false;
-    for (auto &cl_pr : oclKB) {
-        cl_int create_kernel_err_code = CL_SUCCESS;
-        [[maybe_unused]] cl_kernel try_kern =
-            clCreateKernelF(cl_pr, kernel_name, &create_kernel_err_code);
-        if (create_kernel_err_code == CL_SUCCESS) {
-            found = true;
-            break;
-        }
-    }
-    return found;
-}
-
-__dpctl_give DPCTLSyclKernelRef
-_GetKernel_ocl_impl(const kernel_bundle<bundle_state::executable> &kb,
-                    const char *kernel_name)
-{
-    auto clCreateKernelF = get_clCreateKernel();
-    if (clCreateKernelF == nullptr) {
+    auto clReleaseKernelF = get_clReleaseKernel();
+    if (clCreateKernelF == nullptr || clReleaseKernelF == nullptr) {
         return nullptr;
     }
 
     std::vector<cl_program> oclKB = get_native<cl_be>(kb);
 
-    bool found = false;
-    cl_kernel ocl_kernel_from_kb;
     for (auto &cl_pr : oclKB) {
         cl_int create_kernel_err_code = CL_SUCCESS;
         cl_kernel try_kern =
             clCreateKernelF(cl_pr, kernel_name, &create_kernel_err_code);
         if (create_kernel_err_code == CL_SUCCESS) {
-            found = true;
-            ocl_kernel_from_kb = try_kern;
-            break;
-        }
-    }
-    if (found) {
-        try {
-            context ctx = kb.get_context();
-
-            kernel interop_kernel = make_kernel<cl_be>(ocl_kernel_from_kb, ctx);
-
-            return wrap<kernel>(new kernel(interop_kernel));
-        } catch (std::exception const &e) {
-            error_handler(e, __FILE__, __func__, __LINE__);
-            return nullptr;
+            std::unique_ptr<kernel> interop_kernel;
+            try {
+                context ctx = kb.get_context();
+                interop_kernel = std::make_unique<kernel>(
+                    make_kernel<cl_be>(try_kern, ctx));
+            } catch (...) {
+                clReleaseKernelF(try_kern);
+                throw;
+            }
+            // the SYCL kernel retains the OpenCL kernel
+            clReleaseKernelF(try_kern);
+            return interop_kernel;
         }
     }
-    else {
-        error_handler("Kernel " + std::string(kernel_name) + " not found.",
-                      __FILE__, __func__, __LINE__);
-        return nullptr;
-    }
+    return nullptr;
 }
 
 #ifdef DPCTL_ENABLE_L0_PROGRAM_CREATION
@@ -488,9 +526,11 @@ _CreateKernelBundleWithIL_ze_impl(const context &SyclCtx,
     }
 }
 
-__dpctl_give DPCTLSyclKernelRef
-_GetKernel_ze_impl(const kernel_bundle<bundle_state::executable> &kb,
-                   const char *kernel_name)
+/*! @brief Creates kernel from the first module of the bundle defining
+ * kernel_name, returns nullptr if no module defines it. */
+std::unique_ptr<kernel>
+_CreateKernel_ze_impl(const kernel_bundle<bundle_state::executable> &kb,
+                      const char *kernel_name)
 {
     auto zeKernelCreateFn = get_zeKernelCreate();
     if (zeKernelCreateFn == nullptr) {
@@ -500,25 +540,23 @@ _GetKernel_ze_impl(const kernel_bundle<bundle_state::executable> &kb,
     }
 
     auto ZeKernelBundle = sycl::get_native<ze_be>(kb);
-    bool found = false;
 
     // Populate the Level Zero kernel descriptions
     ze_kernel_desc_t ZeKernelDescr = {ZE_STRUCTURE_TYPE_KERNEL_DESC, nullptr,
                                       0, // flags
                                       kernel_name};
 
-    std::unique_ptr<sycl::kernel> syclInteropKern_ptr;
     ze_kernel_handle_t ZeKern;
     for (auto &ZeM : ZeKernelBundle) {
         ze_result_t ze_status = zeKernelCreateFn(ZeM, &ZeKernelDescr, &ZeKern);
 
         if (ze_status == ZE_RESULT_SUCCESS) {
-            found = true;
             auto ctx = kb.get_context();
+            // the SYCL kernel takes ownership of the Level Zero kernel
             auto k = make_kernel<ze_be>(
-                {kb, ZeKern, ext::oneapi::level_zero::ownership::keep}, ctx);
-            syclInteropKern_ptr = std::unique_ptr<kernel>(new kernel(k));
-            break;
+                {kb, ZeKern, ext::oneapi::level_zero::ownership::transfer},
+                ctx);
+            return std::make_unique<kernel>(k);
         }
         else {
             if (ze_status != ZE_RESULT_ERROR_INVALID_KERNEL_NAME) {
@@ -530,57 +568,46 @@ _GetKernel_ze_impl(const kernel_bundle<bundle_state::executable> &kb,
         }
     }
 
-    if (found) {
-        return wrap<kernel>(new kernel(*syclInteropKern_ptr));
-    }
-    else {
-        error_handler("Kernel named " + std::string(kernel_name) +
-                          " could not be found.",
-                      __FILE__, __func__, __LINE__);
-        return nullptr;
-    }
+    return nullptr;
 }
 
-bool _HasKernel_ze_impl(const kernel_bundle<bundle_state::executable> &kb,
-                        const char *kernel_name)
+#endif /* #ifdef DPCTL_ENABLE_L0_PROGRAM_CREATION */
+
+/*! @brief Returns copy of the kernel of the bundle named kernel_name, which is
+ * only created by the first look-up. Returns nullptr if the bundle does not
+ * define such a kernel. */
+std::unique_ptr<kernel>
+_GetCachedKernel_impl(const kernel_bundle<bundle_state::executable> &kb,
+                      const char *kernel_name)
 {
-    auto zeKernelCreateFn = get_zeKernelCreate();
-    if (zeKernelCreateFn == nullptr) {
-        error_handler("Could not load zeKernelCreate function.", __FILE__,
-                      __func__, __LINE__);
-        return false;
+    auto &cache = kernel_name_cache::get();
+    std::unique_ptr<kernel> k = cache.find(&kb, kernel_name);
+    if (k) {
+        return k;
     }
 
-    auto ZeKernelBundle = sycl::get_native<ze_be>(kb);
-
-    // Populate the Level Zero kernel descriptions
-    ze_kernel_desc_t ZeKernelDescr = {ZE_STRUCTURE_TYPE_KERNEL_DESC, nullptr,
-                                      0, // flags
-                                      kernel_name};
-
-    std::unique_ptr<sycl::kernel> syclInteropKern_ptr;
-    ze_kernel_handle_t ZeKern;
-    for (auto &ZeM : ZeKernelBundle) {
-        ze_result_t ze_status = zeKernelCreateFn(ZeM, &ZeKernelDescr, &ZeKern);
-
-        if (ze_status == ZE_RESULT_SUCCESS) {
-            return true;
-        }
-        else {
-            if (ze_status != ZE_RESULT_ERROR_INVALID_KERNEL_NAME) {
-                error_handler("zeKernelCreate failed: " +
-                                  _GetErrorCode_ze_impl(ze_status),
-                              __FILE__, __func__, __LINE__);
-                return false;
-            }
-        }
+    sycl::backend be = kb.get_backend();
+    switch (be) {
+    case sycl::backend::opencl:
+        k = _CreateKernel_ocl_impl(kb, kernel_name);
+        break;
+    case sycl::backend::ext_oneapi_level_zero:
+#ifdef DPCTL_ENABLE_L0_PROGRAM_CREATION
+        k = _CreateKernel_ze_impl(kb, kernel_name);
+        break;
+#endif
+    default:
+        throw std::runtime_error("Backend " +
+                                 std::to_string(static_cast<int>(be)) +
+                                 " is not supported.");
     }
 
-    return false;
+    if (k) {
+        cache.insert(&kb, kernel_name, *k);
+    }
+    return k;
 }
 
-#endif /* #ifdef DPCTL_ENABLE_L0_PROGRAM_CREATION */
-
 } /* end of anonymous namespace */
 
 __dpctl_give DPCTLSyclKernelBundleRef
@@ -696,18 +723,16 @@ DPCTLKernelBundle_GetKernel(__dpctl_keep DPCTLSyclKernelBundleRef KBRef,
         return nullptr;
     }
     auto SyclKB = unwrap<kernel_bundle<bundle_state::executable>>(KBRef);
-    sycl::backend be = SyclKB->get_backend();
-    switch (be) {
-    case sycl::backend::opencl:
-        return _GetKernel_ocl_impl(*SyclKB, KernelName);
-    case sycl::backend::ext_oneapi_level_zero:
-#ifdef DPCTL_ENABLE_L0_PROGRAM_CREATION
-        return _GetKernel_ze_impl(*SyclKB, KernelName);
-#endif
-    default:
-        error_handler("Backend " + std::to_string(static_cast<int>(be)) +
-                          " is not supported.",
-                      __FILE__, __func__, __LINE__);
+    try {
+        auto SyclKernel = _GetCachedKernel_impl(*SyclKB, KernelName);
+        if (!SyclKernel) {
+            error_handler("Kernel " + std::string(KernelName) + " not found.",
+                          __FILE__, __func__, __LINE__);
+            return nullptr;
+        }
+        return wrap<kernel>(SyclKernel.release());
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
         return nullptr;
     }
 }
@@ -726,25 +751,23 @@ bool DPCTLKernelBundle_HasKernel(__dpctl_keep DPCTLSyclKernelBundleRef KBRef,
     }
 
     auto SyclKB = unwrap<kernel_bundle<bundle_state::executable>>(KBRef);
-    sycl::backend be = SyclKB->get_backend();
-    switch (be) {
-    case sycl::backend::opencl:
-        return _HasKernel_ocl_impl(*SyclKB, KernelName);
-    case sycl::backend::ext_oneapi_level_zero:
-#ifdef DPCTL_ENABLE_L0_PROGRAM_CREATION
-        return _HasKernel_ze_impl(*SyclKB, KernelName);
-#endif
-    default:
-        error_handler("Backend " + std::to_string(static_cast<int>(be)) +
-                          " is not supported.",
-                      __FILE__, __func__, __LINE__);
+    try {
+        // the kernel created by the look-up is retained by the cache, and is
+        // returned by subsequent calls to DPCTLKernelBundle_GetKernel
+        return _GetCachedKernel_impl(*SyclKB, KernelName) != nullptr;
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
         return false;
     }
 }
 
 void DPCTLKernelBundle_Delete(__dpctl_take DPCTLSyclKernelBundleRef KBRef)
 {
-    delete unwrap<kernel_bundle<bundle_state::executable>>(KBRef);
+    auto SyclKB = unwrap<kernel_bundle<bundle_state::executable>>(KBRef);
+    if (SyclKB) {
+        kernel_name_cache::get().erase(SyclKB);
+    }
+    delete SyclKB;
 }
 
 __dpctl_give DPCTLSyclKernelBundleRef
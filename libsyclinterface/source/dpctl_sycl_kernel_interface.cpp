@@ -30,6 +30,7 @@
 #include "dpctl_string_utils.hpp"
 #include "dpctl_sycl_type_casters.hpp"
 #include <CL/sycl.hpp> /* Sycl headers */
+#include <algorithm>
 #include <cstdint>
 
 using namespace sycl;
@@ -40,6 +41,24 @@ static_assert(__SYCL_COMPILER_VERSION >= __SYCL_COMPILER_VERSION_REQUIRED,
               "The compiler does not meet minimum version requirement");
 
 using namespace dpctl::syclinterface;
+
+/*!
+ * @brief Largest divisor of n not exceeding bound, preferring divisors that
+ * are multiples of multiple.
+ */
+size_t largest_divisor(size_t n, size_t bound, size_t multiple)
+{
+    size_t best = 1;
+    for (size_t d = std::min(n, bound); d > 1; --d) {
+        if (n % d == 0) {
+            if (d % multiple == 0)
+                return d;
+            best = std::max(best, d);
+        }
+    }
+    return best;
+}
+
 } // end of anonymous namespace
 
 size_t DPCTLKernel_GetNumArgs(__dpctl_keep const DPCTLSyclKernelRef KRef)
@@ -231,3 +250,80 @@ DPCTLKernel_GetCompileSubGroupSize(__dpctl_keep const DPCTLSyclKernelRef KRef)
                 devs[0]);
     return static_cast<uint32_t>(v);
 }
+
+bool DPCTLKernel_SuggestNDRange(__dpctl_keep const DPCTLSyclKernelRef KRef,
+                                __dpctl_keep const DPCTLSyclDeviceRef DRef,
+                                __dpctl_keep const size_t *gRange,
+                                size_t *lRange,
+                                size_t NDims,
+                                size_t LocalMemBytes)
+{
+    auto sycl_kern = unwrap<kernel>(KRef);
+    auto dev = unwrap<device>(DRef);
+    if (!sycl_kern || !dev || !gRange || !lRange) {
+        error_handler("Input DPCTKSyclKernelRef, DPCTLSyclDeviceRef or a "
+                      "range is nullptr.",
+                      __FILE__, __func__, __LINE__);
+        return false;
+    }
+    if (NDims < 1 || NDims > 3) {
+        error_handler("Range must have between one and three dimensions.",
+                      __FILE__, __func__, __LINE__);
+        return false;
+    }
+
+    try {
+        size_t max_wg = std::min(
+            sycl_kern->get_info<info::kernel_device_specific::work_group_size>(
+                *dev),
+            dev->get_info<info::device::max_work_group_size>());
+        size_t pref_mult = std::max<size_t>(
+            sycl_kern->get_info<info::kernel_device_specific::
+                                    preferred_work_group_size_multiple>(*dev),
+            1);
+        size_t n_cu = std::max<uint32_t>(
+            dev->get_info<info::device::max_compute_units>(), 1);
+        size_t local_mem_size = dev->get_info<info::device::local_mem_size>();
+
+        if (LocalMemBytes > local_mem_size) {
+            error_handler("Local memory of the work-group exceeds the local "
+                          "memory size of the device.",
+                          __FILE__, __func__, __LINE__);
+            return false;
+        }
+
+        size_t total = 1;
+        for (size_t i = 0; i < NDims; ++i) {
+            if (gRange[i] == 0) {
+                error_handler("Global range must not have zero extents.",
+                              __FILE__, __func__, __LINE__);
+                return false;
+            }
+            total *= gRange[i];
+        }
+
+        // Spread work-groups over all compute units, but keep each compute
+        // unit occupied when local memory limits the number of work-groups
+        // residing on it to groups_per_cu
+        size_t wg_bound = std::max<size_t>(total / n_cu, 1);
+        if (LocalMemBytes > 0) {
+            size_t groups_per_cu = local_mem_size / LocalMemBytes;
+            size_t wg_lower = (max_wg + groups_per_cu - 1) / groups_per_cu;
+            wg_bound = std::max(wg_bound, wg_lower);
+        }
+        wg_bound = std::min(wg_bound, max_wg);
+        if (wg_bound > pref_mult)
+            wg_bound -= wg_bound % pref_mult;
+
+        // Fill the work-group starting from the contiguous dimension
+        for (size_t i = NDims; i-- > 0;) {
+            lRange[i] = largest_divisor(gRange[i], wg_bound, pref_mult);
+            wg_bound /= lRange[i];
+            pref_mult = 1;
+        }
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+        return false;
+    }
+    return true;
+}
@@ -50,6 +50,102 @@ typedef struct complex
     uint64_t imag;
 } complexNumber;
 
+template <typename T>
+void set_local_accessor_arg(handler &cgh,
+                            size_t idx,
+                            const MDLocalAccessor *mdstruct)
+{
+    switch (mdstruct->ndim) {
+    case 1:
+    {
+        auto la = local_accessor<T, 1>(range<1>(mdstruct->dim0), cgh);
+        cgh.set_arg(idx, la);
+        break;
+    }
+    case 2:
+    {
+        auto la = local_accessor<T, 2>(
+            range<2>(mdstruct->dim0, mdstruct->dim1), cgh);
+        cgh.set_arg(idx, la);
+        break;
+    }
+    case 3:
+    {
+        auto la = local_accessor<T, 3>(
+            range<3>(mdstruct->dim0, mdstruct->dim1, mdstruct->dim2), cgh);
+        cgh.set_arg(idx, la);
+        break;
+    }
+    default:
+        throw std::invalid_argument(
+            "Local accessor must have between one and three dimensions.");
+    }
+}
+
+/*!
+ * @brief Sets a sycl::local_accessor described by the MDLocalAccessor struct
+ * as the kernel argument at position idx.
+ *
+ * @param    cgh            The handler of the command group.
+ * @param    idx            Position of the argument.
+ * @param    mdstruct       Dimensions and element type of the accessor.
+ * @return   False if the element type is not supported, true otherwise.
+ */
+bool set_local_accessor_arg(handler &cgh,
+                            size_t idx,
+                            const MDLocalAccessor *mdstruct)
+{
+    switch (mdstruct->dpctl_type_id) {
+    case DPCTL_CHAR:
+        set_local_accessor_arg<char>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_SIGNED_CHAR:
+        set_local_accessor_arg<signed char>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_UNSIGNED_CHAR:
+        set_local_accessor_arg<unsigned char>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_SHORT:
+        set_local_accessor_arg<short>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_INT:
+        set_local_accessor_arg<int>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_UNSIGNED_INT:
+        set_local_accessor_arg<unsigned int>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_UNSIGNED_INT8:
+        set_local_accessor_arg<uint8_t>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_LONG:
+        set_local_accessor_arg<long>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_UNSIGNED_LONG:
+        set_local_accessor_arg<unsigned long>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_LONG_LONG:
+        set_local_accessor_arg<long long>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_UNSIGNED_LONG_LONG:
+        set_local_accessor_arg<unsigned long long>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_SIZE_T:
+        set_local_accessor_arg<size_t>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_FLOAT:
+        set_local_accessor_arg<float>(cgh, idx, mdstruct);
+        break;
+    case DPCTL_DOUBLE:
+        set_local_accessor_arg<double>(cgh, idx, mdstruct);
+        break;
+    default:
+        error_handler("Unsupported element type of local accessor.", __FILE__,
+                      __func__, __LINE__);
+        return false;
+    }
+    return true;
+}
+
 /*!
  * @brief Set the kernel arg object
  *
@@ -112,6 +208,9 @@ bool set_kernel_arg(handler &cgh,
     case DPCTL_VOID_PTR:
         cgh.set_arg(idx, Arg);
         break;
+    case DPCTL_LOCAL_ACCESSOR:
+        arg_set = set_local_accessor_arg(cgh, idx, (MDLocalAccessor *)Arg);
+        break;
     default:
         arg_set = false;
         error_handler("Kernel argument could not be created.", __FILE__,
@@ -30,9 +30,13 @@
 #include "dpctl_sycl_device_interface.h"
 #include "dpctl_sycl_type_casters.hpp"
 #include <CL/sycl.hpp> /* SYCL headers   */
+#include <algorithm>
+#include <vector>
 
 using namespace sycl;
 
+class DPCTLUSM_FirstTouchKernel;
+
 namespace
 {
 static_assert(__SYCL_COMPILER_VERSION >= __SYCL_COMPILER_VERSION_REQUIRED,
@@ -225,3 +229,64 @@ DPCTLUSM_GetPointerDevice(__dpctl_keep const DPCTLSyclUSMRef MRef,
 
     return wrap<device>(new device(Dev));
 }
+
+bool DPCTLUSM_PlaceByFirstTouch(__dpctl_keep DPCTLSyclUSMRef MRef,
+                                size_t Size,
+                                __dpctl_keep const DPCTLSyclQueueRef *QRefs,
+                                size_t NQRefs,
+                                size_t ChunkSize)
+{
+    if (!MRef) {
+        error_handler("Input MRef is nullptr.", __FILE__, __func__, __LINE__);
+        return false;
+    }
+    if (!QRefs || NQRefs == 0) {
+        error_handler("Input QRefs is nullptr or empty.", __FILE__, __func__,
+                      __LINE__);
+        return false;
+    }
+
+    auto Ptr = static_cast<char *>(unwrap<void>(MRef));
+    std::vector<queue *> Queues;
+    Queues.reserve(NQRefs);
+    for (size_t i = 0; i < NQRefs; ++i) {
+        auto Q = unwrap<queue>(QRefs[i]);
+        if (!Q) {
+            error_handler("Input QRefs contains a nullptr.", __FILE__,
+                          __func__, __LINE__);
+            return false;
+        }
+        if (get_pointer_type(Ptr, Q->get_context()) == usm::alloc::unknown) {
+            error_handler("USM pointer is not accessible from the context "
+                          "of a queue in QRefs.",
+                          __FILE__, __func__, __LINE__);
+            return false;
+        }
+        Queues.push_back(Q);
+    }
+    if (ChunkSize == 0) {
+        ChunkSize = (Size + NQRefs - 1) / NQRefs;
+    }
+
+    try {
+        std::vector<event> Events;
+        for (size_t offset = 0, i = 0; offset < Size; offset += ChunkSize) {
+            size_t n = std::min(ChunkSize, Size - offset);
+            char *ChunkPtr = Ptr + offset;
+            // Zero the chunk in a kernel, rather than with queue::memset,
+            // so that its pages are first touched by the threads of the
+            // queue's device even when the runtime implements memset on
+            // the host.
+            Events.push_back(Queues[i]->submit([&](handler &cgh) {
+                cgh.parallel_for<DPCTLUSM_FirstTouchKernel>(
+                    range<1>{n}, [=](id<1> idx) { ChunkPtr[idx] = 0; });
+            }));
+            i = (i + 1) % NQRefs;
+        }
+        event::wait(Events);
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+        return false;
+    }
+    return true;
+}
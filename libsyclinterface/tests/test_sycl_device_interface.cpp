@@ -227,6 +227,12 @@ TEST_P(TestDPCTLSyclDeviceInterface, ChkGetPlatform)
     EXPECT_NO_FATAL_FAILURE(DPCTLPlatform_Delete(PRef));
 }
 
+TEST_P(TestDPCTLSyclDeviceInterface, ChkCanAccessPeer)
+{
+    // a device is not its own peer, and the query must not fail
+    EXPECT_NO_FATAL_FAILURE(DPCTLDevice_CanAccessPeer(DRef, DRef));
+}
+
 TEST_P(TestDPCTLSyclDeviceInterface, ChkIsAccelerator)
 {
     EXPECT_NO_FATAL_FAILURE(DPCTLDevice_IsAccelerator(DRef));
@@ -849,6 +855,22 @@ TEST_F(TestDPCTLSyclDeviceNullArgs, ChkGetGlobalMemCacheType)
     ASSERT_TRUE(res == DPCTL_MEM_CACHE_TYPE_INDETERMINATE);
 }
 
+TEST_F(TestDPCTLSyclDeviceNullArgs, ChkCanAccessPeer)
+{
+    bool res = true;
+    EXPECT_NO_FATAL_FAILURE(
+        res = DPCTLDevice_CanAccessPeer(Null_DRef, Null_DRef));
+    ASSERT_FALSE(res);
+}
+
+TEST_F(TestDPCTLSyclDeviceNullArgs, ChkEnablePeerAccess)
+{
+    bool res = true;
+    EXPECT_NO_FATAL_FAILURE(
+        res = DPCTLDevice_EnablePeerAccess(Null_DRef, Null_DRef));
+    ASSERT_FALSE(res);
+}
+
 TEST_F(TestDPCTLSyclDeviceNullArgs, ChkGetSubGroupSizes)
 {
     size_t *sg_sizes = nullptr;
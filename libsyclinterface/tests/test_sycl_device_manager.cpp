@@ -283,6 +283,26 @@ TEST_P(TestDPCTLGetDevicesOrdering, ChkConsistencyWithFilterSelector)
     }
 }
 
+TEST_P(TestDPCTLGetDevicesOrdering, ChkPositionWithCombinedMask)
+{
+    const int combined_mask =
+        DPCTL_ACCELERATOR | DPCTL_GPU | DPCTL_CPU | DPCTL_ALL_BACKENDS;
+    for (auto i = 0ul; i < nDevices; ++i) {
+        DPCTLSyclDeviceRef DRef = nullptr;
+        int j = -1, k = -1;
+        EXPECT_NO_FATAL_FAILURE(DRef = DPCTLDeviceVector_GetAt(DV, i));
+        EXPECT_NO_FATAL_FAILURE(
+            j = DPCTLDeviceMgr_GetPositionInDevices(DRef, device_type_mask));
+        EXPECT_TRUE(i == static_cast<decltype(i)>(j));
+        EXPECT_NO_FATAL_FAILURE(
+            k = DPCTLDeviceMgr_GetPositionInDevices(DRef, combined_mask));
+        EXPECT_TRUE(k >= j);
+        EXPECT_TRUE(k == DPCTLDeviceMgr_GetPositionInDevices(DRef,
+                                                             combined_mask));
+        EXPECT_NO_FATAL_FAILURE(DPCTLDevice_Delete(DRef));
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     GetDevices,
     TestDPCTLGetDevicesOrdering,
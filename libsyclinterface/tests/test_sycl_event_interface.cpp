@@ -204,3 +204,50 @@ TEST_F(TestDPCTLSyclEventInterface, CheckGetWaitListSYCL)
     ASSERT_TRUE(DPCTLEventVector_Size(EVRef) > 0);
     DPCTLEventVector_Delete(EVRef);
 }
+
+TEST_F(TestDPCTLSyclEventInterface, CheckWaitForAll)
+{
+    DPCTLSyclEventRef Events[2] = {ERef, ERef};
+    DPCTLEventVectorRef EVRef = nullptr;
+    EXPECT_NO_FATAL_FAILURE(EVRef =
+                                DPCTLEventVector_CreateFromArray(2, Events));
+    ASSERT_TRUE(EVRef);
+    EXPECT_NO_FATAL_FAILURE(DPCTLEvent_WaitForAll(EVRef));
+    EXPECT_NO_FATAL_FAILURE(DPCTLEventVector_Delete(EVRef));
+}
+
+TEST_F(TestDPCTLSyclEventInterface, CheckWaitForAll_Empty)
+{
+    DPCTLEventVectorRef EVRef = nullptr;
+    EXPECT_NO_FATAL_FAILURE(EVRef = DPCTLEventVector_Create());
+    ASSERT_TRUE(EVRef);
+    EXPECT_NO_FATAL_FAILURE(DPCTLEvent_WaitForAll(EVRef));
+    EXPECT_NO_FATAL_FAILURE(DPCTLEventVector_Delete(EVRef));
+}
+
+TEST_F(TestDPCTLSyclEventInterface, CheckWaitForAll_Invalid)
+{
+    DPCTLEventVectorRef EVRef = nullptr;
+    EXPECT_NO_FATAL_FAILURE(DPCTLEvent_WaitForAll(EVRef));
+}
+
+TEST_F(TestDPCTLSyclEventInterface, CheckWaitForAllSYCL)
+{
+    sycl::queue q;
+    sycl::buffer<int> data1{42};
+    sycl::buffer<int> data2{42};
+    sycl::event e1, e2;
+
+    EXPECT_NO_FATAL_FAILURE(e1 = produce_event(q, data1));
+    EXPECT_NO_FATAL_FAILURE(e2 = produce_event(q, data2));
+    DPCTLSyclEventRef Events[2] = {reinterpret_cast<DPCTLSyclEventRef>(&e1),
+                                   reinterpret_cast<DPCTLSyclEventRef>(&e2)};
+    DPCTLEventVectorRef EVRef = DPCTLEventVector_CreateFromArray(2, Events);
+    ASSERT_TRUE(EVRef);
+    EXPECT_NO_FATAL_FAILURE(DPCTLEvent_WaitForAll(EVRef));
+    EXPECT_TRUE(e1.get_info<sycl::info::event::command_execution_status>() ==
+                sycl::info::event_command_status::complete);
+    EXPECT_TRUE(e2.get_info<sycl::info::event::command_execution_status>() ==
+                sycl::info::event_command_status::complete);
+    DPCTLEventVector_Delete(EVRef);
+}
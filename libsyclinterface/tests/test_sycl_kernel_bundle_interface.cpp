@@ -166,6 +166,27 @@ TEST_P(TestDPCTLSyclKernelBundleInterface, ChkGetKernel)
     EXPECT_NO_FATAL_FAILURE(DPCTLKernel_Delete(NullKernel));
 }
 
+TEST_P(TestDPCTLSyclKernelBundleInterface, ChkGetKernelRepeated)
+{
+    ASSERT_TRUE(DPCTLKernelBundle_HasKernel(KBRef, "add"));
+    ASSERT_FALSE(DPCTLKernelBundle_HasKernel(KBRef, "no_such_kernel"));
+
+    for (int i = 0; i < 3; ++i) {
+        auto AddKernel = DPCTLKernelBundle_GetKernel(KBRef, "add");
+        ASSERT_TRUE(AddKernel != nullptr);
+        EXPECT_EQ(DPCTLKernel_GetNumArgs(AddKernel), 3ul);
+        DPCTLKernel_Delete(AddKernel);
+    }
+
+    // kernels obtained from the bundle outlive it
+    auto Copied_KBRef = DPCTLKernelBundle_Copy(KBRef);
+    auto AxpyKernel = DPCTLKernelBundle_GetKernel(Copied_KBRef, "axpy");
+    DPCTLKernelBundle_Delete(Copied_KBRef);
+    ASSERT_TRUE(AxpyKernel != nullptr);
+    EXPECT_EQ(DPCTLKernel_GetNumArgs(AxpyKernel), 4ul);
+    DPCTLKernel_Delete(AxpyKernel);
+}
+
 TEST_P(TestDPCTLSyclKernelBundleInterface, ChkGetKernelNullProgram)
 {
     DPCTLSyclKernelBundleRef NullRef = nullptr;
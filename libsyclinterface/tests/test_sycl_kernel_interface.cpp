@@ -199,6 +199,46 @@ TEST_P(TestDPCTLSyclKernelInterface, CheckGetCompileSubGroupSize)
     EXPECT_TRUE(axpy_csg_sz >= 0);
 }
 
+TEST_P(TestDPCTLSyclKernelInterface, CheckSuggestNDRange)
+{
+    size_t wgsz = DPCTLKernel_GetWorkGroupSize(AxpyKRef);
+    size_t gRange[] = {3, 1024};
+    size_t lRange[] = {0, 0};
+    bool res = false;
+
+    EXPECT_NO_FATAL_FAILURE(
+        res = DPCTLKernel_SuggestNDRange(AxpyKRef, DRef, gRange, lRange, 2, 0));
+    ASSERT_TRUE(res);
+    for (size_t i = 0; i < 2; ++i) {
+        ASSERT_TRUE(lRange[i] > 0);
+        EXPECT_EQ(gRange[i] % lRange[i], 0);
+    }
+    EXPECT_TRUE(lRange[0] * lRange[1] <= wgsz);
+
+    size_t gRange1D[] = {1021};
+    size_t lRange1D[] = {0};
+    EXPECT_NO_FATAL_FAILURE(res = DPCTLKernel_SuggestNDRange(
+                                AddKRef, DRef, gRange1D, lRange1D, 1, 64));
+    ASSERT_TRUE(res);
+    ASSERT_TRUE(lRange1D[0] > 0);
+    EXPECT_EQ(gRange1D[0] % lRange1D[0], 0);
+}
+
+TEST_P(TestDPCTLSyclKernelInterface, CheckSuggestNDRangeInvalid)
+{
+    size_t gRange[] = {1024, 1, 1, 1};
+    size_t lRange[] = {0, 0, 0, 0};
+
+    EXPECT_FALSE(
+        DPCTLKernel_SuggestNDRange(AddKRef, DRef, gRange, lRange, 4, 0));
+    EXPECT_FALSE(
+        DPCTLKernel_SuggestNDRange(AddKRef, DRef, gRange, lRange, 0, 0));
+    EXPECT_FALSE(DPCTLKernel_SuggestNDRange(AddKRef, DRef, gRange, lRange, 1,
+                                            SIZE_MAX));
+    EXPECT_FALSE(
+        DPCTLKernel_SuggestNDRange(nullptr, DRef, gRange, lRange, 1, 0));
+}
+
 INSTANTIATE_TEST_SUITE_P(TestKernelInterfaceFunctions,
                          TestDPCTLSyclKernelInterface,
                          ::testing::Values("opencl:gpu:0", "opencl:cpu:0"));
@@ -194,6 +194,69 @@ TEST_F(TestQueueSubmit, CheckSubmitNDRange_saxpy)
     DPCTLDeviceSelector_Delete(DSRef);
 }
 
+TEST_F(TestQueueSubmit, CheckSubmitNDRange_LocalAccessor)
+{
+    const char *CLProgramStr = R"CLC(
+        kernel void reverse_groups(global int *a, local int *tmp) {
+            size_t lid = get_local_id(0);
+            size_t gid = get_global_id(0);
+            tmp[lid] = a[gid];
+            barrier(CLK_LOCAL_MEM_FENCE);
+            a[gid] = tmp[get_local_size(0) - 1 - lid];
+        }
+    )CLC";
+    constexpr size_t wg_size = 8;
+
+    auto DSRef = DPCTLFilterSelector_Create("opencl");
+    auto DRef = DPCTLDevice_CreateFromSelector(DSRef);
+    DPCTLDeviceSelector_Delete(DSRef);
+    if (!DRef) {
+        GTEST_SKIP_("Skipping as no OpenCL device is available.");
+    }
+    auto QRef =
+        DPCTLQueue_CreateForDevice(DRef, nullptr, DPCTL_DEFAULT_PROPERTY);
+    ASSERT_TRUE(QRef);
+    auto CRef = DPCTLQueue_GetContext(QRef);
+    ASSERT_TRUE(CRef);
+    auto KBRef =
+        DPCTLKernelBundle_CreateFromOCLSource(CRef, DRef, CLProgramStr, "");
+    ASSERT_TRUE(KBRef != nullptr);
+    auto KRef = DPCTLKernelBundle_GetKernel(KBRef, "reverse_groups");
+    ASSERT_TRUE(KRef != nullptr);
+
+    auto a = DPCTLmalloc_shared(SIZE * sizeof(int), QRef);
+    ASSERT_TRUE(a != nullptr);
+    auto a_ptr = reinterpret_cast<int *>(unwrap<void>(a));
+    for (auto i = 0ul; i < SIZE; ++i) {
+        a_ptr[i] = i;
+    }
+
+    MDLocalAccessor la{1, DPCTL_INT, wg_size, 1, 1};
+    void *args[2] = {unwrap<void>(a), (void *)&la};
+    DPCTLKernelArgType argTypes[] = {DPCTL_VOID_PTR, DPCTL_LOCAL_ACCESSOR};
+    size_t gRange[] = {SIZE};
+    size_t lRange[] = {wg_size};
+
+    auto ERef = DPCTLQueue_SubmitNDRange(KRef, QRef, args, argTypes, 2,
+                                         gRange, lRange, 1, nullptr, 0);
+    ASSERT_TRUE(ERef != nullptr);
+    DPCTLQueue_Wait(QRef);
+
+    for (auto i = 0ul; i < SIZE; ++i) {
+        size_t group_start = (i / wg_size) * wg_size;
+        size_t expected = group_start + (wg_size - 1 - (i - group_start));
+        EXPECT_EQ(a_ptr[i], static_cast<int>(expected));
+    }
+
+    DPCTLEvent_Delete(ERef);
+    DPCTLKernel_Delete(KRef);
+    DPCTLfree_with_queue((DPCTLSyclUSMRef)a, QRef);
+    DPCTLQueue_Delete(QRef);
+    DPCTLContext_Delete(CRef);
+    DPCTLKernelBundle_Delete(KBRef);
+    DPCTLDevice_Delete(DRef);
+}
+
 struct TestQueueSubmitBarrier : public ::testing::Test
 {
     DPCTLSyclQueueRef QRef = nullptr;
@@ -164,6 +164,42 @@ TEST_F(TestDPCTLSyclUSMInterface, AlignedAllocHost)
     DPCTLfree_with_queue(Ptr, Q);
 }
 
+TEST_F(TestDPCTLSyclUSMInterface, PlaceByFirstTouch)
+{
+    auto Q = DPCTLQueueMgr_GetCurrentQueue();
+    ASSERT_TRUE(Q);
+    const size_t nbytes = SIZE;
+    auto Ptr = DPCTLmalloc_shared(nbytes, Q);
+    ASSERT_TRUE(bool(Ptr));
+    auto Host_Ptr = reinterpret_cast<char *>(unwrap<void>(Ptr));
+    std::memset(Host_Ptr, 1, nbytes);
+
+    DPCTLSyclQueueRef QRefs[] = {Q, Q};
+    bool res = false;
+    // interleaved chunks which do not evenly divide the allocation
+    EXPECT_NO_FATAL_FAILURE(
+        res = DPCTLUSM_PlaceByFirstTouch(Ptr, nbytes, QRefs, 2, 100));
+    EXPECT_TRUE(res);
+    for (size_t i = 0; i < nbytes; ++i) {
+        ASSERT_EQ(Host_Ptr[i], 0);
+    }
+
+    std::memset(Host_Ptr, 1, nbytes);
+    EXPECT_NO_FATAL_FAILURE(
+        res = DPCTLUSM_PlaceByFirstTouch(Ptr, nbytes, QRefs, 1, 0));
+    EXPECT_TRUE(res);
+    for (size_t i = 0; i < nbytes; ++i) {
+        ASSERT_EQ(Host_Ptr[i], 0);
+    }
+
+    EXPECT_FALSE(DPCTLUSM_PlaceByFirstTouch(Ptr, nbytes, QRefs, 0, 0));
+    EXPECT_FALSE(DPCTLUSM_PlaceByFirstTouch(Ptr, nbytes, nullptr, 1, 0));
+    EXPECT_FALSE(DPCTLUSM_PlaceByFirstTouch(nullptr, nbytes, QRefs, 1, 0));
+
+    DPCTLfree_with_queue(Ptr, Q);
+    DPCTLQueue_Delete(Q);
+}
+
 struct TestDPCTLSyclUSMNullArgs : public ::testing::Test
 {
 };